@@ -30,7 +30,7 @@ public:
     bool is_connected() const override;
     void disconnect() override;
     
-    std::vector<Core::Bar> get_recent_bars(const Core::BarRequest& request) const override;
+    Core::BarsResult get_recent_bars(const Core::BarRequest& request) const override;
     double get_current_price(const std::string& symbol) const override;
     Core::QuoteData get_realtime_quotes(const std::string& symbol) const override;
     
@@ -1,7 +1,9 @@
 #include "alpaca_trading_client.hpp"
+#include "utils/time_utils.hpp"
 #include "utils/http_utils.hpp"
 #include "json/json.hpp"
 #include <stdexcept>
+#include <utility>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -49,28 +51,27 @@ void AlpacaTradingClient::disconnect() {
     connected = false;
 }
 
-std::vector<Core::Bar> AlpacaTradingClient::get_recent_bars(const Core::BarRequest& request) const {
+Core::BarsResult AlpacaTradingClient::get_recent_bars(const Core::BarRequest& request) const {
     if (!is_connected()) {
-        throw std::runtime_error("Alpaca trading client not connected");
+        return Core::BarsResult::failure(Core::MarketDataStatus::NOT_CONNECTED, "Alpaca trading client not connected", 0);
     }
     
     if (request.symbol.empty()) {
-        throw std::runtime_error("Symbol is required for bar request");
+        return Core::BarsResult::failure(Core::MarketDataStatus::INVALID_REQUEST, "Symbol is required for bar request", 0);
     }
     
     if (request.limit <= 0) {
-        throw std::runtime_error("Limit must be greater than 0 for bar request");
+        return Core::BarsResult::failure(Core::MarketDataStatus::INVALID_REQUEST, "Limit must be greater than 0 for bar request", 0);
     }
     
     std::string request_url = build_url_with_symbol(config.endpoints.bars, request.symbol);
     request_url += "?limit=" + std::to_string(request.limit);
     request_url += "&timeframe=1Min";
     
-    std::string response = make_authenticated_request(request_url, "GET", "");
-    
     std::vector<Core::Bar> bars;
     
     try {
+        std::string response = make_authenticated_request(request_url, "GET", "");
         json response_json = json::parse(response);
         
         if (!response_json.contains("bars") || !response_json["bars"].is_array()) {
@@ -90,16 +91,16 @@ std::vector<Core::Bar> AlpacaTradingClient::get_recent_bars(const Core::BarReque
             bar.low_price = bar_data["l"].get<double>();
             bar.close_price = bar_data["c"].get<double>();
             bar.volume = bar_data["v"].get<double>();
-            bar.timestamp = bar_data["t"].get<std::string>();
+            bar.timestamp_ns = TimeUtils::parse_iso_time_to_epoch_nanoseconds(bar_data["t"].get<std::string>());
             
             bars.push_back(bar);
         }
         
     } catch (const std::exception& exception_error) {
-        throw std::runtime_error("Failed to parse Alpaca bars response: " + std::string(exception_error.what()));
+        return Core::BarsResult::failure(Core::MarketDataStatus::PROVIDER_ERROR, "Failed to fetch or parse Alpaca bars response: " + std::string(exception_error.what()), 0);
     }
     
-    return bars;
+    return Core::BarsResult::success(std::move(bars));
 }
 
 double AlpacaTradingClient::get_current_price(const std::string& symbol) const {
@@ -162,7 +163,7 @@ Core::QuoteData AlpacaTradingClient::get_realtime_quotes(const std::string& symb
         quote_data.bid_price = quote_object.value("bp", 0.0);
         quote_data.ask_size = quote_object.value("as", 0.0);
         quote_data.bid_size = quote_object.value("bs", 0.0);
-        quote_data.timestamp = quote_object.value("t", "");
+        quote_data.timestamp_ns = TimeUtils::parse_iso_time_to_epoch_nanoseconds(quote_object.value("t", ""));
         quote_data.mid_price = (quote_data.ask_price + quote_data.bid_price) / 2.0;
         
     } catch (const std::exception& exception_error) {
@@ -62,9 +62,9 @@ ApiProviderInterface* ApiManager::get_provider(Config::ApiProvider provider) con
     return it->second.get();
 }
 
-std::vector<Core::Bar> ApiManager::get_recent_bars(const Core::BarRequest& request) const {
+Core::BarsResult ApiManager::get_recent_bars(const Core::BarRequest& request) const {
     if (request.symbol.empty()) {
-        throw std::runtime_error("Symbol is required for bar request");
+        return Core::BarsResult::failure(Core::MarketDataStatus::INVALID_REQUEST, "Symbol is required for bar request", 0);
     }
     
     Config::ApiProvider provider = determine_provider_for_symbol(request.symbol);
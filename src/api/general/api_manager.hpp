@@ -34,7 +34,7 @@ public:
     bool has_provider(Config::ApiProvider provider) const;
     ApiProviderInterface* get_provider(Config::ApiProvider provider) const;
     
-    std::vector<Core::Bar> get_recent_bars(const Core::BarRequest& request) const;
+    Core::BarsResult get_recent_bars(const Core::BarRequest& request) const;
     double get_current_price(const std::string& symbol) const;
     Core::QuoteData get_realtime_quotes(const std::string& symbol) const;
     
@@ -2,6 +2,7 @@
 #define API_PROVIDER_INTERFACE_HPP
 
 #include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/market_data_result.hpp"
 #include "configs/multi_api_config.hpp"
 #include <vector>
 #include <string>
@@ -18,7 +19,8 @@ public:
     virtual bool is_connected() const = 0;
     virtual void disconnect() = 0;
     
-    virtual std::vector<Core::Bar> get_recent_bars(const Core::BarRequest& request) const = 0;
+    // Request problems and "not enough data yet" come back as statuses, never as exceptions
+    virtual Core::BarsResult get_recent_bars(const Core::BarRequest& request) const = 0;
     virtual double get_current_price(const std::string& symbol) const = 0;
     virtual Core::QuoteData get_realtime_quotes(const std::string& symbol) const = 0;
     
@@ -1,4 +1,5 @@
 #include "bar_accumulator.hpp"
+#include "utils/time_utils.hpp"
 #include <algorithm>
 #include <cmath>
 
@@ -6,33 +7,74 @@ namespace AlpacaTrader {
 namespace API {
 namespace Polygon {
 
-BarAccumulator::BarAccumulator(int firstLevelAccumulationSecondsValue, int secondLevelAccumulationSecondsValue, int maxBarHistorySizeValue)
-    : firstLevelAccumulationSecondsValueParameter(firstLevelAccumulationSecondsValue)
-    , secondLevelAccumulationSecondsValueParameter(secondLevelAccumulationSecondsValue)
-    , maxBarHistorySizeValueParameter(maxBarHistorySizeValue)
-    , currentFirstLevelAccumulationCountValue(0)
-    , currentFirstLevelAccumulationWindowStartTimestamp(0)
-    , currentSecondLevelAccumulationCountValue(0)
-    , currentSecondLevelAccumulationWindowStartTimestamp(0)
+namespace {
+// XAS aggregates cover one second each
+const int64_t incomingBarSpanNanoseconds = TimeUtils::NANOSECONDS_PER_SECOND;
+// How long after a window ends late per-second aggregates are still accepted by the timer flush
+const int64_t windowCloseGraceNanoseconds = 2 * TimeUtils::NANOSECONDS_PER_SECOND;
+} // namespace
+
+BarAccumulator::TimeframeLevelState::TimeframeLevelState(int timeframeSeconds, int64_t childSpanNanoseconds, size_t historyCapacityValue)
+    : timeframeSecondsValue(timeframeSeconds)
+    , timeframeNanosecondsValue(static_cast<int64_t>(timeframeSeconds) * TimeUtils::NANOSECONDS_PER_SECOND)
+    , childSpanNanosecondsValue(childSpanNanoseconds)
+    , completedBarsHistory(historyCapacityValue)
+    , accumulatingBarData()
+    , accumulationCountValue(0)
+    , lastClosedWindowStartValue(0)
+    , lastClosePriceValue(0.0)
 {
-    if (firstLevelAccumulationSecondsValueParameter <= 0) {
-        throw std::runtime_error("First level accumulation period must be greater than 0");
-    }
-    
-    if (secondLevelAccumulationSecondsValueParameter <= 0) {
-        throw std::runtime_error("Second level accumulation period must be greater than 0");
-    }
-    
-    if (secondLevelAccumulationSecondsValueParameter % firstLevelAccumulationSecondsValueParameter != 0) {
-        throw std::runtime_error("Second level accumulation period must be a multiple of first level accumulation period");
+}
+
+bool BarAccumulator::TimeframeLevelState::isAccumulatingBarValid() const {
+    return accumulationCountValue > 0 &&
+           accumulatingBarData.open_price > 0.0 &&
+           accumulatingBarData.close_price > 0.0;
+}
+
+size_t BarAccumulator::TimeframeLevelState::availableBarsCount() const {
+    return completedBarsHistory.size() + (isAccumulatingBarValid() ? 1 : 0);
+}
+
+int64_t BarAccumulator::TimeframeLevelState::alignToWindowStart(int64_t timestampNanosecondsValue) const {
+    return timestampNanosecondsValue - (timestampNanosecondsValue % timeframeNanosecondsValue);
+}
+
+BarAccumulator::BarAccumulator(const std::vector<int>& timeframeSecondsValues, int maxBarHistorySizeValue)
+    : maxBarHistorySizeValueParameter(maxBarHistorySizeValue)
+    , lastIncomingBarTimestampValue(0)
+{
+    if (timeframeSecondsValues.empty()) {
+        throw std::runtime_error("At least one accumulation timeframe must be configured");
     }
     
     if (maxBarHistorySizeValueParameter <= 0) {
         throw std::runtime_error("Maximum bar history size must be greater than 0");
     }
     
-    currentFirstLevelAccumulatingBarData = Core::Bar{};
-    currentSecondLevelAccumulatingBarData = Core::Bar{};
+    timeframeLevels.reserve(timeframeSecondsValues.size());
+    for (size_t levelIndexValue = 0; levelIndexValue < timeframeSecondsValues.size(); ++levelIndexValue) {
+        int timeframeSecondsValue = timeframeSecondsValues[levelIndexValue];
+        if (timeframeSecondsValue <= 0) {
+            throw std::runtime_error("Accumulation timeframe must be greater than 0");
+        }
+        
+        // Level 0 is fed per-second bars; higher levels are fed completed bars of the level below
+        int64_t childSpanNanosecondsValue = incomingBarSpanNanoseconds;
+        if (levelIndexValue > 0) {
+            int childTimeframeSecondsValue = timeframeSecondsValues[levelIndexValue - 1];
+            if (timeframeSecondsValue <= childTimeframeSecondsValue) {
+                throw std::runtime_error("Accumulation timeframes must be strictly increasing");
+            }
+            if (timeframeSecondsValue % childTimeframeSecondsValue != 0) {
+                throw std::runtime_error("Accumulation timeframe " + std::to_string(timeframeSecondsValue) +
+                                         "s must be a multiple of " + std::to_string(childTimeframeSecondsValue) + "s");
+            }
+            childSpanNanosecondsValue = static_cast<int64_t>(childTimeframeSecondsValue) * TimeUtils::NANOSECONDS_PER_SECOND;
+        }
+        
+        timeframeLevels.emplace_back(timeframeSecondsValue, childSpanNanosecondsValue, static_cast<size_t>(maxBarHistorySizeValueParameter));
+    }
 }
 
 void BarAccumulator::addBar(const Core::Bar& incomingBarData) {
@@ -44,31 +86,40 @@ void BarAccumulator::addBar(const Core::Bar& incomingBarData) {
             return;
         }
         
-        long long barTimestampValue = 0;
-        try {
-            barTimestampValue = std::stoll(incomingBarData.timestamp);
-        } catch (const std::exception&) {
+        if (incomingBarData.timestamp_ns <= 0) {
             return;
         }
         
-        if (currentFirstLevelAccumulationCountValue == 0) {
-            currentFirstLevelAccumulationWindowStartTimestamp = barTimestampValue;
-            currentFirstLevelAccumulatingBarData.open_price = incomingBarData.open_price;
-            currentFirstLevelAccumulatingBarData.high_price = incomingBarData.high_price;
-            currentFirstLevelAccumulatingBarData.low_price = incomingBarData.low_price;
-            currentFirstLevelAccumulatingBarData.close_price = incomingBarData.close_price;
-            currentFirstLevelAccumulatingBarData.volume = incomingBarData.volume;
-            currentFirstLevelAccumulatingBarData.timestamp = incomingBarData.timestamp;
-            currentFirstLevelAccumulationCountValue = 1;
-        } else {
-            currentFirstLevelAccumulatingBarData.high_price = std::max(currentFirstLevelAccumulatingBarData.high_price, incomingBarData.high_price);
-            currentFirstLevelAccumulatingBarData.low_price = std::min(currentFirstLevelAccumulatingBarData.low_price, incomingBarData.low_price);
-            currentFirstLevelAccumulatingBarData.close_price = incomingBarData.close_price;
-            currentFirstLevelAccumulatingBarData.volume += incomingBarData.volume;
-            currentFirstLevelAccumulationCountValue++;
-            
-            if (currentFirstLevelAccumulationCountValue >= firstLevelAccumulationSecondsValueParameter) {
-                finalizeCurrentFirstLevelAccumulatedBar();
+        lastIncomingBarTimestampValue = std::max(lastIncomingBarTimestampValue, incomingBarData.timestamp_ns);
+        foldIntoLevel(0, incomingBarData);
+    } catch (const std::exception&) {
+    } catch (...) {
+    }
+}
+
+void BarAccumulator::flushElapsedWindows(int64_t currentTimeNanoseconds) {
+    std::lock_guard<std::mutex> stateGuard(accumulatorStateMutex);
+    
+    try {
+        int64_t closeCutoffNanosecondsValue = currentTimeNanoseconds - windowCloseGraceNanoseconds;
+        
+        // Level 0 first: its closes and fills cascade upward and usually close the higher windows too
+        TimeframeLevelState& baseLevelState = timeframeLevels.front();
+        if (baseLevelState.accumulationCountValue > 0 &&
+            baseLevelState.accumulatingBarData.timestamp_ns + baseLevelState.timeframeNanosecondsValue <= closeCutoffNanosecondsValue) {
+            closeLevelWindow(0);
+        }
+        if (baseLevelState.accumulationCountValue == 0 && baseLevelState.lastClosedWindowStartValue != 0) {
+            // Every window ending at or before the cutoff is final, even if no trade arrived in it
+            int64_t firstOpenWindowStartValue = baseLevelState.alignToWindowStart(closeCutoffNanosecondsValue);
+            forwardFillLevelWindows(0, firstOpenWindowStartValue);
+        }
+        
+        for (size_t levelIndexValue = 1; levelIndexValue < timeframeLevels.size(); ++levelIndexValue) {
+            TimeframeLevelState& levelState = timeframeLevels[levelIndexValue];
+            if (levelState.accumulationCountValue > 0 &&
+                levelState.accumulatingBarData.timestamp_ns + levelState.timeframeNanosecondsValue <= closeCutoffNanosecondsValue) {
+                closeLevelWindow(levelIndexValue);
             }
         }
     } catch (const std::exception&) {
@@ -76,6 +127,109 @@ void BarAccumulator::addBar(const Core::Bar& incomingBarData) {
     }
 }
 
+int64_t BarAccumulator::getLastIncomingBarTimestamp() const {
+    std::lock_guard<std::mutex> stateGuard(accumulatorStateMutex);
+    return lastIncomingBarTimestampValue;
+}
+
+void BarAccumulator::foldIntoLevel(size_t levelIndexValue, const Core::Bar& childBarData) {
+    TimeframeLevelState& levelState = timeframeLevels[levelIndexValue];
+    Core::Bar& accumulatingBar = levelState.accumulatingBarData;
+    int64_t childWindowStartValue = levelState.alignToWindowStart(childBarData.timestamp_ns);
+    
+    if (levelState.accumulationCountValue > 0) {
+        if (childWindowStartValue < accumulatingBar.timestamp_ns) {
+            return;
+        }
+        if (childWindowStartValue > accumulatingBar.timestamp_ns) {
+            closeLevelWindow(levelIndexValue);
+        }
+    }
+    
+    if (levelState.accumulationCountValue == 0) {
+        // Late data for a window that was already closed is dropped to keep bars deterministic
+        if (levelState.lastClosedWindowStartValue != 0 && childWindowStartValue <= levelState.lastClosedWindowStartValue) {
+            return;
+        }
+        forwardFillLevelWindows(levelIndexValue, childWindowStartValue);
+        
+        accumulatingBar = childBarData;
+        accumulatingBar.timestamp_ns = childWindowStartValue;
+    } else {
+        accumulatingBar.high_price = std::max(accumulatingBar.high_price, childBarData.high_price);
+        accumulatingBar.low_price = std::min(accumulatingBar.low_price, childBarData.low_price);
+        accumulatingBar.close_price = childBarData.close_price;
+        accumulatingBar.volume += childBarData.volume;
+        accumulatingBar.forward_filled = accumulatingBar.forward_filled && childBarData.forward_filled;
+    }
+    levelState.accumulationCountValue++;
+    
+    // The child covering the final sub-window completes this window without waiting for the timer
+    if (childBarData.timestamp_ns + levelState.childSpanNanosecondsValue >= childWindowStartValue + levelState.timeframeNanosecondsValue) {
+        closeLevelWindow(levelIndexValue);
+    }
+}
+
+void BarAccumulator::closeLevelWindow(size_t levelIndexValue) {
+    TimeframeLevelState& levelState = timeframeLevels[levelIndexValue];
+    if (levelState.accumulationCountValue == 0) {
+        return;
+    }
+    
+    Core::Bar completedBarData = levelState.accumulatingBarData;
+    // Ring buffer evicts the oldest bar once maxBarHistorySize is reached
+    levelState.completedBarsHistory.push(completedBarData);
+    levelState.lastClosedWindowStartValue = completedBarData.timestamp_ns;
+    levelState.lastClosePriceValue = completedBarData.close_price;
+    levelState.accumulatingBarData = Core::Bar{};
+    levelState.accumulationCountValue = 0;
+    
+    if (levelIndexValue + 1 < timeframeLevels.size()) {
+        foldIntoLevel(levelIndexValue + 1, completedBarData);
+    }
+}
+
+void BarAccumulator::forwardFillLevelWindows(size_t levelIndexValue, int64_t untilWindowStartValue) {
+    TimeframeLevelState& levelState = timeframeLevels[levelIndexValue];
+    if (levelState.lastClosedWindowStartValue == 0 || levelState.lastClosePriceValue <= 0.0) {
+        return;
+    }
+    
+    int64_t fillWindowStartValue = levelState.lastClosedWindowStartValue + levelState.timeframeNanosecondsValue;
+    if (fillWindowStartValue >= untilWindowStartValue) {
+        return;
+    }
+    
+    // After a long outage only the windows that still fit in the history are worth filling
+    int64_t missingWindowsCount = (untilWindowStartValue - fillWindowStartValue) / levelState.timeframeNanosecondsValue;
+    int64_t historyCapacityCount = static_cast<int64_t>(levelState.completedBarsHistory.capacity());
+    if (missingWindowsCount > historyCapacityCount) {
+        fillWindowStartValue = untilWindowStartValue - historyCapacityCount * levelState.timeframeNanosecondsValue;
+    }
+    
+    for (; fillWindowStartValue < untilWindowStartValue; fillWindowStartValue += levelState.timeframeNanosecondsValue) {
+        Core::Bar filledBarData;
+        filledBarData.open_price = levelState.lastClosePriceValue;
+        filledBarData.high_price = levelState.lastClosePriceValue;
+        filledBarData.low_price = levelState.lastClosePriceValue;
+        filledBarData.close_price = levelState.lastClosePriceValue;
+        filledBarData.volume = 0.0;
+        filledBarData.timestamp_ns = fillWindowStartValue;
+        filledBarData.forward_filled = true;
+        
+        levelState.accumulatingBarData = filledBarData;
+        levelState.accumulationCountValue = 1;
+        closeLevelWindow(levelIndexValue);
+    }
+}
+
+void BarAccumulator::appendLevelBars(const TimeframeLevelState& levelState, size_t barsRequestedCount, std::vector<Core::Bar>& destinationBars) const {
+    levelState.completedBarsHistory.appendNewestTo(barsRequestedCount, destinationBars);
+    if (destinationBars.size() < barsRequestedCount && levelState.isAccumulatingBarValid()) {
+        destinationBars.push_back(levelState.accumulatingBarData);
+    }
+}
+
 std::vector<Core::Bar> BarAccumulator::getAccumulatedBars(int maximumBarsRequested) const {
     std::lock_guard<std::mutex> stateGuard(accumulatorStateMutex);
     
@@ -84,103 +238,59 @@ std::vector<Core::Bar> BarAccumulator::getAccumulatedBars(int maximumBarsRequest
             return std::vector<Core::Bar>();
         }
         
+        size_t barsRequestedCount = static_cast<size_t>(maximumBarsRequested);
         std::vector<Core::Bar> returnedBars;
         
-        size_t firstLevelBarsCount = firstLevelAccumulatedBarsHistory.size();
-        if (currentFirstLevelAccumulationCountValue > 0 && 
-            currentFirstLevelAccumulatingBarData.open_price > 0.0 && 
-            currentFirstLevelAccumulatingBarData.close_price > 0.0) {
-            firstLevelBarsCount++;
-        }
-        
-        if (firstLevelBarsCount >= static_cast<size_t>(maximumBarsRequested)) {
-            if (!firstLevelAccumulatedBarsHistory.empty()) {
-                size_t barsToReturnCount = std::min(static_cast<size_t>(maximumBarsRequested), firstLevelAccumulatedBarsHistory.size());
-                returnedBars.reserve(barsToReturnCount);
-                
-                size_t startIndexValue = firstLevelAccumulatedBarsHistory.size() - barsToReturnCount;
-                for (size_t i = startIndexValue; i < firstLevelAccumulatedBarsHistory.size(); ++i) {
-                    returnedBars.push_back(firstLevelAccumulatedBarsHistory[i]);
-                }
-            }
-            if (returnedBars.size() < static_cast<size_t>(maximumBarsRequested) && 
-                currentFirstLevelAccumulationCountValue > 0 && 
-                currentFirstLevelAccumulatingBarData.open_price > 0.0 && 
-                currentFirstLevelAccumulatingBarData.close_price > 0.0) {
-                returnedBars.push_back(currentFirstLevelAccumulatingBarData);
-            }
-        } else {
-            size_t secondLevelBarsCount = secondLevelAccumulatedBarsHistory.size();
-            if (currentSecondLevelAccumulationCountValue > 0 && 
-                currentSecondLevelAccumulatingBarData.open_price > 0.0 && 
-                currentSecondLevelAccumulatingBarData.close_price > 0.0) {
-                secondLevelBarsCount++;
-            }
-            
-            if (secondLevelBarsCount >= static_cast<size_t>(maximumBarsRequested)) {
-                if (!secondLevelAccumulatedBarsHistory.empty()) {
-                    size_t barsToReturnCount = std::min(static_cast<size_t>(maximumBarsRequested), secondLevelAccumulatedBarsHistory.size());
-                    returnedBars.reserve(barsToReturnCount);
-                    
-                    size_t startIndexValue = secondLevelAccumulatedBarsHistory.size() - barsToReturnCount;
-                    for (size_t i = startIndexValue; i < secondLevelAccumulatedBarsHistory.size(); ++i) {
-                        returnedBars.push_back(secondLevelAccumulatedBarsHistory[i]);
-                    }
-                }
-                if (returnedBars.size() < static_cast<size_t>(maximumBarsRequested) && 
-                    currentSecondLevelAccumulationCountValue > 0 && 
-                    currentSecondLevelAccumulatingBarData.open_price > 0.0 && 
-                    currentSecondLevelAccumulatingBarData.close_price > 0.0) {
-                    returnedBars.push_back(currentSecondLevelAccumulatingBarData);
-                }
-            } else {
-                if (!firstLevelAccumulatedBarsHistory.empty()) {
-                    returnedBars.insert(returnedBars.end(), firstLevelAccumulatedBarsHistory.begin(), firstLevelAccumulatedBarsHistory.end());
-                }
-                if (currentFirstLevelAccumulationCountValue > 0 && 
-                    currentFirstLevelAccumulatingBarData.open_price > 0.0 && 
-                    currentFirstLevelAccumulatingBarData.close_price > 0.0) {
-                    returnedBars.push_back(currentFirstLevelAccumulatingBarData);
-                }
-                if (returnedBars.size() < static_cast<size_t>(maximumBarsRequested) && !secondLevelAccumulatedBarsHistory.empty()) {
-                    size_t remainingBarsNeeded = maximumBarsRequested - static_cast<int>(returnedBars.size());
-                    size_t barsToAddCount = std::min(static_cast<size_t>(remainingBarsNeeded), secondLevelAccumulatedBarsHistory.size());
-                    size_t startIndexValue = secondLevelAccumulatedBarsHistory.size() - barsToAddCount;
-                    for (size_t i = startIndexValue; i < secondLevelAccumulatedBarsHistory.size(); ++i) {
-                        returnedBars.push_back(secondLevelAccumulatedBarsHistory[i]);
-                    }
-                }
+        for (const TimeframeLevelState& levelState : timeframeLevels) {
+            if (levelState.availableBarsCount() >= barsRequestedCount) {
+                returnedBars.reserve(barsRequestedCount);
+                appendLevelBars(levelState, barsRequestedCount, returnedBars);
+                return returnedBars;
             }
         }
         
-        if (returnedBars.empty()) {
+        const TimeframeLevelState& baseLevelState = timeframeLevels.front();
+        size_t baseLevelBarsCount = baseLevelState.availableBarsCount();
+        if (timeframeLevels.size() < 2) {
+            appendLevelBars(baseLevelState, barsRequestedCount, returnedBars);
             return returnedBars;
         }
         
-        try {
-            std::sort(returnedBars.begin(), returnedBars.end(), [](const Core::Bar& barAValue, const Core::Bar& barBValue) {
-                try {
-                    long long timestampAValue = std::stoll(barAValue.timestamp);
-                    long long timestampBValue = std::stoll(barBValue.timestamp);
-                    return timestampAValue < timestampBValue;
-                } catch (...) {
-                    return barAValue.timestamp < barBValue.timestamp;
-                }
-            });
+        // No level is deep enough: merge all base-level bars with the newest bars of the next level.
+        // Both sequences are time-ordered, so a linear merge replaces the old sort + unique.
+        const BarRingBuffer& nextLevelHistory = timeframeLevels[1].completedBarsHistory;
+        size_t nextLevelTailCount = std::min(barsRequestedCount - baseLevelBarsCount, nextLevelHistory.size());
+        size_t nextLevelIndexValue = nextLevelHistory.size() - nextLevelTailCount;
+        size_t baseLevelIndexValue = 0;
+        returnedBars.reserve(baseLevelBarsCount + nextLevelTailCount);
+        
+        auto appendIfNewTimestamp = [&returnedBars](const Core::Bar& candidateBarData) {
+            if (returnedBars.empty() || returnedBars.back().timestamp_ns != candidateBarData.timestamp_ns) {
+                returnedBars.push_back(candidateBarData);
+            }
+        };
+        
+        while (baseLevelIndexValue < baseLevelBarsCount || nextLevelIndexValue < nextLevelHistory.size()) {
+            const Core::Bar* baseLevelCandidatePointer = nullptr;
+            if (baseLevelIndexValue < baseLevelState.completedBarsHistory.size()) {
+                baseLevelCandidatePointer = &baseLevelState.completedBarsHistory.fromOldest(baseLevelIndexValue);
+            } else if (baseLevelIndexValue < baseLevelBarsCount) {
+                baseLevelCandidatePointer = &baseLevelState.accumulatingBarData;
+            }
             
-            auto uniqueIterator = std::unique(returnedBars.begin(), returnedBars.end(), [](const Core::Bar& barAValue, const Core::Bar& barBValue) {
-                return barAValue.timestamp == barBValue.timestamp;
-            });
-            returnedBars.erase(uniqueIterator, returnedBars.end());
+            const Core::Bar* nextLevelCandidatePointer = nullptr;
+            if (nextLevelIndexValue < nextLevelHistory.size()) {
+                nextLevelCandidatePointer = &nextLevelHistory.fromOldest(nextLevelIndexValue);
+            }
             
-            if (static_cast<int>(returnedBars.size()) > maximumBarsRequested) {
-                size_t startIndexValue = returnedBars.size() - static_cast<size_t>(maximumBarsRequested);
-                returnedBars.erase(returnedBars.begin(), returnedBars.begin() + startIndexValue);
+            if (baseLevelCandidatePointer &&
+                (!nextLevelCandidatePointer || baseLevelCandidatePointer->timestamp_ns <= nextLevelCandidatePointer->timestamp_ns)) {
+                appendIfNewTimestamp(*baseLevelCandidatePointer);
+                baseLevelIndexValue++;
+            } else {
+                appendIfNewTimestamp(*nextLevelCandidatePointer);
+                nextLevelIndexValue++;
             }
-        } catch (const std::exception&) {
-            return std::vector<Core::Bar>();
-        } catch (...) {
-            return std::vector<Core::Bar>();
         }
         
         return returnedBars;
@@ -191,117 +301,91 @@ std::vector<Core::Bar> BarAccumulator::getAccumulatedBars(int maximumBarsRequest
     }
 }
 
-size_t BarAccumulator::getAccumulatedBarsCount() const {
+bool BarAccumulator::getLatestBar(Core::Bar& latestBarResult) const {
     std::lock_guard<std::mutex> stateGuard(accumulatorStateMutex);
     
-    size_t secondLevelBarsCount = secondLevelAccumulatedBarsHistory.size();
-    if (currentSecondLevelAccumulationCountValue > 0 && 
-        currentSecondLevelAccumulatingBarData.open_price > 0.0 && 
-        currentSecondLevelAccumulatingBarData.close_price > 0.0) {
-        secondLevelBarsCount++;
+    const TimeframeLevelState& baseLevelState = timeframeLevels.front();
+    if (!baseLevelState.completedBarsHistory.empty()) {
+        latestBarResult = baseLevelState.completedBarsHistory.fromNewest(0);
+        return true;
     }
-    
-    size_t firstLevelBarsCount = firstLevelAccumulatedBarsHistory.size();
-    if (currentFirstLevelAccumulationCountValue > 0 && 
-        currentFirstLevelAccumulatingBarData.open_price > 0.0 && 
-        currentFirstLevelAccumulatingBarData.close_price > 0.0) {
-        firstLevelBarsCount++;
+    if (baseLevelState.isAccumulatingBarValid()) {
+        latestBarResult = baseLevelState.accumulatingBarData;
+        return true;
     }
+    return false;
+}
+
+size_t BarAccumulator::getAccumulatedBarsCount() const {
+    std::lock_guard<std::mutex> stateGuard(accumulatorStateMutex);
     
-    return std::max(secondLevelBarsCount, firstLevelBarsCount);
+    size_t maximumLevelBarsCount = 0;
+    for (const TimeframeLevelState& levelState : timeframeLevels) {
+        maximumLevelBarsCount = std::max(maximumLevelBarsCount, levelState.availableBarsCount());
+    }
+    return maximumLevelBarsCount;
 }
 
-size_t BarAccumulator::getFirstLevelBarsCount() const {
+void BarAccumulator::clearAccumulatedBars() {
     std::lock_guard<std::mutex> stateGuard(accumulatorStateMutex);
-    return firstLevelAccumulatedBarsHistory.size();
+    for (TimeframeLevelState& levelState : timeframeLevels) {
+        levelState.completedBarsHistory.clear();
+        levelState.accumulatingBarData = Core::Bar{};
+        levelState.accumulationCountValue = 0;
+    }
 }
 
-size_t BarAccumulator::getSecondLevelBarsCount() const {
+std::vector<Core::Bar> BarAccumulator::getTimeframeBars(int timeframeSecondsValue, int maximumBarsRequested) const {
     std::lock_guard<std::mutex> stateGuard(accumulatorStateMutex);
-    return secondLevelAccumulatedBarsHistory.size();
+    
+    std::vector<Core::Bar> returnedBars;
+    const TimeframeLevelState* levelStatePointer = findLevel(timeframeSecondsValue);
+    if (!levelStatePointer || maximumBarsRequested <= 0) {
+        return returnedBars;
+    }
+    
+    // Completed bars first, then the still-accumulating bar as the newest entry
+    size_t barsRequestedCount = static_cast<size_t>(maximumBarsRequested);
+    bool includeAccumulatingFlag = levelStatePointer->isAccumulatingBarValid();
+    size_t completedBarsWantedCount = includeAccumulatingFlag ? barsRequestedCount - 1 : barsRequestedCount;
+    
+    returnedBars.reserve(barsRequestedCount);
+    levelStatePointer->completedBarsHistory.appendNewestTo(completedBarsWantedCount, returnedBars);
+    if (includeAccumulatingFlag) {
+        returnedBars.push_back(levelStatePointer->accumulatingBarData);
+    }
+    return returnedBars;
 }
 
-void BarAccumulator::clearAccumulatedBars() {
+size_t BarAccumulator::getTimeframeBarsCount(int timeframeSecondsValue) const {
     std::lock_guard<std::mutex> stateGuard(accumulatorStateMutex);
-    firstLevelAccumulatedBarsHistory.clear();
-    secondLevelAccumulatedBarsHistory.clear();
-    currentFirstLevelAccumulationCountValue = 0;
-    currentFirstLevelAccumulatingBarData = Core::Bar{};
-    currentFirstLevelAccumulationWindowStartTimestamp = 0;
-    currentSecondLevelAccumulationCountValue = 0;
-    currentSecondLevelAccumulatingBarData = Core::Bar{};
-    currentSecondLevelAccumulationWindowStartTimestamp = 0;
+    const TimeframeLevelState* levelStatePointer = findLevel(timeframeSecondsValue);
+    return levelStatePointer ? levelStatePointer->availableBarsCount() : 0;
 }
 
-void BarAccumulator::finalizeCurrentFirstLevelAccumulatedBar() {
-    if (currentFirstLevelAccumulationCountValue > 0) {
-        Core::Bar completedFirstLevelBarData = currentFirstLevelAccumulatingBarData;
-        firstLevelAccumulatedBarsHistory.push_back(completedFirstLevelBarData);
-        
-        if (static_cast<int>(firstLevelAccumulatedBarsHistory.size()) > maxBarHistorySizeValueParameter) {
-            size_t barsToKeepCount = static_cast<size_t>(maxBarHistorySizeValueParameter);
-            firstLevelAccumulatedBarsHistory.erase(firstLevelAccumulatedBarsHistory.begin(), 
-                                                  firstLevelAccumulatedBarsHistory.begin() + (firstLevelAccumulatedBarsHistory.size() - barsToKeepCount));
-        }
-        
-        processCompletedFirstLevelBar(completedFirstLevelBarData);
-    }
-    
-    currentFirstLevelAccumulationCountValue = 0;
-    currentFirstLevelAccumulatingBarData = Core::Bar{};
-    currentFirstLevelAccumulationWindowStartTimestamp = 0;
+bool BarAccumulator::hasTimeframe(int timeframeSecondsValue) const {
+    return findLevel(timeframeSecondsValue) != nullptr;
 }
 
-void BarAccumulator::finalizeCurrentSecondLevelAccumulatedBar() {
-    if (currentSecondLevelAccumulationCountValue > 0) {
-        secondLevelAccumulatedBarsHistory.push_back(currentSecondLevelAccumulatingBarData);
-        
-        if (static_cast<int>(secondLevelAccumulatedBarsHistory.size()) > maxBarHistorySizeValueParameter) {
-            size_t barsToKeepCount = static_cast<size_t>(maxBarHistorySizeValueParameter);
-            secondLevelAccumulatedBarsHistory.erase(secondLevelAccumulatedBarsHistory.begin(), 
-                                                   secondLevelAccumulatedBarsHistory.begin() + (secondLevelAccumulatedBarsHistory.size() - barsToKeepCount));
-        }
+std::vector<int> BarAccumulator::getConfiguredTimeframesSeconds() const {
+    std::vector<int> timeframeSecondsValues;
+    timeframeSecondsValues.reserve(timeframeLevels.size());
+    for (const TimeframeLevelState& levelState : timeframeLevels) {
+        timeframeSecondsValues.push_back(levelState.timeframeSecondsValue);
     }
-    
-    currentSecondLevelAccumulationCountValue = 0;
-    currentSecondLevelAccumulatingBarData = Core::Bar{};
-    currentSecondLevelAccumulationWindowStartTimestamp = 0;
+    return timeframeSecondsValues;
 }
 
-void BarAccumulator::processCompletedFirstLevelBar(const Core::Bar& completedFirstLevelBarData) {
-    long long barTimestampValue = 0;
-    try {
-        barTimestampValue = std::stoll(completedFirstLevelBarData.timestamp);
-    } catch (const std::exception&) {
-        return;
-    }
-    
-    if (currentSecondLevelAccumulationCountValue == 0) {
-        currentSecondLevelAccumulationWindowStartTimestamp = barTimestampValue;
-        currentSecondLevelAccumulatingBarData.open_price = completedFirstLevelBarData.open_price;
-        currentSecondLevelAccumulatingBarData.high_price = completedFirstLevelBarData.high_price;
-        currentSecondLevelAccumulatingBarData.low_price = completedFirstLevelBarData.low_price;
-        currentSecondLevelAccumulatingBarData.close_price = completedFirstLevelBarData.close_price;
-        currentSecondLevelAccumulatingBarData.volume = completedFirstLevelBarData.volume;
-        currentSecondLevelAccumulatingBarData.timestamp = completedFirstLevelBarData.timestamp;
-        currentSecondLevelAccumulationCountValue = 1;
-    } else {
-        currentSecondLevelAccumulatingBarData.high_price = std::max(currentSecondLevelAccumulatingBarData.high_price, completedFirstLevelBarData.high_price);
-        currentSecondLevelAccumulatingBarData.low_price = std::min(currentSecondLevelAccumulatingBarData.low_price, completedFirstLevelBarData.low_price);
-        currentSecondLevelAccumulatingBarData.close_price = completedFirstLevelBarData.close_price;
-        currentSecondLevelAccumulatingBarData.volume += completedFirstLevelBarData.volume;
-        currentSecondLevelAccumulatingBarData.timestamp = completedFirstLevelBarData.timestamp;
-        currentSecondLevelAccumulationCountValue++;
-        
-        int secondLevelBarsRequired = secondLevelAccumulationSecondsValueParameter / firstLevelAccumulationSecondsValueParameter;
-        if (currentSecondLevelAccumulationCountValue >= secondLevelBarsRequired) {
-            finalizeCurrentSecondLevelAccumulatedBar();
+const BarAccumulator::TimeframeLevelState* BarAccumulator::findLevel(int timeframeSecondsValue) const {
+    // Level layout is fixed at construction, so lookups need no lock
+    for (const TimeframeLevelState& levelState : timeframeLevels) {
+        if (levelState.timeframeSecondsValue == timeframeSecondsValue) {
+            return &levelState;
         }
     }
+    return nullptr;
 }
 
-
 } // namespace Polygon
 } // namespace API
 } // namespace AlpacaTrader
-
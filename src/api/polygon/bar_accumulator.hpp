@@ -2,6 +2,7 @@
 #define BAR_ACCUMULATOR_HPP
 
 #include "trader/data_structures/data_structures.hpp"
+#include "api/polygon/bar_ring_buffer.hpp"
 #include <vector>
 #include <mutex>
 #include <chrono>
@@ -11,36 +12,61 @@ namespace AlpacaTrader {
 namespace API {
 namespace Polygon {
 
+// Builds a pyramid of timeframes (e.g. 5s, 30s, 1m, 5m, 15m, 1h) from one stream of per-second bars.
+// Windows are aligned to epoch multiples of each timeframe and close by time: when the last
+// sub-window arrives, when a later window starts, or from flushElapsedWindows on a timer.
+// Windows without trades are emitted as forward_filled bars so every level stays gap-free.
+// Every completed bar cascades into the next level, which keeps its own ring buffer history.
 class BarAccumulator {
 public:
-    BarAccumulator(int firstLevelAccumulationSecondsValue, int secondLevelAccumulationSecondsValue, int maxBarHistorySizeValue);
+    // timeframeSecondsValues must be strictly increasing, each a multiple of the previous one
+    BarAccumulator(const std::vector<int>& timeframeSecondsValues, int maxBarHistorySizeValue);
     
     void addBar(const Core::Bar& incomingBarData);
+    // Closes windows whose end plus the late-arrival grace has passed, forward-filling empty ones
+    void flushElapsedWindows(int64_t currentTimeNanoseconds);
+    // Start timestamp of the newest real (not forward-filled) incoming bar; 0 before any data
+    int64_t getLastIncomingBarTimestamp() const;
+    // Histories are already time-ordered, so this copies the newest bars without sorting
     std::vector<Core::Bar> getAccumulatedBars(int maximumBarsRequested) const;
+    // O(1) access to the bar getAccumulatedBars(1) would return; false when nothing has accumulated yet
+    bool getLatestBar(Core::Bar& latestBarResult) const;
     size_t getAccumulatedBarsCount() const;
-    size_t getFirstLevelBarsCount() const;
-    size_t getSecondLevelBarsCount() const;
     void clearAccumulatedBars();
     
+    // Newest bars of one configured timeframe, oldest first, including the bar still accumulating
+    std::vector<Core::Bar> getTimeframeBars(int timeframeSecondsValue, int maximumBarsRequested) const;
+    size_t getTimeframeBarsCount(int timeframeSecondsValue) const;
+    bool hasTimeframe(int timeframeSecondsValue) const;
+    std::vector<int> getConfiguredTimeframesSeconds() const;
+
 private:
-    int firstLevelAccumulationSecondsValueParameter;
-    int secondLevelAccumulationSecondsValueParameter;
+    struct TimeframeLevelState {
+        int timeframeSecondsValue;
+        int64_t timeframeNanosecondsValue;
+        int64_t childSpanNanosecondsValue;
+        BarRingBuffer completedBarsHistory;
+        Core::Bar accumulatingBarData;
+        int accumulationCountValue;
+        int64_t lastClosedWindowStartValue;
+        double lastClosePriceValue;
+        
+        TimeframeLevelState(int timeframeSeconds, int64_t childSpanNanoseconds, size_t historyCapacityValue);
+        int64_t alignToWindowStart(int64_t timestampNanosecondsValue) const;
+        bool isAccumulatingBarValid() const;
+        size_t availableBarsCount() const;
+    };
+    
     int maxBarHistorySizeValueParameter;
     mutable std::mutex accumulatorStateMutex;
+    std::vector<TimeframeLevelState> timeframeLevels;
+    int64_t lastIncomingBarTimestampValue;
     
-    std::vector<Core::Bar> firstLevelAccumulatedBarsHistory;
-    Core::Bar currentFirstLevelAccumulatingBarData;
-    int currentFirstLevelAccumulationCountValue;
-    long long currentFirstLevelAccumulationWindowStartTimestamp;
-    
-    std::vector<Core::Bar> secondLevelAccumulatedBarsHistory;
-    Core::Bar currentSecondLevelAccumulatingBarData;
-    int currentSecondLevelAccumulationCountValue;
-    long long currentSecondLevelAccumulationWindowStartTimestamp;
-    
-    void finalizeCurrentFirstLevelAccumulatedBar();
-    void finalizeCurrentSecondLevelAccumulatedBar();
-    void processCompletedFirstLevelBar(const Core::Bar& completedFirstLevelBarData);
+    void foldIntoLevel(size_t levelIndexValue, const Core::Bar& childBarData);
+    void closeLevelWindow(size_t levelIndexValue);
+    void forwardFillLevelWindows(size_t levelIndexValue, int64_t untilWindowStartValue);
+    void appendLevelBars(const TimeframeLevelState& levelState, size_t barsRequestedCount, std::vector<Core::Bar>& destinationBars) const;
+    const TimeframeLevelState* findLevel(int timeframeSecondsValue) const;
 };
 
 } // namespace Polygon
@@ -48,4 +74,3 @@ private:
 } // namespace AlpacaTrader
 
 #endif // BAR_ACCUMULATOR_HPP
-
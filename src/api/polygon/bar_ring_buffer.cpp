@@ -0,0 +1,63 @@
+#include "bar_ring_buffer.hpp"
+#include <stdexcept>
+#include <algorithm>
+
+namespace AlpacaTrader {
+namespace API {
+namespace Polygon {
+
+BarRingBuffer::BarRingBuffer(size_t capacityValue)
+    : barStorage(capacityValue)
+    , nextWriteIndexValue(0)
+    , storedBarsCountValue(0)
+{
+    if (capacityValue == 0) {
+        throw std::runtime_error("Bar ring buffer capacity must be greater than 0");
+    }
+}
+
+void BarRingBuffer::push(const Core::Bar& barData) {
+    barStorage[nextWriteIndexValue] = barData;
+    nextWriteIndexValue = (nextWriteIndexValue + 1) % barStorage.size();
+    if (storedBarsCountValue < barStorage.size()) {
+        storedBarsCountValue++;
+    }
+}
+
+void BarRingBuffer::clear() {
+    nextWriteIndexValue = 0;
+    storedBarsCountValue = 0;
+}
+
+const Core::Bar& BarRingBuffer::fromOldest(size_t indexFromOldestValue) const {
+    if (indexFromOldestValue >= storedBarsCountValue) {
+        throw std::out_of_range("Bar ring buffer index out of range");
+    }
+    size_t oldestIndexValue = (nextWriteIndexValue + barStorage.size() - storedBarsCountValue) % barStorage.size();
+    return barStorage[(oldestIndexValue + indexFromOldestValue) % barStorage.size()];
+}
+
+const Core::Bar& BarRingBuffer::fromNewest(size_t indexFromNewestValue) const {
+    if (indexFromNewestValue >= storedBarsCountValue) {
+        throw std::out_of_range("Bar ring buffer index out of range");
+    }
+    return barStorage[(nextWriteIndexValue + barStorage.size() - 1 - indexFromNewestValue) % barStorage.size()];
+}
+
+void BarRingBuffer::appendNewestTo(size_t barsRequestedCount, std::vector<Core::Bar>& destinationBars) const {
+    size_t barsToCopyCount = std::min(barsRequestedCount, storedBarsCountValue);
+    if (barsToCopyCount == 0) {
+        return;
+    }
+    
+    size_t storageCapacityValue = barStorage.size();
+    size_t copyStartIndexValue = (nextWriteIndexValue + storageCapacityValue - barsToCopyCount) % storageCapacityValue;
+    size_t leadingSegmentCount = std::min(barsToCopyCount, storageCapacityValue - copyStartIndexValue);
+    
+    destinationBars.insert(destinationBars.end(), barStorage.begin() + copyStartIndexValue, barStorage.begin() + copyStartIndexValue + leadingSegmentCount);
+    destinationBars.insert(destinationBars.end(), barStorage.begin(), barStorage.begin() + (barsToCopyCount - leadingSegmentCount));
+}
+
+} // namespace Polygon
+} // namespace API
+} // namespace AlpacaTrader
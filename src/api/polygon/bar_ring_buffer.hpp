@@ -0,0 +1,43 @@
+#ifndef BAR_RING_BUFFER_HPP
+#define BAR_RING_BUFFER_HPP
+
+#include "trader/data_structures/data_structures.hpp"
+#include <vector>
+#include <cstddef>
+
+namespace AlpacaTrader {
+namespace API {
+namespace Polygon {
+
+// Fixed-capacity circular history of bars. Storage is allocated once at construction;
+// appending past capacity overwrites the oldest bar in O(1).
+class BarRingBuffer {
+public:
+    explicit BarRingBuffer(size_t capacityValue);
+    
+    void push(const Core::Bar& barData);
+    void clear();
+    
+    size_t size() const { return storedBarsCountValue; }
+    size_t capacity() const { return barStorage.size(); }
+    bool empty() const { return storedBarsCountValue == 0; }
+    
+    // Index 0 is the oldest stored bar
+    const Core::Bar& fromOldest(size_t indexFromOldestValue) const;
+    // Index 0 is the newest stored bar
+    const Core::Bar& fromNewest(size_t indexFromNewestValue) const;
+    
+    // Appends up to barsRequestedCount newest bars, oldest first, as at most two contiguous range copies
+    void appendNewestTo(size_t barsRequestedCount, std::vector<Core::Bar>& destinationBars) const;
+    
+private:
+    std::vector<Core::Bar> barStorage;
+    size_t nextWriteIndexValue;
+    size_t storedBarsCountValue;
+};
+
+} // namespace Polygon
+} // namespace API
+} // namespace AlpacaTrader
+
+#endif // BAR_RING_BUFFER_HPP
@@ -1,4 +1,5 @@
 #include "polygon_crypto_client.hpp"
+#include "utils/time_utils.hpp"
 #include "utils/http_utils.hpp"
 #include "json/json.hpp"
 #include "api/polygon/bar_accumulator.hpp"
@@ -13,12 +14,18 @@
 #include <random>
 #include <algorithm>
 #include <cstring>
+#include <utility>
 
 using json = nlohmann::json;
 
 namespace AlpacaTrader {
 namespace API {
 
+namespace {
+// Bar windows close by time, so the accumulators are flushed even when no message arrives
+const std::chrono::milliseconds barWindowFlushInterval(500);
+} // namespace
+
 PolygonCryptoClient::PolygonCryptoClient(ConnectivityManager& connectivity_mgr) 
     : connectivity_manager(connectivity_mgr), lastStaleDataLogTime(std::chrono::steady_clock::now()), lastBarsLogTime(std::chrono::steady_clock::now()) {}
 
@@ -55,17 +62,17 @@ void PolygonCryptoClient::disconnect() {
     cleanup_resources();
 }
 
-std::vector<Core::Bar> PolygonCryptoClient::get_recent_bars(const Core::BarRequest& request) const {
+Core::BarsResult PolygonCryptoClient::get_recent_bars(const Core::BarRequest& request) const {
     if (!is_connected()) {
-        throw std::runtime_error("Polygon client not connected");
+        return Core::BarsResult::failure(Core::MarketDataStatus::NOT_CONNECTED, "Polygon client not connected", 0);
     }
     
     if (request.symbol.empty()) {
-        throw std::runtime_error("Symbol is required for bar request");
+        return Core::BarsResult::failure(Core::MarketDataStatus::INVALID_REQUEST, "Symbol is required for bar request", 0);
     }
     
     if (request.limit <= 0) {
-        throw std::runtime_error("Limit must be greater than 0 for bar request");
+        return Core::BarsResult::failure(Core::MarketDataStatus::INVALID_REQUEST, "Limit must be greater than 0 for bar request", 0);
     }
 
     bool websocketNeedsStartFlag = false;
@@ -83,23 +90,24 @@ std::vector<Core::Bar> PolygonCryptoClient::get_recent_bars(const Core::BarReque
         bool startResultValue = const_cast<PolygonCryptoClient*>(this)->start_realtime_feed(symbolVector);
         
         if (!startResultValue) {
-            throw std::runtime_error("Failed to start WebSocket real-time feed for symbol: " + request.symbol);
+            return Core::BarsResult::failure(Core::MarketDataStatus::PROVIDER_ERROR, "Failed to start WebSocket real-time feed for symbol: " + request.symbol, 0);
         }
         
         std::lock_guard<std::mutex> websocketVerifyGuard(data_mutex);
         if (!websocket_active.load()) {
-            throw std::runtime_error("WebSocket is not active after attempting to start real-time feed");
+            return Core::BarsResult::failure(Core::MarketDataStatus::PROVIDER_ERROR, "WebSocket is not active after attempting to start real-time feed", 0);
         }
     }
     
-    Polygon::BarAccumulator* accumulatorPointer = nullptr;
+    // Held by shared_ptr: a feed restart on another thread may drop the map entry while these bars are read
+    std::shared_ptr<Polygon::BarAccumulator> accumulatorPointer;
     {
         std::lock_guard<std::mutex> dataGuard(data_mutex);
         
         auto accumulatorIterator = barAccumulatorMap.find(request.symbol);
         if (accumulatorIterator != barAccumulatorMap.end() && accumulatorIterator->second) {
-            accumulatorPointer = accumulatorIterator->second.get();
-    }
+            accumulatorPointer = accumulatorIterator->second;
+        }
     }
     
     if (!accumulatorPointer) {
@@ -107,100 +115,88 @@ std::vector<Core::Bar> PolygonCryptoClient::get_recent_bars(const Core::BarReque
         symbolVector.push_back(request.symbol);
         
         if (!const_cast<PolygonCryptoClient*>(this)->start_realtime_feed(symbolVector)) {
-            throw std::runtime_error("Failed to start WebSocket real-time feed for symbol: " + request.symbol);
+            return Core::BarsResult::failure(Core::MarketDataStatus::PROVIDER_ERROR, "Failed to start WebSocket real-time feed for symbol: " + request.symbol, 0);
         }
         
         std::lock_guard<std::mutex> dataGuardRetry(data_mutex);
         auto accumulatorIterator = barAccumulatorMap.find(request.symbol);
         if (accumulatorIterator == barAccumulatorMap.end() || !accumulatorIterator->second) {
-            throw std::runtime_error("No accumulator found for symbol: " + request.symbol + " after starting feed");
+            return Core::BarsResult::failure(Core::MarketDataStatus::PROVIDER_ERROR, "No accumulator found for symbol: " + request.symbol + " after starting feed", 0);
         }
-        accumulatorPointer = accumulatorIterator->second.get();
+        accumulatorPointer = accumulatorIterator->second;
     }
     
-    if (!accumulatorPointer) {
-        throw std::runtime_error("No accumulator available for symbol: " + request.symbol);
+    bool timeframeRequestedFlag = request.timeframe_seconds > 0;
+    if (timeframeRequestedFlag && !accumulatorPointer->hasTimeframe(request.timeframe_seconds)) {
+        return Core::BarsResult::failure(Core::MarketDataStatus::INVALID_REQUEST, "Timeframe " + std::to_string(request.timeframe_seconds) + "s is not configured for the WebSocket accumulator", 0);
     }
     
-    size_t accumulatorBarCountValue = accumulatorPointer->getAccumulatedBarsCount();
+    size_t accumulatorBarCountValue = timeframeRequestedFlag
+        ? accumulatorPointer->getTimeframeBarsCount(request.timeframe_seconds)
+        : accumulatorPointer->getAccumulatedBarsCount();
     
-    std::vector<Core::Bar> accumulatedBarsResult = accumulatorPointer->getAccumulatedBars(request.limit);
+    std::vector<Core::Bar> accumulatedBarsResult = timeframeRequestedFlag
+        ? accumulatorPointer->getTimeframeBars(request.timeframe_seconds, request.limit)
+        : accumulatorPointer->getAccumulatedBars(request.limit);
+    // Warm-up is the normal state right after start-up, so it is reported without building an exception
     if (accumulatedBarsResult.empty()) {
         std::string errorMessageString = "WebSocket is active but no accumulated bars available yet. ";
         errorMessageString += "Accumulator has: " + std::to_string(accumulatorBarCountValue) + " bars. ";
         errorMessageString += "Waiting for real-time data to accumulate. ";
         errorMessageString += "First level requires " + std::to_string(config.websocket_bar_accumulation_seconds) + " seconds, ";
         errorMessageString += "second level requires " + std::to_string(config.websocket_second_level_accumulation_seconds) + " seconds of data.";
-        throw std::runtime_error(errorMessageString);
+        return Core::BarsResult::failure(Core::MarketDataStatus::WARMING_UP, std::move(errorMessageString), accumulatorBarCountValue);
     }
     
-    if (accumulatedBarsResult.empty()) {
-        throw std::runtime_error("No accumulated bars available from WebSocket accumulator");
-    }
+    int64_t currentTimeNanosValue = TimeUtils::get_current_epoch_nanoseconds();
     
-    auto currentTimeMillisValue = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::system_clock::now().time_since_epoch()
-    ).count();
+    int maxAgeSecondsValue = config.websocket_bar_accumulation_seconds * 6;
+    int64_t latestBarFreshnessThresholdNanosValue = static_cast<int64_t>(maxAgeSecondsValue) * TimeUtils::NANOSECONDS_PER_SECOND;
     
-    long long latestBarFreshnessThresholdMillisValue = static_cast<long long>(config.websocket_bar_accumulation_seconds) * 1000LL * 6;
+    // Freshness follows the newest real trade data; forward-filled windows keep bar timestamps current
+    int64_t latestBarTimestampNanosValue = accumulatorPointer->getLastIncomingBarTimestamp();
+    
+    if (latestBarTimestampNanosValue <= 0) {
+        std::string invalidTimestampErrorString = "Invalid timestamp in latest WebSocket bar: " + TimeUtils::format_epoch_nanoseconds_raw(latestBarTimestampNanosValue) + " (must be positive epoch nanoseconds)";
+        AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details("INVALID_TIMESTAMP", invalidTimestampErrorString, "trading_system.log");
+        return Core::BarsResult::failure(Core::MarketDataStatus::PROVIDER_ERROR, std::move(invalidTimestampErrorString), accumulatedBarsResult.size());
+    }
     
-    Core::Bar latestBarValue = accumulatedBarsResult.back();
+    int64_t latestBarAgeNanosValue = currentTimeNanosValue - latestBarTimestampNanosValue;
+    long long latestBarAgeSecondsValue = latestBarAgeNanosValue / TimeUtils::NANOSECONDS_PER_SECOND;
     
-    try {
-        long long latestBarTimestampMillisValue = std::stoll(latestBarValue.timestamp);
-        
-        if (latestBarTimestampMillisValue <= 0) {
-            std::string invalidTimestampErrorString = "Invalid timestamp in latest WebSocket bar: " + latestBarValue.timestamp + " (must be positive Unix milliseconds)";
-            AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details("INVALID_TIMESTAMP", invalidTimestampErrorString, "trading_system.log");
-            throw std::runtime_error(invalidTimestampErrorString);
-        }
-        
-        long long latestBarAgeMillisValue = currentTimeMillisValue - latestBarTimestampMillisValue;
-        long long latestBarAgeSecondsValue = latestBarAgeMillisValue / 1000;
+    if (latestBarAgeNanosValue > latestBarFreshnessThresholdNanosValue) {
+        auto nowTimeValue = std::chrono::steady_clock::now();
+        auto timeSinceLastStaleLogValue = std::chrono::duration_cast<std::chrono::seconds>(nowTimeValue - lastStaleDataLogTime).count();
+        bool shouldLogStaleDataFlag = (timeSinceLastStaleLogValue >= 60) || (lastStaleDataTimestampNs != latestBarTimestampNanosValue);
         
-        if (latestBarAgeMillisValue > latestBarFreshnessThresholdMillisValue) {
-            auto nowTimeValue = std::chrono::steady_clock::now();
-            auto timeSinceLastStaleLogValue = std::chrono::duration_cast<std::chrono::seconds>(nowTimeValue - lastStaleDataLogTime).count();
-            bool shouldLogStaleDataFlag = (timeSinceLastStaleLogValue >= 60) || (lastStaleDataTimestamp != latestBarValue.timestamp);
-            
-            if (shouldLogStaleDataFlag) {
-                try {
-                    int maxAgeSecondsValue = config.websocket_bar_accumulation_seconds * 6;
-                    AlpacaTrader::Logging::WebSocketLogs::log_websocket_stale_data_table(
-                        latestBarValue.timestamp,
-                        latestBarAgeSecondsValue,
-                        maxAgeSecondsValue,
-                        "trading_system.log"
-                    );
-                    lastStaleDataLogTime = nowTimeValue;
-                    lastStaleDataTimestamp = latestBarValue.timestamp;
-                } catch (...) {
-                    // Logging failed, continue
-                }
+        if (shouldLogStaleDataFlag) {
+            try {
+                AlpacaTrader::Logging::WebSocketLogs::log_websocket_stale_data_table(
+                    TimeUtils::format_epoch_nanoseconds_human_readable(latestBarTimestampNanosValue),
+                    latestBarAgeSecondsValue,
+                    maxAgeSecondsValue,
+                    "trading_system.log"
+                );
+                lastStaleDataLogTime = nowTimeValue;
+                lastStaleDataTimestampNs = latestBarTimestampNanosValue;
+            } catch (...) {
+                // Logging failed, continue
             }
-            
-            std::string staleLatestBarErrorString = "Latest accumulated bar is stale. ";
-            staleLatestBarErrorString += "Latest bar timestamp: " + latestBarValue.timestamp + " (" + std::to_string(latestBarAgeSecondsValue) + " seconds old). ";
-            staleLatestBarErrorString += "Maximum allowed age for latest bar: " + std::to_string(config.websocket_bar_accumulation_seconds * 6) + " seconds. ";
-            staleLatestBarErrorString += "WebSocket must provide recent data. Total accumulated bars: " + std::to_string(accumulatedBarsResult.size()) + ".";
-            throw std::runtime_error(staleLatestBarErrorString);
         }
         
-    } catch (const std::runtime_error& runtimeExceptionError) {
-        throw;
-    } catch (const std::exception& generalExceptionError) {
-        std::string invalidTimestampErrorString = "Invalid timestamp in WebSocket bar data: " + latestBarValue.timestamp + ". Error: " + std::string(generalExceptionError.what());
-        AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details("INVALID_TIMESTAMP", invalidTimestampErrorString, "trading_system.log");
-        throw std::runtime_error(invalidTimestampErrorString);
-    } catch (...) {
-        throw std::runtime_error("Unknown error validating WebSocket bar timestamps");
+        std::string staleLatestBarErrorString = "Latest accumulated bar is stale. ";
+        staleLatestBarErrorString += "Latest bar timestamp: " + TimeUtils::format_epoch_nanoseconds_human_readable(latestBarTimestampNanosValue) + " (" + std::to_string(latestBarAgeSecondsValue) + " seconds old). ";
+        staleLatestBarErrorString += "Maximum allowed age for latest bar: " + std::to_string(maxAgeSecondsValue) + " seconds. ";
+        staleLatestBarErrorString += "WebSocket must provide recent data. Total accumulated bars: " + std::to_string(accumulatedBarsResult.size()) + ".";
+        return Core::BarsResult::failure(Core::MarketDataStatus::STALE_DATA, std::move(staleLatestBarErrorString), accumulatedBarsResult.size());
     }
     
     if (static_cast<int>(accumulatedBarsResult.size()) < request.limit) {
         std::string insufficientBarsErrorString = "Insufficient accumulated bars available. ";
         insufficientBarsErrorString += "Have " + std::to_string(accumulatedBarsResult.size()) + " bars, need " + std::to_string(request.limit) + ". ";
         insufficientBarsErrorString += "Waiting for more real-time data to accumulate.";
-        throw std::runtime_error(insufficientBarsErrorString);
+        return Core::BarsResult::failure(Core::MarketDataStatus::WARMING_UP, std::move(insufficientBarsErrorString), accumulatedBarsResult.size());
     }
     
     bool shouldLogBarsFlag = false;
@@ -210,7 +206,8 @@ std::vector<Core::Bar> PolygonCryptoClient::get_recent_bars(const Core::BarReque
         auto nowTimeValue = std::chrono::steady_clock::now();
         auto timeSinceLastBarsLogValue = std::chrono::duration_cast<std::chrono::seconds>(nowTimeValue - lastBarsLogTime).count();
         
-        auto lastLoggedBarsIterator = lastLoggedBarsMap.find(request.symbol);
+        std::string lastLoggedBarsKey = timeframeRequestedFlag ? request.symbol + "@" + std::to_string(request.timeframe_seconds) + "s" : request.symbol;
+        auto lastLoggedBarsIterator = lastLoggedBarsMap.find(lastLoggedBarsKey);
         if (lastLoggedBarsIterator == lastLoggedBarsMap.end()) {
             shouldLogBarsFlag = true;
         } else {
@@ -220,11 +217,11 @@ std::vector<Core::Bar> PolygonCryptoClient::get_recent_bars(const Core::BarReque
             } else if (!accumulatedBarsResult.empty() && !lastLoggedBarsValue.empty()) {
                 const Core::Bar& currentLatestBar = accumulatedBarsResult.back();
                 const Core::Bar& lastLoggedLatestBar = lastLoggedBarsValue.back();
-                if (currentLatestBar.timestamp != lastLoggedLatestBar.timestamp ||
+                if (currentLatestBar.timestamp_ns != lastLoggedLatestBar.timestamp_ns ||
                     currentLatestBar.close_price != lastLoggedLatestBar.close_price ||
                     currentLatestBar.volume != lastLoggedLatestBar.volume) {
                     shouldLogBarsFlag = true;
-        }
+                }
             }
             
             if (!shouldLogBarsFlag && timeSinceLastBarsLogValue >= 60) {
@@ -233,7 +230,7 @@ std::vector<Core::Bar> PolygonCryptoClient::get_recent_bars(const Core::BarReque
         }
         
         if (shouldLogBarsFlag) {
-            lastLoggedBarsMap[request.symbol] = accumulatedBarsResult;
+            lastLoggedBarsMap[lastLoggedBarsKey] = accumulatedBarsResult;
             lastBarsLogTime = std::chrono::steady_clock::now();
         }
     }
@@ -246,7 +243,7 @@ std::vector<Core::Bar> PolygonCryptoClient::get_recent_bars(const Core::BarReque
         }
     }
     
-    return accumulatedBarsResult;
+    return Core::BarsResult::success(std::move(accumulatedBarsResult));
 }
 
 double PolygonCryptoClient::get_current_price(const std::string& symbol) const {
@@ -349,7 +346,7 @@ Core::QuoteData PolygonCryptoClient::get_realtime_quotes(const std::string& symb
                 quote_data.mid_price = price;
             }
             if (last.contains("timestamp")) {
-                quote_data.timestamp = std::to_string(last["timestamp"].get<long long>());
+                quote_data.timestamp_ns = TimeUtils::milliseconds_to_epoch_nanoseconds(last["timestamp"].get<long long>());
             }
         }
         
@@ -377,16 +374,61 @@ Config::ApiProvider PolygonCryptoClient::get_provider_type() const {
 }
 
 bool PolygonCryptoClient::start_realtime_feed(const std::vector<std::string>& symbols) {
-    std::lock_guard<std::mutex> dataGuard(data_mutex);
+    // data_mutex is never held across WebSocket client calls: the reactor thread holds its state mutex
+    // while the flush timer and message callbacks take data_mutex, so the opposite order deadlocks
+    std::lock_guard<std::mutex> feedGuard(feed_mutex);
     
-    try {
-    if (!is_connected()) {
-        return false;
+    // A running feed keeps its symbols, so adding one symbol never drops the others
+    std::vector<std::string> feedSymbolVector;
+    {
+        std::lock_guard<std::mutex> subscriptionGuard(data_mutex);
+        if (websocket_active.load()) {
+            feedSymbolVector = subscribed_symbols;
+        }
+    }
+    bool newSymbolRequestedFlag = false;
+    for (const std::string& symbolString : symbols) {
+        if (std::find(feedSymbolVector.begin(), feedSymbolVector.end(), symbolString) == feedSymbolVector.end()) {
+            feedSymbolVector.push_back(symbolString);
+            newSymbolRequestedFlag = true;
+        }
     }
     
-    if (symbols.empty()) {
-        throw std::runtime_error("At least one symbol is required for realtime feed");
+    if (websocket_active.load() && websocketClientPointer) {
+        if (newSymbolRequestedFlag) {
+            // Extend the live connection; restarting would throw away every warmed-up accumulator
+            {
+                std::lock_guard<std::mutex> dataGuard(data_mutex);
+                std::vector<int> accumulationTimeframesSeconds = accumulation_timeframes_seconds();
+                for (const std::string& symbolString : feedSymbolVector) {
+                    if (barAccumulatorMap.find(symbolString) == barAccumulatorMap.end()) {
+                        barAccumulatorMap[symbolString] = std::make_shared<Polygon::BarAccumulator>(
+                            accumulationTimeframesSeconds,
+                            config.websocket_max_bar_history_size
+                        );
+                    }
+                }
+                subscribed_symbols = feedSymbolVector;
+            }
+            websocketClientPointer->requestSubscription(build_subscription_params(feedSymbolVector));
+            return true;
+        }
+        if (!symbols.empty()) {
+            return true;
+        }
+    }
+    if (websocket_active.load()) {
+        stop_feed_connection();
     }
+    
+    try {
+        if (!is_connected()) {
+            return false;
+        }
+        
+        if (symbols.empty()) {
+            throw std::runtime_error("At least one symbol is required for realtime feed");
+        }
         
         if (config.websocket_url.empty()) {
             throw std::runtime_error("WebSocket URL not configured");
@@ -394,13 +436,7 @@ bool PolygonCryptoClient::start_realtime_feed(const std::vector<std::string>& sy
         
         if (config.api_key.empty()) {
             throw std::runtime_error("API key not configured for WebSocket authentication");
-    }
-    
-    if (websocket_active.load()) {
-        stop_realtime_feed();
-    }
-    
-        subscribed_symbols = symbols;
+        }
         
         if (config.websocket_bar_accumulation_seconds <= 0) {
             throw std::runtime_error("websocket_bar_accumulation_seconds must be configured and greater than 0");
@@ -414,12 +450,17 @@ bool PolygonCryptoClient::start_realtime_feed(const std::vector<std::string>& sy
             throw std::runtime_error("websocket_max_bar_history_size must be configured and greater than 0");
         }
         
-        for (const std::string& symbolString : subscribed_symbols) {
-            barAccumulatorMap[symbolString] = std::make_unique<Polygon::BarAccumulator>(
-                config.websocket_bar_accumulation_seconds,
-                config.websocket_second_level_accumulation_seconds,
-                config.websocket_max_bar_history_size
-            );
+        std::vector<int> accumulationTimeframesSeconds = accumulation_timeframes_seconds();
+        
+        {
+            std::lock_guard<std::mutex> dataGuard(data_mutex);
+            subscribed_symbols = feedSymbolVector;
+            for (const std::string& symbolString : subscribed_symbols) {
+                barAccumulatorMap[symbolString] = std::make_shared<Polygon::BarAccumulator>(
+                    accumulationTimeframesSeconds,
+                    config.websocket_max_bar_history_size
+                );
+            }
         }
         
         websocketClientPointer = std::make_unique<Polygon::WebSocketClient>();
@@ -429,6 +470,9 @@ bool PolygonCryptoClient::start_realtime_feed(const std::vector<std::string>& sy
         };
         
         websocketClientPointer->setMessageCallback(messageCallbackLambda);
+        websocketClientPointer->setPeriodicTimerCallback([this]() {
+            this->flush_elapsed_bar_windows();
+        }, barWindowFlushInterval);
         
         if (!websocketClientPointer->connect(config.websocket_url)) {
             std::string connectionErrorString = websocketClientPointer->getLastError();
@@ -447,70 +491,78 @@ bool PolygonCryptoClient::start_realtime_feed(const std::vector<std::string>& sy
         
         std::this_thread::sleep_for(std::chrono::milliseconds(500));
         
-        std::string subscriptionParamsString;
-        if (subscribed_symbols.size() == 1) {
-            std::string websocketSymbolString = convert_symbol_for_websocket(subscribed_symbols[0]);
-            subscriptionParamsString = "XAS." + websocketSymbolString;
-        } else {
-            subscriptionParamsString = "XAS.*";
-        }
-        
-        if (!websocketClientPointer->subscribe(subscriptionParamsString)) {
+        if (!websocketClientPointer->subscribe(build_subscription_params(feedSymbolVector))) {
             std::string subscriptionErrorString = websocketClientPointer->getLastError();
             websocketClientPointer->disconnect();
             websocketClientPointer.reset();
             throw std::runtime_error("WebSocket subscription failed: " + subscriptionErrorString);
         }
         
+        if (!websocketReactorPointer) {
+            websocketReactorPointer = std::make_shared<Polygon::WebSocketReactor>();
+        }
+        websocketClientPointer->setReactor(websocketReactorPointer);
         websocketClientPointer->startReceiveLoop();
         
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    
-    websocket_active = true;
-    
-    return true;
+        
+        websocket_active = true;
+        
+        return true;
         
     } catch (const std::exception& startFeedExceptionError) {
-        barAccumulatorMap.clear();
-        if (websocketClientPointer) {
-            websocketClientPointer->disconnect();
-            websocketClientPointer.reset();
-        }
-        websocket_active = false;
+        stop_feed_connection();
         throw;
     } catch (...) {
-        barAccumulatorMap.clear();
-        if (websocketClientPointer) {
-            websocketClientPointer->disconnect();
-            websocketClientPointer.reset();
-        }
-        websocket_active = false;
+        stop_feed_connection();
         throw std::runtime_error("Unknown error starting realtime feed");
     }
 }
 
+std::vector<int> PolygonCryptoClient::accumulation_timeframes_seconds() const {
+    std::vector<int> accumulationTimeframesSeconds;
+    accumulationTimeframesSeconds.push_back(config.websocket_bar_accumulation_seconds);
+    accumulationTimeframesSeconds.push_back(config.websocket_second_level_accumulation_seconds);
+    accumulationTimeframesSeconds.insert(accumulationTimeframesSeconds.end(),
+                                         config.websocket_higher_timeframes_seconds.begin(),
+                                         config.websocket_higher_timeframes_seconds.end());
+    return accumulationTimeframesSeconds;
+}
+
+// Explicit channels only: a wildcard would stream every crypto pair on the exchange
+std::string PolygonCryptoClient::build_subscription_params(const std::vector<std::string>& symbols) const {
+    std::string subscriptionParamsString;
+    for (const std::string& symbolString : symbols) {
+        if (!subscriptionParamsString.empty()) {
+            subscriptionParamsString += ",";
+        }
+        subscriptionParamsString += "XAS." + convert_symbol_for_websocket(symbolString);
+    }
+    return subscriptionParamsString;
+}
+
 void PolygonCryptoClient::stop_realtime_feed() {
-    std::lock_guard<std::mutex> dataGuard(data_mutex);
-    
-    try {
+    std::lock_guard<std::mutex> feedGuard(feed_mutex);
+    stop_feed_connection();
+}
+
+void PolygonCryptoClient::stop_feed_connection() {
     websocket_active = false;
     
-        if (websocketClientPointer) {
-            websocketClientPointer->stopReceiveLoop();
-            websocketClientPointer->disconnect();
-            websocketClientPointer.reset();
-    }
-        
-        barAccumulatorMap.clear();
-    } catch (const std::exception& stopFeedExceptionError) {
-        barAccumulatorMap.clear();
-        websocketClientPointer.reset();
-        websocket_active = false;
-    } catch (...) {
-        barAccumulatorMap.clear();
-        websocketClientPointer.reset();
-        websocket_active = false;
+    // Stopping unregisters from the reactor, which waits out a dispatch that may be waiting on data_mutex
+    std::unique_ptr<Polygon::WebSocketClient> stoppingClientPointer = std::move(websocketClientPointer);
+    if (stoppingClientPointer) {
+        try {
+            stoppingClientPointer->stopReceiveLoop();
+            stoppingClientPointer->disconnect();
+        } catch (...) {
+            // Client is discarded either way
+        }
+        stoppingClientPointer.reset();
     }
+    
+    std::lock_guard<std::mutex> dataGuard(data_mutex);
+    barAccumulatorMap.clear();
 }
 
 bool PolygonCryptoClient::process_websocket_message(const std::string& message) {
@@ -519,6 +571,83 @@ bool PolygonCryptoClient::process_websocket_message(const std::string& message)
             return false;
         }
         
+        // Fast path: aggregates and status events are read straight from the payload,
+        // only unknown event types are handed to the JSON DOM
+        Polygon::PolygonStreamParser streamParser(message.data(), message.size());
+        Polygon::PolygonStreamMessage streamMessage;
+        bool anyMessageParsed = false;
+        bool allStreamedProcessed = true;
+        
+        while (streamParser.nextMessage(streamMessage)) {
+            anyMessageParsed = true;
+            
+            if (streamMessage.eventType == Polygon::PolygonStreamEventType::STATUS) {
+                continue;
+            }
+            
+            if (streamMessage.eventType == Polygon::PolygonStreamEventType::AGGREGATE) {
+                if (streamMessage.pairLengthValue == 0) {
+                    allStreamedProcessed = false;
+                    continue;
+                }
+                
+                Core::Bar incomingBarData;
+                incomingBarData.open_price = streamMessage.openPriceValue;
+                incomingBarData.high_price = streamMessage.highPriceValue;
+                incomingBarData.low_price = streamMessage.lowPriceValue;
+                incomingBarData.close_price = streamMessage.closePriceValue;
+                incomingBarData.volume = streamMessage.volumeValue;
+                
+                std::string pairString(streamMessage.pairCharacters, streamMessage.pairLengthValue);
+                if (!process_aggregate_bar(pairString, incomingBarData, streamMessage.startTimestampValue)) {
+                    allStreamedProcessed = false;
+                }
+                continue;
+            }
+            
+            try {
+                json other_event_json = json::parse(streamMessage.objectStartPointer, streamMessage.objectStartPointer + streamMessage.objectLengthValue);
+                if (!process_single_message(other_event_json)) {
+                    allStreamedProcessed = false;
+                }
+            } catch (const json::parse_error& parseError) {
+                try {
+                    AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details("PARSE_ERROR", 
+                        "Failed to parse JSON: " + std::string(parseError.what()) + ", Message: " + message.substr(0, 200),
+                        "trading_system.log");
+                } catch (...) {
+                    // Logging failed, continue
+                }
+                allStreamedProcessed = false;
+            }
+        }
+        
+        if (!streamParser.hasParseError()) {
+            if (!anyMessageParsed) {
+                try {
+                    AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details("UNKNOWN_FORMAT", 
+                        "Message contains no event objects: " + message.substr(0, 200),
+                        "trading_system.log");
+                } catch (...) {
+                    // Logging failed, continue
+                }
+                return false;
+            }
+            return allStreamedProcessed;
+        }
+        
+        if (anyMessageParsed) {
+            // Events before the malformed part were already applied, re-parsing would duplicate them
+            try {
+                AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details("PARSE_ERROR", 
+                    "Malformed payload after partial processing, Message: " + message.substr(0, 200),
+                    "trading_system.log");
+            } catch (...) {
+                // Logging failed, continue
+            }
+            return false;
+        }
+        
         json msg_json;
         try {
             msg_json = json::parse(message);
@@ -578,6 +707,158 @@ bool PolygonCryptoClient::process_websocket_message(const std::string& message)
     }
 }
 
+void PolygonCryptoClient::flush_elapsed_bar_windows() {
+    try {
+        int64_t currentTimeNanosValue = TimeUtils::get_current_epoch_nanoseconds();
+        std::lock_guard<std::mutex> lock(data_mutex);
+        
+        for (auto& accumulatorEntry : barAccumulatorMap) {
+            if (!accumulatorEntry.second) {
+                continue;
+            }
+            accumulatorEntry.second->flushElapsedWindows(currentTimeNanosValue);
+            
+            Core::Bar latestAccumulatedBar;
+            if (accumulatorEntry.second->getLatestBar(latestAccumulatedBar)) {
+                latest_bars[accumulatorEntry.first] = latestAccumulatedBar;
+            }
+        }
+    } catch (const std::exception& flushExceptionError) {
+        try {
+            AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
+                "BAR_FLUSH_ERROR",
+                "Failed to flush elapsed bar windows: " + std::string(flushExceptionError.what()),
+                "trading_system.log"
+            );
+        } catch (...) {
+            // Logging failed, continue
+        }
+    } catch (...) {
+        // Flush failures must not stop the reactor
+    }
+}
+
+bool PolygonCryptoClient::process_aggregate_bar(const std::string& pair, Core::Bar& incomingBarData, long long startTimestampValue) {
+    // Convert BTC-USD format to BTC/USD for internal use
+    std::string internal_symbol = pair;
+    size_t dash_pos = internal_symbol.find('-');
+    if (dash_pos != std::string::npos) {
+        internal_symbol.replace(dash_pos, 1, "/");
+    }
+    
+    if (startTimestampValue <= 0) {
+        try {
+            AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details("INVALID_TIMESTAMP", 
+                "Received invalid timestamp (<= 0): " + std::to_string(startTimestampValue) + " for symbol " + internal_symbol + ". Skipping bar.",
+                "trading_system.log");
+        } catch (...) {
+            // Logging failed, continue
+        }
+        return false;
+    }
+    
+    incomingBarData.timestamp_ns = TimeUtils::milliseconds_to_epoch_nanoseconds(startTimestampValue);
+    
+    try {
+        std::lock_guard<std::mutex> lock(data_mutex);
+        
+        auto accumulatorIterator = barAccumulatorMap.find(internal_symbol);
+        if (accumulatorIterator != barAccumulatorMap.end() && accumulatorIterator->second) {
+            try {
+                accumulatorIterator->second->addBar(incomingBarData);
+                
+               
+                
+                try {
+                    Core::Bar latestAccumulatedBar;
+                    if (accumulatorIterator->second->getLatestBar(latestAccumulatedBar)) {
+                        latest_bars[internal_symbol] = latestAccumulatedBar;
+                    } else {
+                        latest_bars[internal_symbol] = incomingBarData;
+                    }
+                } catch (const std::exception& getBarsExceptionError) {
+                    try {
+                        AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
+                            "GET_BARS_ERROR",
+                            "Failed to get latest accumulated bar: " + std::string(getBarsExceptionError.what()),
+                            "trading_system.log"
+                        );
+                    } catch (...) {
+                        // Logging failed, continue
+                    }
+                    latest_bars[internal_symbol] = incomingBarData;
+                } catch (...) {
+                    latest_bars[internal_symbol] = incomingBarData;
+                }
+            } catch (const std::exception& accumulatorExceptionError) {
+                try {
+                    AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
+                        "ACCUMULATOR_ERROR",
+                        "Failed to process accumulator: " + std::string(accumulatorExceptionError.what()),
+                        "trading_system.log"
+                    );
+                } catch (...) {
+                    // Logging failed, continue
+                }
+                latest_bars[internal_symbol] = incomingBarData;
+            } catch (...) {
+                latest_bars[internal_symbol] = incomingBarData;
+            }
+        } else {
+            latest_bars[internal_symbol] = incomingBarData;
+            try {
+                AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
+                    "NO_ACCUMULATOR",
+                    "No accumulator found for symbol: " + internal_symbol + ", using incoming bar directly",
+                    "trading_system.log"
+                );
+            } catch (...) {
+                // Logging failed, continue
+            }
+        }
+        
+        try {
+            latest_prices[internal_symbol] = incomingBarData.close_price;
+        } catch (const std::exception& priceUpdateExceptionError) {
+            try {
+                AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
+                    "PRICE_UPDATE_ERROR",
+                    "Failed to update price: " + std::string(priceUpdateExceptionError.what()),
+                    "trading_system.log"
+                );
+            } catch (...) {
+                // Logging failed, continue
+            }
+        } catch (...) {
+            // Price update failed, continue
+        }
+        
+        return true;
+    } catch (const std::exception& lockExceptionError) {
+        try {
+            AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
+                "LOCK_ERROR",
+                "Failed to acquire lock or process bar data: " + std::string(lockExceptionError.what()),
+                "trading_system.log"
+            );
+        } catch (...) {
+            // Logging failed, continue
+        }
+        return false;
+    } catch (...) {
+        try {
+            AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
+                "UNKNOWN_LOCK_ERROR",
+                "Unknown error processing bar data",
+                "trading_system.log"
+            );
+        } catch (...) {
+            // Logging failed, continue
+        }
+        return false;
+    }
+}
+
 bool PolygonCryptoClient::process_single_message(const json& msg_json) {
     try {
         if (!msg_json.is_object()) {
@@ -593,13 +874,6 @@ bool PolygonCryptoClient::process_single_message(const json& msg_json) {
         if (eventTypeString == "XAS") {
             std::string pair = msg_json.value("pair", "");
             if (!pair.empty()) {
-                // Convert BTC-USD format to BTC/USD for internal use
-                std::string internal_symbol = pair;
-                size_t dash_pos = internal_symbol.find('-');
-                if (dash_pos != std::string::npos) {
-                    internal_symbol.replace(dash_pos, 1, "/");
-                }
-                
                 Core::Bar incomingBarData;
                 incomingBarData.open_price = msg_json.value("o", 0.0);
                 incomingBarData.high_price = msg_json.value("h", 0.0);
@@ -607,119 +881,7 @@ bool PolygonCryptoClient::process_single_message(const json& msg_json) {
                 incomingBarData.close_price = msg_json.value("c", 0.0);
                 incomingBarData.volume = msg_json.value("v", 0.0);
                 
-                long long startTimestampValue = msg_json.value("s", 0LL);
-                
-                if (startTimestampValue <= 0) {
-                    try {
-                        AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details("INVALID_TIMESTAMP", 
-                            "Received invalid timestamp (<= 0): " + std::to_string(startTimestampValue) + " for symbol " + internal_symbol + ". Skipping bar.",
-                            "trading_system.log");
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                    return false;
-                }
-                
-                incomingBarData.timestamp = std::to_string(startTimestampValue);
-                
-                try {
-                    std::lock_guard<std::mutex> lock(data_mutex);
-                    
-                    auto accumulatorIterator = barAccumulatorMap.find(internal_symbol);
-                    if (accumulatorIterator != barAccumulatorMap.end() && accumulatorIterator->second) {
-                        try {
-                            accumulatorIterator->second->addBar(incomingBarData);
-                            
-                           
-                            
-                            try {
-                                std::vector<Core::Bar> recentAccumulatedBars = accumulatorIterator->second->getAccumulatedBars(1);
-                                if (!recentAccumulatedBars.empty()) {
-                                    latest_bars[internal_symbol] = recentAccumulatedBars.back();
-                                } else {
-                                    latest_bars[internal_symbol] = incomingBarData;
-                                }
-                            } catch (const std::exception& getBarsExceptionError) {
-                                try {
-                                    AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
-                                        "GET_BARS_ERROR",
-                                        "Failed to get accumulated bars: " + std::string(getBarsExceptionError.what()),
-                                        "trading_system.log"
-                                    );
-                                } catch (...) {
-                                    // Logging failed, continue
-                                }
-                                latest_bars[internal_symbol] = incomingBarData;
-                            } catch (...) {
-                                latest_bars[internal_symbol] = incomingBarData;
-                            }
-                        } catch (const std::exception& accumulatorExceptionError) {
-                            try {
-                                AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
-                                    "ACCUMULATOR_ERROR",
-                                    "Failed to process accumulator: " + std::string(accumulatorExceptionError.what()),
-                                    "trading_system.log"
-                                );
-                            } catch (...) {
-                                // Logging failed, continue
-                            }
-                            latest_bars[internal_symbol] = incomingBarData;
-                        } catch (...) {
-                            latest_bars[internal_symbol] = incomingBarData;
-                        }
-                    } else {
-                        latest_bars[internal_symbol] = incomingBarData;
-                        try {
-                            AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
-                                "NO_ACCUMULATOR",
-                                "No accumulator found for symbol: " + internal_symbol + ", using incoming bar directly",
-                                "trading_system.log"
-                            );
-                        } catch (...) {
-                            // Logging failed, continue
-                        }
-                    }
-                    
-                    try {
-                        latest_prices[internal_symbol] = incomingBarData.close_price;
-                    } catch (const std::exception& priceUpdateExceptionError) {
-                        try {
-                            AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
-                                "PRICE_UPDATE_ERROR",
-                                "Failed to update price: " + std::string(priceUpdateExceptionError.what()),
-                                "trading_system.log"
-                            );
-                        } catch (...) {
-                            // Logging failed, continue
-                        }
-                    } catch (...) {
-                        // Price update failed, continue
-                    }
-                    
-                    return true;
-                } catch (const std::exception& lockExceptionError) {
-                    try {
-                        AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
-                            "LOCK_ERROR",
-                            "Failed to acquire lock or process bar data: " + std::string(lockExceptionError.what()),
-                            "trading_system.log"
-                        );
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                    return false;
-                } catch (...) {
-                    try {
-                        AlpacaTrader::Logging::WebSocketLogs::log_websocket_message_details(
-                            "UNKNOWN_LOCK_ERROR",
-                            "Unknown error processing bar data",
-                            "trading_system.log"
-                        );
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                    return false;
-                }
+                return process_aggregate_bar(pair, incomingBarData, msg_json.value("s", 0LL));
             }
         }
         
@@ -733,7 +895,7 @@ bool PolygonCryptoClient::process_single_message(const json& msg_json) {
                 quote.bid_price = msg_json.value("bp", 0.0);
                 quote.ask_size = msg_json.value("as", 0.0);
                 quote.bid_size = msg_json.value("bs", 0.0);
-                quote.timestamp = std::to_string(msg_json.value("t", 0LL));
+                quote.timestamp_ns = TimeUtils::milliseconds_to_epoch_nanoseconds(msg_json.value("t", 0LL));
                 quote.mid_price = (quote.ask_price + quote.bid_price) / 2.0;
                 
                     try {
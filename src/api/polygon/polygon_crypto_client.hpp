@@ -7,7 +7,9 @@
 #include "utils/http_utils.hpp"
 #include "utils/connectivity_manager.hpp"
 #include "api/polygon/websocket_client.hpp"
+#include "api/polygon/websocket_reactor.hpp"
 #include "api/polygon/bar_accumulator.hpp"
+#include "api/polygon/polygon_stream_parser.hpp"
 #include "json/json.hpp"
 #include <string>
 #include <vector>
@@ -31,6 +33,9 @@ private:
     std::atomic<bool> websocket_active{false};
     ConnectivityManager& connectivity_manager;
     
+    std::shared_ptr<Polygon::WebSocketReactor> websocketReactorPointer;
+    // Guards websocketClientPointer and serializes feed start/stop; taken before data_mutex, never inside it
+    std::mutex feed_mutex;
     std::unique_ptr<Polygon::WebSocketClient> websocketClientPointer;
     mutable std::mutex data_mutex;
     std::condition_variable data_condition;
@@ -38,17 +43,19 @@ private:
     mutable std::unordered_map<std::string, Core::QuoteData> latest_quotes;
     mutable std::unordered_map<std::string, double> latest_prices;
     mutable std::unordered_map<std::string, Core::Bar> latest_bars;
-    mutable std::unordered_map<std::string, std::unique_ptr<Polygon::BarAccumulator>> barAccumulatorMap;
+    mutable std::unordered_map<std::string, std::shared_ptr<Polygon::BarAccumulator>> barAccumulatorMap;
     
     std::vector<std::string> subscribed_symbols;
     
     mutable std::chrono::steady_clock::time_point lastStaleDataLogTime;
-    mutable std::string lastStaleDataTimestamp;
+    mutable int64_t lastStaleDataTimestampNs;
     mutable std::unordered_map<std::string, std::vector<Core::Bar>> lastLoggedBarsMap;
     mutable std::chrono::steady_clock::time_point lastBarsLogTime;
     
     bool process_websocket_message(const std::string& message);
     bool process_single_message(const json& msg_json);
+    bool process_aggregate_bar(const std::string& pair, Core::Bar& incomingBarData, long long startTimestampValue);
+    void flush_elapsed_bar_windows();
     std::string convert_symbol_for_websocket(const std::string& symbol) const;  
     std::string build_rest_url(const std::string& endpoint, const std::string& symbol) const;
     std::string make_authenticated_request(const std::string& url) const;
@@ -56,6 +63,10 @@ private:
     
     bool validate_config() const;
     void cleanup_resources();
+    // Caller holds feed_mutex and not data_mutex
+    void stop_feed_connection();
+    std::vector<int> accumulation_timeframes_seconds() const;
+    std::string build_subscription_params(const std::vector<std::string>& symbols) const;
 
 public:
     explicit PolygonCryptoClient(ConnectivityManager& connectivity_mgr);
@@ -65,7 +76,7 @@ public:
     bool is_connected() const override;
     void disconnect() override;
     
-    std::vector<Core::Bar> get_recent_bars(const Core::BarRequest& request) const override;
+    Core::BarsResult get_recent_bars(const Core::BarRequest& request) const override;
     double get_current_price(const std::string& symbol) const override;
     Core::QuoteData get_realtime_quotes(const std::string& symbol) const override;
     
@@ -0,0 +1,330 @@
+#include "polygon_stream_parser.hpp"
+#include <cstdlib>
+#include <cstring>
+
+namespace AlpacaTrader {
+namespace API {
+namespace Polygon {
+
+namespace {
+
+const size_t maximumNumberLengthValue = 63;
+const int maximumSkipDepthValue = 64;
+
+const char* skipWhitespace(const char* cursorPointer, const char* endPointer) {
+    while (cursorPointer < endPointer && (*cursorPointer == ' ' || *cursorPointer == '\n' || *cursorPointer == '\r' || *cursorPointer == '\t')) {
+        ++cursorPointer;
+    }
+    return cursorPointer;
+}
+
+// Reads a string token; the returned range is the raw content between the quotes
+bool readStringToken(const char*& cursorPointer, const char* endPointer, const char*& contentStartPointer, size_t& contentLengthValue, bool& hasEscapesFlag) {
+    if (cursorPointer >= endPointer || *cursorPointer != '"') {
+        return false;
+    }
+    ++cursorPointer;
+    contentStartPointer = cursorPointer;
+    hasEscapesFlag = false;
+
+    while (cursorPointer < endPointer) {
+        if (*cursorPointer == '\\') {
+            hasEscapesFlag = true;
+            cursorPointer += 2;
+            continue;
+        }
+        if (*cursorPointer == '"') {
+            contentLengthValue = static_cast<size_t>(cursorPointer - contentStartPointer);
+            ++cursorPointer;
+            return true;
+        }
+        ++cursorPointer;
+    }
+    return false;
+}
+
+bool readNumberToken(const char*& cursorPointer, const char* endPointer, char* numberBuffer, bool& isIntegerFlag) {
+    size_t numberLengthValue = 0;
+    isIntegerFlag = true;
+
+    while (cursorPointer < endPointer && numberLengthValue < maximumNumberLengthValue) {
+        char currentCharacter = *cursorPointer;
+        if ((currentCharacter >= '0' && currentCharacter <= '9') || currentCharacter == '-' || currentCharacter == '+') {
+            numberBuffer[numberLengthValue++] = currentCharacter;
+        } else if (currentCharacter == '.' || currentCharacter == 'e' || currentCharacter == 'E') {
+            numberBuffer[numberLengthValue++] = currentCharacter;
+            isIntegerFlag = false;
+        } else {
+            break;
+        }
+        ++cursorPointer;
+    }
+
+    numberBuffer[numberLengthValue] = '\0';
+    return numberLengthValue > 0;
+}
+
+bool readDoubleValue(const char*& cursorPointer, const char* endPointer, double& numberValue) {
+    char numberBuffer[maximumNumberLengthValue + 1];
+    bool isIntegerFlag = false;
+    if (!readNumberToken(cursorPointer, endPointer, numberBuffer, isIntegerFlag)) {
+        return false;
+    }
+    numberValue = std::strtod(numberBuffer, nullptr);
+    return true;
+}
+
+bool readIntegerValue(const char*& cursorPointer, const char* endPointer, long long& numberValue) {
+    char numberBuffer[maximumNumberLengthValue + 1];
+    bool isIntegerFlag = false;
+    if (!readNumberToken(cursorPointer, endPointer, numberBuffer, isIntegerFlag)) {
+        return false;
+    }
+    numberValue = isIntegerFlag ? std::strtoll(numberBuffer, nullptr, 10) : static_cast<long long>(std::strtod(numberBuffer, nullptr));
+    return true;
+}
+
+// Skips any JSON value including nested containers
+bool skipValue(const char*& cursorPointer, const char* endPointer) {
+    cursorPointer = skipWhitespace(cursorPointer, endPointer);
+    if (cursorPointer >= endPointer) {
+        return false;
+    }
+
+    char leadingCharacter = *cursorPointer;
+
+    if (leadingCharacter == '"') {
+        const char* contentStartPointer = nullptr;
+        size_t contentLengthValue = 0;
+        bool hasEscapesFlag = false;
+        return readStringToken(cursorPointer, endPointer, contentStartPointer, contentLengthValue, hasEscapesFlag);
+    }
+
+    if (leadingCharacter == '{' || leadingCharacter == '[') {
+        int nestingDepthValue = 0;
+        while (cursorPointer < endPointer) {
+            char currentCharacter = *cursorPointer;
+            if (currentCharacter == '"') {
+                const char* contentStartPointer = nullptr;
+                size_t contentLengthValue = 0;
+                bool hasEscapesFlag = false;
+                if (!readStringToken(cursorPointer, endPointer, contentStartPointer, contentLengthValue, hasEscapesFlag)) {
+                    return false;
+                }
+                continue;
+            }
+            if (currentCharacter == '{' || currentCharacter == '[') {
+                if (++nestingDepthValue > maximumSkipDepthValue) {
+                    return false;
+                }
+            } else if (currentCharacter == '}' || currentCharacter == ']') {
+                if (--nestingDepthValue == 0) {
+                    ++cursorPointer;
+                    return true;
+                }
+            }
+            ++cursorPointer;
+        }
+        return false;
+    }
+
+    // Numbers and literals run until the next structural character
+    const char* literalStartPointer = cursorPointer;
+    while (cursorPointer < endPointer && *cursorPointer != ',' && *cursorPointer != '}' && *cursorPointer != ']' &&
+           *cursorPointer != ' ' && *cursorPointer != '\n' && *cursorPointer != '\r' && *cursorPointer != '\t') {
+        ++cursorPointer;
+    }
+    return cursorPointer > literalStartPointer;
+}
+
+bool keyEquals(const char* keyStartPointer, size_t keyLengthValue, const char* expectedKeyString) {
+    size_t expectedLengthValue = std::strlen(expectedKeyString);
+    return keyLengthValue == expectedLengthValue && std::memcmp(keyStartPointer, expectedKeyString, keyLengthValue) == 0;
+}
+
+} // namespace
+
+PolygonStreamParser::PolygonStreamParser(const char* payloadPointer, size_t payloadLengthValue)
+    : cursorPointer(payloadPointer)
+    , payloadEndPointer(payloadPointer + payloadLengthValue)
+    , insideArrayFlag(false)
+    , finishedFlag(false)
+    , parseErrorFlag(false)
+{
+    cursorPointer = skipWhitespace(cursorPointer, payloadEndPointer);
+    if (cursorPointer < payloadEndPointer && *cursorPointer == '[') {
+        insideArrayFlag = true;
+        ++cursorPointer;
+    } else if (cursorPointer >= payloadEndPointer || *cursorPointer != '{') {
+        finishedFlag = true;
+        parseErrorFlag = true;
+    }
+}
+
+bool PolygonStreamParser::hasParseError() const {
+    return parseErrorFlag;
+}
+
+bool PolygonStreamParser::failParse() {
+    parseErrorFlag = true;
+    finishedFlag = true;
+    return false;
+}
+
+bool PolygonStreamParser::nextMessage(PolygonStreamMessage& streamMessage) {
+    while (!finishedFlag) {
+        cursorPointer = skipWhitespace(cursorPointer, payloadEndPointer);
+
+        if (!insideArrayFlag) {
+            // Single object payload yields exactly one message
+            finishedFlag = true;
+            return parseObject(streamMessage);
+        }
+
+        if (cursorPointer >= payloadEndPointer) {
+            return failParse();
+        }
+
+        char currentCharacter = *cursorPointer;
+        if (currentCharacter == ']') {
+            finishedFlag = true;
+            return false;
+        }
+        if (currentCharacter == ',') {
+            ++cursorPointer;
+            continue;
+        }
+        if (currentCharacter == '{') {
+            return parseObject(streamMessage);
+        }
+
+        // Non-object array elements are ignored like in the generic path
+        if (!skipValue(cursorPointer, payloadEndPointer)) {
+            return failParse();
+        }
+    }
+    return false;
+}
+
+bool PolygonStreamParser::parseObject(PolygonStreamMessage& streamMessage) {
+    streamMessage.eventType = PolygonStreamEventType::OTHER;
+    streamMessage.objectStartPointer = cursorPointer;
+    streamMessage.objectLengthValue = 0;
+    streamMessage.pairLengthValue = 0;
+    streamMessage.pairCharacters[0] = '\0';
+    streamMessage.openPriceValue = 0.0;
+    streamMessage.highPriceValue = 0.0;
+    streamMessage.lowPriceValue = 0.0;
+    streamMessage.closePriceValue = 0.0;
+    streamMessage.volumeValue = 0.0;
+    streamMessage.startTimestampValue = 0;
+
+    if (cursorPointer >= payloadEndPointer || *cursorPointer != '{') {
+        return failParse();
+    }
+    ++cursorPointer;
+
+    const char* eventStartPointer = nullptr;
+    size_t eventLengthValue = 0;
+    bool requiresGenericParseFlag = false;
+
+    while (true) {
+        cursorPointer = skipWhitespace(cursorPointer, payloadEndPointer);
+        if (cursorPointer >= payloadEndPointer) {
+            return failParse();
+        }
+        if (*cursorPointer == '}') {
+            ++cursorPointer;
+            break;
+        }
+        if (*cursorPointer == ',') {
+            ++cursorPointer;
+            continue;
+        }
+
+        const char* keyStartPointer = nullptr;
+        size_t keyLengthValue = 0;
+        bool keyHasEscapesFlag = false;
+        if (!readStringToken(cursorPointer, payloadEndPointer, keyStartPointer, keyLengthValue, keyHasEscapesFlag)) {
+            return failParse();
+        }
+
+        cursorPointer = skipWhitespace(cursorPointer, payloadEndPointer);
+        if (cursorPointer >= payloadEndPointer || *cursorPointer != ':') {
+            return failParse();
+        }
+        cursorPointer = skipWhitespace(cursorPointer + 1, payloadEndPointer);
+        if (cursorPointer >= payloadEndPointer) {
+            return failParse();
+        }
+
+        bool valueIsStringFlag = *cursorPointer == '"';
+        bool valueIsNumberFlag = (*cursorPointer >= '0' && *cursorPointer <= '9') || *cursorPointer == '-';
+        bool valueConsumedFlag = false;
+
+        if (keyLengthValue == 1 && valueIsNumberFlag) {
+            double* numericTargetPointer = nullptr;
+            switch (keyStartPointer[0]) {
+                case 'o': numericTargetPointer = &streamMessage.openPriceValue; break;
+                case 'h': numericTargetPointer = &streamMessage.highPriceValue; break;
+                case 'l': numericTargetPointer = &streamMessage.lowPriceValue; break;
+                case 'c': numericTargetPointer = &streamMessage.closePriceValue; break;
+                case 'v': numericTargetPointer = &streamMessage.volumeValue; break;
+                default: break;
+            }
+            if (numericTargetPointer) {
+                if (!readDoubleValue(cursorPointer, payloadEndPointer, *numericTargetPointer)) {
+                    return failParse();
+                }
+                valueConsumedFlag = true;
+            } else if (keyStartPointer[0] == 's') {
+                if (!readIntegerValue(cursorPointer, payloadEndPointer, streamMessage.startTimestampValue)) {
+                    return failParse();
+                }
+                valueConsumedFlag = true;
+            }
+        } else if (valueIsStringFlag && (keyEquals(keyStartPointer, keyLengthValue, "ev") || keyEquals(keyStartPointer, keyLengthValue, "pair"))) {
+            const char* valueStartPointer = nullptr;
+            size_t valueLengthValue = 0;
+            bool valueHasEscapesFlag = false;
+            if (!readStringToken(cursorPointer, payloadEndPointer, valueStartPointer, valueLengthValue, valueHasEscapesFlag)) {
+                return failParse();
+            }
+            if (valueHasEscapesFlag) {
+                requiresGenericParseFlag = true;
+            }
+
+            if (keyLengthValue == 2) {
+                eventStartPointer = valueStartPointer;
+                eventLengthValue = valueLengthValue;
+            } else if (valueLengthValue < PolygonStreamMessage::pairCapacityValue) {
+                std::memcpy(streamMessage.pairCharacters, valueStartPointer, valueLengthValue);
+                streamMessage.pairCharacters[valueLengthValue] = '\0';
+                streamMessage.pairLengthValue = valueLengthValue;
+            } else {
+                requiresGenericParseFlag = true;
+            }
+            valueConsumedFlag = true;
+        }
+
+        if (!valueConsumedFlag && !skipValue(cursorPointer, payloadEndPointer)) {
+            return failParse();
+        }
+    }
+
+    streamMessage.objectLengthValue = static_cast<size_t>(cursorPointer - streamMessage.objectStartPointer);
+
+    if (!requiresGenericParseFlag && eventStartPointer) {
+        if (keyEquals(eventStartPointer, eventLengthValue, "XAS")) {
+            streamMessage.eventType = PolygonStreamEventType::AGGREGATE;
+        } else if (keyEquals(eventStartPointer, eventLengthValue, "status")) {
+            streamMessage.eventType = PolygonStreamEventType::STATUS;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Polygon
+} // namespace API
+} // namespace AlpacaTrader
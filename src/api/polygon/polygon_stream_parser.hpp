@@ -0,0 +1,60 @@
+#ifndef POLYGON_STREAM_PARSER_HPP
+#define POLYGON_STREAM_PARSER_HPP
+
+#include <cstddef>
+
+namespace AlpacaTrader {
+namespace API {
+namespace Polygon {
+
+enum class PolygonStreamEventType {
+    STATUS,
+    AGGREGATE,
+    OTHER
+};
+
+// Fields of one websocket event, read straight from the payload bytes.
+// OTHER events keep the raw object range so callers can hand it to the generic JSON path.
+struct PolygonStreamMessage {
+    static const size_t pairCapacityValue = 32;
+
+    PolygonStreamEventType eventType;
+    const char* objectStartPointer;
+    size_t objectLengthValue;
+
+    char pairCharacters[pairCapacityValue];
+    size_t pairLengthValue;
+
+    double openPriceValue;
+    double highPriceValue;
+    double lowPriceValue;
+    double closePriceValue;
+    double volumeValue;
+    long long startTimestampValue;
+};
+
+// Single-pass, allocation-free reader for Polygon XAS/status payloads.
+// Accepts either one JSON object or an array of objects and yields them one at a time.
+class PolygonStreamParser {
+public:
+    PolygonStreamParser(const char* payloadPointer, size_t payloadLengthValue);
+
+    bool nextMessage(PolygonStreamMessage& streamMessage);
+    bool hasParseError() const;
+
+private:
+    const char* cursorPointer;
+    const char* payloadEndPointer;
+    bool insideArrayFlag;
+    bool finishedFlag;
+    bool parseErrorFlag;
+
+    bool parseObject(PolygonStreamMessage& streamMessage);
+    bool failParse();
+};
+
+} // namespace Polygon
+} // namespace API
+} // namespace AlpacaTrader
+
+#endif // POLYGON_STREAM_PARSER_HPP
@@ -1,4 +1,5 @@
 #include "websocket_client.hpp"
+#include "websocket_reactor.hpp"
 #include "logging/logs/websocket_logs.hpp"
 #include "logging/logger/async_logger.hpp"
 #include "json/json.hpp"
@@ -8,7 +9,7 @@
 #include <netdb.h>
 #include <unistd.h>
 #include <fcntl.h>
-#include <sys/select.h>
+#include <poll.h>
 #include <openssl/ssl.h>
 #include <openssl/err.h>
 #include <openssl/sha.h>
@@ -28,13 +29,62 @@ namespace AlpacaTrader {
 namespace API {
 namespace Polygon {
 
+namespace {
+const size_t receiveChunkSizeBytes = 64 * 1024;
+const unsigned long long maximumFramePayloadBytes = 64ULL * 1024 * 1024;
+const std::chrono::milliseconds reconnectInitialDelay(200);
+const std::chrono::milliseconds reconnectFailureDelay(10000);
+const std::chrono::milliseconds subscriptionAfterAuthenticationDelay(500);
+const std::chrono::milliseconds connectionSetupTimeout(10000);
+const std::chrono::milliseconds blockingSendTimeout(5000);
+const size_t maximumUpgradeResponseBytes = 4096;
+
+std::string describeSslError(const std::string& prefixString, int sslErrorCode) {
+    unsigned long opensslErrorCode = ERR_get_error();
+    if (opensslErrorCode != 0) {
+        char errorBuffer[512];
+        ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
+        return prefixString + ": " + errorBuffer + " (SSL_get_error: " + std::to_string(sslErrorCode) + ")";
+    }
+    return prefixString + ": SSL_get_error=" + std::to_string(sslErrorCode);
+}
+} // namespace
+
+struct WebSocketClient::AddressResolution {
+    std::atomic<bool> completeFlag{false};
+    int resultCode = 0;
+    struct addrinfo* addressListPointer = nullptr;
+    
+    ~AddressResolution() {
+        if (addressListPointer) {
+            freeaddrinfo(addressListPointer);
+        }
+    }
+};
+
 WebSocketClient::WebSocketClient()
-    : parentLoggingContextPointer(nullptr)
+    : periodicTimerIntervalDuration(0)
     , connectedFlag(false)
     , shouldReceiveLoopContinue(false)
+    , connectionGenerationValue(0)
+    , subscriptionRequestedFlag(false)
     , socketFileDescriptor(-1)
     , sslContextPointer(nullptr)
     , sslConnectionPointer(nullptr)
+    , receiveBufferBytes(receiveChunkSizeBytes)
+    , receiveBufferReadOffsetValue(0)
+    , receiveBufferWriteOffsetValue(0)
+    , receiveWantsWriteFlag(false)
+    , pendingSendOffsetValue(0)
+    , sendPendingFlag(false)
+    , sendWaitsForReadFlag(false)
+    , connectionSetupPhase(ConnectionSetupPhase::IDLE)
+    , connectionSetupWantsWriteFlag(false)
+    , nextResolvedAddressPointer(nullptr)
+    , upgradeRequestBytesSentValue(0)
+    , reconnectScheduledFlag(false)
+    , reconnectSetupInProgressFlag(false)
+    , subscriptionPendingFlag(false)
 {
     std::lock_guard<std::mutex> stateGuard(clientStateMutex);
     lastErrorStringValue.clear();
@@ -54,42 +104,27 @@ bool WebSocketClient::connect(const std::string& websocketUrlString) {
     std::lock_guard<std::mutex> stateGuard(clientStateMutex);
     
     try {
-        // Always cleanup any existing connection before creating new one
-        // This prevents connection limit issues from accumulating connections
-        if (connectedFlag.load() || socketFileDescriptor >= 0 || sslConnectionPointer || sslContextPointer) {
-            try {
-                cleanupConnection();
-            } catch (...) {
-                // Ignore cleanup errors, continue with new connection
-            }
-            connectedFlag.store(false);
-        }
-        
-        if (!validateUrl(websocketUrlString)) {
-            lastErrorStringValue = "Invalid WebSocket URL format";
-            return false;
-        }
-        
-        websocketUrlStringValue = websocketUrlString;
-        
-        if (!establishTcpConnection()) {
+        if (!beginConnectionSetup(websocketUrlString, false)) {
+            cleanupConnection();
             WebSocketLogs::log_websocket_connection_table(websocketUrlString, false, lastErrorStringValue, "trading_system.log");
             return false;
         }
         
-        if (!performSslHandshake()) {
-            cleanupConnection();
-            WebSocketLogs::log_websocket_connection_table(websocketUrlString, false, lastErrorStringValue, "trading_system.log");
-            return false;
+        ConnectionSetupStepResult setupResult = advanceConnectionSetup();
+        while (setupResult == ConnectionSetupStepResult::WAITING) {
+            if (!waitForConnectionSetupReadiness()) {
+                setupResult = ConnectionSetupStepResult::FAILED;
+                break;
+            }
+            setupResult = advanceConnectionSetup();
         }
         
-        if (!performWebSocketHandshake()) {
+        if (setupResult != ConnectionSetupStepResult::COMPLETE) {
             cleanupConnection();
             WebSocketLogs::log_websocket_connection_table(websocketUrlString, false, lastErrorStringValue, "trading_system.log");
             return false;
         }
         
-        connectedFlag.store(true);
         return true;
         
     } catch (const std::exception& connectionExceptionError) {
@@ -106,12 +141,15 @@ bool WebSocketClient::connect(const std::string& websocketUrlString) {
 }
 
 void WebSocketClient::disconnect() {
+    // Detach from the reactor before taking the state mutex, the reactor thread may be waiting on it
+    stopReceiveLoop();
+    
     std::lock_guard<std::mutex> stateGuard(clientStateMutex);
     
     try {
         // Only cleanup if not already disconnected to prevent double-free
-        if (connectedFlag.load() || socketFileDescriptor >= 0 || sslConnectionPointer || sslContextPointer) {
-            stopReceiveLoop();
+        if (connectedFlag.load() || socketFileDescriptor >= 0 || sslConnectionPointer || sslContextPointer ||
+            connectionSetupPhase != ConnectionSetupPhase::IDLE) {
             cleanupConnection();
             connectedFlag.store(false);
             try {
@@ -242,6 +280,18 @@ void WebSocketClient::setMessageCallback(MessageCallback callbackFunction) {
     messageCallbackFunction = callbackFunction;
 }
 
+void WebSocketClient::setPeriodicTimerCallback(TimerCallback callbackFunction, std::chrono::milliseconds intervalDuration) {
+    std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+    if (shouldReceiveLoopContinue.load()) {
+        throw std::runtime_error("Periodic timer callback must be set before the receive loop starts");
+    }
+    if (callbackFunction && intervalDuration.count() <= 0) {
+        throw std::runtime_error("Periodic timer interval must be greater than 0");
+    }
+    periodicTimerCallbackFunction = callbackFunction;
+    periodicTimerIntervalDuration = intervalDuration;
+}
+
 bool WebSocketClient::sendMessage(const std::string& messageContent) {
     std::lock_guard<std::mutex> stateGuard(clientStateMutex);
     return sendMessageInternal(messageContent);
@@ -285,99 +335,16 @@ bool WebSocketClient::sendMessageInternal(const std::string& messageContent) {
         }
         
         frameBuffer.insert(frameBuffer.end(), maskedPayload.begin(), maskedPayload.end());
+        pendingSendBytes.insert(pendingSendBytes.end(), frameBuffer.begin(), frameBuffer.end());
         
-        int totalBytesSent = 0;
-        size_t totalBytesToSend = frameBuffer.size();
-        int sendAttemptsCount = 0;
-        const int maxSendAttemptsValue = 10;
-        
-        while (totalBytesSent < static_cast<int>(totalBytesToSend) && sendAttemptsCount < maxSendAttemptsValue) {
-            sendAttemptsCount++;
-            
-            int bytesSent = 0;
-            if (sslConnectionPointer) {
-                SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
-                bytesSent = SSL_write(sslConnectionPointerTyped, 
-                                     frameBuffer.data() + totalBytesSent, 
-                                     static_cast<int>(totalBytesToSend - totalBytesSent));
-                
-                if (bytesSent <= 0) {
-                    int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, bytesSent);
-                    
-                    if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
-                        fd_set readFileDescriptorSet;
-                        fd_set writeFileDescriptorSet;
-                        struct timeval timeoutStruct;
-                        
-                        FD_ZERO(&readFileDescriptorSet);
-                        FD_ZERO(&writeFileDescriptorSet);
-                        
-                        if (sslErrorCode == SSL_ERROR_WANT_READ) {
-                            FD_SET(socketFileDescriptor, &readFileDescriptorSet);
-                        } else {
-                            FD_SET(socketFileDescriptor, &writeFileDescriptorSet);
-                        }
-                        
-                        timeoutStruct.tv_sec = 5;
-                        timeoutStruct.tv_usec = 0;
-                        
-                        int selectResult = select(socketFileDescriptor + 1, &readFileDescriptorSet, &writeFileDescriptorSet, nullptr, &timeoutStruct);
-                        if (selectResult <= 0) {
-                            unsigned long opensslErrorCode = ERR_get_error();
-                            char errorBuffer[512];
-                            if (opensslErrorCode != 0) {
-                                ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
-                                lastErrorStringValue = std::string("SSL write timeout/error: ") + errorBuffer + " (SSL_get_error: " + std::to_string(sslErrorCode) + ")";
-                            } else {
-                                lastErrorStringValue = "SSL write timeout: select() returned " + std::to_string(selectResult) + ", SSL_get_error=" + std::to_string(sslErrorCode);
-                            }
-                            WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
-                            return false;
-                        }
-                        continue;
-                    } else {
-                        unsigned long opensslErrorCode = ERR_get_error();
-                        char errorBuffer[512];
-                        if (opensslErrorCode != 0) {
-                            ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
-                            lastErrorStringValue = std::string("SSL write failed: ") + errorBuffer + " (SSL_get_error: " + std::to_string(sslErrorCode) + ")";
-                        } else {
-                            lastErrorStringValue = std::string("SSL write failed: SSL_get_error=") + std::to_string(sslErrorCode) + ", bytesSent=" + std::to_string(bytesSent);
-                        }
-                        WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
-                        return false;
-                    }
-                }
-            } else {
-                bytesSent = ::write(socketFileDescriptor, frameBuffer.data() + totalBytesSent, totalBytesToSend - totalBytesSent);
-                
-                if (bytesSent < 0) {
-                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                        continue;
-                    }
-                    lastErrorStringValue = std::string("write() failed: errno=") + std::to_string(errno) + " (" + strerror(errno) + ")";
-                    WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
-                    return false;
-                } else if (bytesSent == 0) {
-                    lastErrorStringValue = "write() returned 0 (connection closed?)";
-                    WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
-                    return false;
-                }
-            }
-            
-            totalBytesSent += bytesSent;
-        }
-        
-        if (totalBytesSent < static_cast<int>(totalBytesToSend)) {
-            lastErrorStringValue = "Failed to send complete WebSocket frame: sent " + std::to_string(totalBytesSent) + " / " + std::to_string(totalBytesToSend);
-            WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
-            return false;
+        // The reactor thread reads from the same SSL object, so it also does the writing
+        if (shouldReceiveLoopContinue.load() && websocketReactorPointer) {
+            sendPendingFlag.store(true);
+            websocketReactorPointer->wakeReactor();
+            return true;
         }
         
-        // SEND_MESSAGE_SUCCESS log removed to reduce log noise
-        
-        return true;
+        return flushPendingSendsBlocking();
         
     } catch (const std::exception& sendExceptionError) {
         lastErrorStringValue = std::string("Send message exception: ") + sendExceptionError.what();
@@ -390,45 +357,163 @@ bool WebSocketClient::sendMessageInternal(const std::string& messageContent) {
     }
 }
 
-void WebSocketClient::startReceiveLoop() {
-    std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+bool WebSocketClient::flushPendingSends() {
+    while (pendingSendOffsetValue < pendingSendBytes.size()) {
+        const unsigned char* sendSourcePointer = pendingSendBytes.data() + pendingSendOffsetValue;
+        size_t remainingBytesCount = pendingSendBytes.size() - pendingSendOffsetValue;
+        int bytesSent = 0;
+        
+        if (sslConnectionPointer) {
+            SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
+            bytesSent = SSL_write(sslConnectionPointerTyped, sendSourcePointer, static_cast<int>(remainingBytesCount));
+            
+            if (bytesSent <= 0) {
+                int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, bytesSent);
+                if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
+                    // Renegotiation can make a write wait on readability
+                    sendWaitsForReadFlag = (sslErrorCode == SSL_ERROR_WANT_READ);
+                    return true;
+                }
+                lastErrorStringValue = describeSslError("SSL write failed", sslErrorCode);
+                WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
+                clearPendingSends();
+                return false;
+            }
+        } else {
+            bytesSent = static_cast<int>(::write(socketFileDescriptor, sendSourcePointer, remainingBytesCount));
+            
+            if (bytesSent < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    sendWaitsForReadFlag = false;
+                    return true;
+                }
+                lastErrorStringValue = std::string("write() failed: errno=") + std::to_string(errno) + " (" + strerror(errno) + ")";
+                WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
+                clearPendingSends();
+                return false;
+            } else if (bytesSent == 0) {
+                lastErrorStringValue = "write() returned 0 (connection closed?)";
+                WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
+                clearPendingSends();
+                return false;
+            }
+        }
+        
+        pendingSendOffsetValue += static_cast<size_t>(bytesSent);
+    }
     
-    if (shouldReceiveLoopContinue.load()) {
-        try {
-            WebSocketLogs::log_websocket_receive_loop_table(
-                "RECEIVE_LOOP",
-                "Receive loop already running, skipping start",
-                "trading_system.log"
-            );
-        } catch (...) {
-            // Logging failed, continue
+    clearPendingSends();
+    return true;
+}
+
+bool WebSocketClient::flushPendingSendsBlocking() {
+    // Only used before the receive loop starts, when the caller owns the socket
+    while (true) {
+        if (!flushPendingSends()) {
+            return false;
         }
-        return;
+        if (pendingSendBytes.empty()) {
+            return true;
+        }
+        
+        struct pollfd sendPollStruct;
+        sendPollStruct.fd = socketFileDescriptor;
+        sendPollStruct.events = sendWaitsForReadFlag ? POLLIN : POLLOUT;
+        sendPollStruct.revents = 0;
+        int pollResult = ::poll(&sendPollStruct, 1, static_cast<int>(blockingSendTimeout.count()));
+        if (pollResult < 0 && errno == EINTR) {
+            continue;
+        }
+        if (pollResult <= 0) {
+            lastErrorStringValue = pollResult == 0 ? std::string("Send timed out waiting for socket readiness") : std::string("poll() failed during send: ") + strerror(errno);
+            WebSocketLogs::log_websocket_message_send_failure(lastErrorStringValue, "trading_system.log");
+            clearPendingSends();
+            return false;
+        }
+    }
+}
+
+void WebSocketClient::clearPendingSends() {
+    pendingSendBytes.clear();
+    pendingSendOffsetValue = 0;
+    sendWaitsForReadFlag = false;
+    sendPendingFlag.store(false);
+}
+
+void WebSocketClient::requestSubscription(const std::string& subscriptionParamsString) {
+    std::shared_ptr<WebSocketReactor> reactorToWake;
+    {
+        std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+        // Also what a reconnect resubscribes with
+        subscriptionParamsStringValue = subscriptionParamsString;
+        reactorToWake = websocketReactorPointer;
     }
     
-    try {
-        AlpacaTrader::Logging::LoggingContext* parentLoggingContextForThread = nullptr;
-        try {
-            parentLoggingContextForThread = AlpacaTrader::Logging::get_logging_context();
-        } catch (...) {
-            parentLoggingContextForThread = nullptr;
+    subscriptionRequestedFlag.store(true);
+    if (reactorToWake) {
+        reactorToWake->wakeReactor();
+    }
+}
+
+void WebSocketClient::setReactor(std::shared_ptr<WebSocketReactor> reactorPointer) {
+    std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+    websocketReactorPointer = reactorPointer;
+}
+
+void WebSocketClient::startReceiveLoop() {
+    std::shared_ptr<WebSocketReactor> reactorToRegisterWith;
+    {
+        std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+        
+        if (shouldReceiveLoopContinue.load()) {
+            try {
+                WebSocketLogs::log_websocket_receive_loop_table(
+                    "RECEIVE_LOOP",
+                    "Receive loop already running, skipping start",
+                    "trading_system.log"
+                );
+            } catch (...) {
+                // Logging failed, continue
+            }
+            return;
         }
         
-        parentLoggingContextPointer = parentLoggingContextForThread;
-    } catch (...) {
-        parentLoggingContextPointer = nullptr;
+        if (!websocketReactorPointer) {
+            websocketReactorPointer = std::make_shared<WebSocketReactor>();
+        }
+        reactorToRegisterWith = websocketReactorPointer;
+        
+        reconnectScheduledFlag = false;
+        reconnectSetupInProgressFlag = false;
+        subscriptionPendingFlag = false;
+        receiveWantsWriteFlag = false;
+        periodicTimerDeadlineTimePoint = std::chrono::steady_clock::now() + periodicTimerIntervalDuration;
+        shouldReceiveLoopContinue.store(true);
     }
     
-    // Receive loop startup logs removed to reduce log noise
-    shouldReceiveLoopContinue.store(true);
-    receiveLoopThread = std::thread(&WebSocketClient::receiveLoopWorker, this);
+    // Registration happens outside the state mutex to keep lock order reactor -> client
+    if (!reactorToRegisterWith->start() || !reactorToRegisterWith->registerClient(this)) {
+        shouldReceiveLoopContinue.store(false);
+        try {
+            WebSocketLogs::log_websocket_receive_error("Failed to start WebSocket reactor", "trading_system.log");
+        } catch (...) {
+            // Logging failed, continue
+        }
+    }
 }
 
 void WebSocketClient::stopReceiveLoop() {
-    shouldReceiveLoopContinue.store(false);
+    bool wasRunningFlag = shouldReceiveLoopContinue.exchange(false);
+    
+    std::shared_ptr<WebSocketReactor> reactorToUnregisterFrom;
+    {
+        std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+        reactorToUnregisterFrom = websocketReactorPointer;
+    }
     
-    if (receiveLoopThread.joinable()) {
-        receiveLoopThread.join();
+    // Blocks until the reactor is no longer dispatching into this client
+    if (reactorToUnregisterFrom) {
+        reactorToUnregisterFrom->unregisterClient(this);
     }
     
     // Don't call cleanupConnection here - let disconnect() handle it
@@ -437,6 +522,14 @@ void WebSocketClient::stopReceiveLoop() {
     // or when the destructor calls disconnect()
     std::lock_guard<std::mutex> stateGuard(clientStateMutex);
     connectedFlag.store(false);
+    
+    if (wasRunningFlag) {
+        try {
+            WebSocketLogs::log_websocket_receive_loop_table("RECEIVE_LOOP", "WebSocket receive loop stopped", "trading_system.log");
+        } catch (...) {
+            // Logging failed, continue
+        }
+    }
 }
 
 std::string WebSocketClient::getLastError() const {
@@ -444,77 +537,193 @@ std::string WebSocketClient::getLastError() const {
     return lastErrorStringValue;
 }
 
-bool WebSocketClient::establishTcpConnection() {
-    try {
-        std::string hostnameString = extractHostname(websocketUrlStringValue);
-        std::string portString = extractPort(websocketUrlStringValue);
-        
-        if (hostnameString.empty() || portString.empty()) {
-            lastErrorStringValue = "Failed to extract hostname or port from URL";
-            return false;
+bool WebSocketClient::beginConnectionSetup(const std::string& websocketUrlString, bool resolveInBackgroundFlag) {
+    // Always cleanup any existing connection before creating new one
+    // This prevents connection limit issues from accumulating connections
+    if (connectedFlag.load() || socketFileDescriptor >= 0 || sslConnectionPointer || sslContextPointer ||
+        connectionSetupPhase != ConnectionSetupPhase::IDLE) {
+        try {
+            cleanupConnection();
+        } catch (...) {
+            // Ignore cleanup errors, continue with new connection
+        }
+        connectedFlag.store(false);
+    }
+    
+    if (!validateUrl(websocketUrlString)) {
+        lastErrorStringValue = "Invalid WebSocket URL format";
+        return false;
+    }
+    
+    websocketUrlStringValue = websocketUrlString;
+    
+    std::string hostnameString = extractHostname(websocketUrlStringValue);
+    std::string portString = extractPort(websocketUrlStringValue);
+    if (hostnameString.empty() || portString.empty()) {
+        lastErrorStringValue = "Failed to extract hostname or port from URL";
+        return false;
+    }
+    
+    connectionSetupDeadlineTimePoint = std::chrono::steady_clock::now() + connectionSetupTimeout;
+    connectionSetupPhase = ConnectionSetupPhase::RESOLVING;
+    connectionSetupWantsWriteFlag = false;
+    addressResolutionPointer = std::make_shared<AddressResolution>();
+    
+    if (!resolveInBackgroundFlag) {
+        resolveAddresses(*addressResolutionPointer, hostnameString, portString);
+        return true;
+    }
+    
+    // getaddrinfo has no non-blocking form, so the lookup gets its own thread and wakes the reactor when done
+    std::shared_ptr<AddressResolution> addressResolutionToFill = addressResolutionPointer;
+    std::shared_ptr<WebSocketReactor> reactorToWake = websocketReactorPointer;
+    std::thread([addressResolutionToFill, reactorToWake, hostnameString, portString]() {
+        resolveAddresses(*addressResolutionToFill, hostnameString, portString);
+        if (reactorToWake) {
+            reactorToWake->wakeReactor();
+        }
+    }).detach();
+    return true;
+}
+
+void WebSocketClient::resolveAddresses(AddressResolution& addressResolution, const std::string& hostnameString, const std::string& portString) {
+    struct addrinfo hintsStruct;
+    std::memset(&hintsStruct, 0, sizeof(hintsStruct));
+    hintsStruct.ai_family = AF_UNSPEC;
+    hintsStruct.ai_socktype = SOCK_STREAM;
+    
+    addressResolution.resultCode = getaddrinfo(hostnameString.c_str(), portString.c_str(), &hintsStruct, &addressResolution.addressListPointer);
+    addressResolution.completeFlag.store(true, std::memory_order_release);
+}
+
+WebSocketClient::ConnectionSetupStepResult WebSocketClient::advanceConnectionSetup() {
+    // Runs phases until one has to wait on the socket; a phase is only entered once the previous one completed
+    while (true) {
+        ConnectionSetupStepResult stepResult = ConnectionSetupStepResult::FAILED;
+        ConnectionSetupPhase nextPhase = ConnectionSetupPhase::IDLE;
+        
+        switch (connectionSetupPhase) {
+            case ConnectionSetupPhase::RESOLVING:
+                stepResult = advanceAddressResolution();
+                nextPhase = ConnectionSetupPhase::TCP_CONNECTING;
+                break;
+            case ConnectionSetupPhase::TCP_CONNECTING:
+                stepResult = advanceTcpConnection();
+                nextPhase = ConnectionSetupPhase::TLS_HANDSHAKING;
+                break;
+            case ConnectionSetupPhase::TLS_HANDSHAKING:
+                stepResult = advanceSslHandshake();
+                nextPhase = ConnectionSetupPhase::UPGRADE_SENDING;
+                break;
+            case ConnectionSetupPhase::UPGRADE_SENDING:
+                stepResult = advanceUpgradeRequest();
+                nextPhase = ConnectionSetupPhase::UPGRADE_RECEIVING;
+                break;
+            case ConnectionSetupPhase::UPGRADE_RECEIVING:
+                stepResult = advanceUpgradeResponse();
+                nextPhase = ConnectionSetupPhase::IDLE;
+                break;
+            case ConnectionSetupPhase::IDLE:
+            default:
+                lastErrorStringValue = "No connection setup in progress";
+                return ConnectionSetupStepResult::FAILED;
         }
         
-        struct addrinfo hintsStruct;
-        struct addrinfo* resultsPointer = nullptr;
-        
-        std::memset(&hintsStruct, 0, sizeof(hintsStruct));
-        hintsStruct.ai_family = AF_UNSPEC;
-        hintsStruct.ai_socktype = SOCK_STREAM;
-        
-        int getAddrInfoResult = getaddrinfo(hostnameString.c_str(), portString.c_str(), &hintsStruct, &resultsPointer);
-        if (getAddrInfoResult != 0) {
-            lastErrorStringValue = std::string("getaddrinfo failed: ") + gai_strerror(getAddrInfoResult);
-            return false;
+        if (stepResult != ConnectionSetupStepResult::COMPLETE) {
+            return stepResult;
         }
         
-        socketFileDescriptor = -1;
-        for (struct addrinfo* currentAddressPointer = resultsPointer; currentAddressPointer != nullptr; currentAddressPointer = currentAddressPointer->ai_next) {
-            socketFileDescriptor = socket(currentAddressPointer->ai_family, currentAddressPointer->ai_socktype, currentAddressPointer->ai_protocol);
-            if (socketFileDescriptor < 0) {
-                continue;
+        connectionSetupPhase = nextPhase;
+        connectionSetupWantsWriteFlag = false;
+        if (nextPhase == ConnectionSetupPhase::IDLE) {
+            lastErrorStringValue.clear();
+            connectionGenerationValue.fetch_add(1);
+            connectedFlag.store(true);
+            return ConnectionSetupStepResult::COMPLETE;
+        }
+    }
+}
+
+WebSocketClient::ConnectionSetupStepResult WebSocketClient::advanceAddressResolution() {
+    if (!addressResolutionPointer->completeFlag.load(std::memory_order_acquire)) {
+        return ConnectionSetupStepResult::WAITING;
+    }
+    if (addressResolutionPointer->resultCode != 0) {
+        lastErrorStringValue = std::string("getaddrinfo failed: ") + gai_strerror(addressResolutionPointer->resultCode);
+        return ConnectionSetupStepResult::FAILED;
+    }
+    
+    nextResolvedAddressPointer = addressResolutionPointer->addressListPointer;
+    lastErrorStringValue = "Failed to establish TCP connection";
+    return ConnectionSetupStepResult::COMPLETE;
+}
+
+WebSocketClient::ConnectionSetupStepResult WebSocketClient::advanceTcpConnection() {
+    // Resolved addresses are tried in order until one accepts
+    while (true) {
+        if (socketFileDescriptor >= 0) {
+            int socketErrorValue = 0;
+            socklen_t socketErrorLength = sizeof(socketErrorValue);
+            if (getsockopt(socketFileDescriptor, SOL_SOCKET, SO_ERROR, &socketErrorValue, &socketErrorLength) != 0) {
+                socketErrorValue = errno;
             }
-            
-            if (::connect(socketFileDescriptor, currentAddressPointer->ai_addr, static_cast<socklen_t>(currentAddressPointer->ai_addrlen)) == 0) {
-                break;
+            if (socketErrorValue == 0) {
+                struct sockaddr_storage peerAddressStruct;
+                socklen_t peerAddressLength = sizeof(peerAddressStruct);
+                if (getpeername(socketFileDescriptor, reinterpret_cast<struct sockaddr*>(&peerAddressStruct), &peerAddressLength) == 0) {
+                    addressResolutionPointer.reset();
+                    nextResolvedAddressPointer = nullptr;
+                    return ConnectionSetupStepResult::COMPLETE;
+                }
+                if (errno == ENOTCONN) {
+                    // Still in progress; writability signals the outcome
+                    connectionSetupWantsWriteFlag = true;
+                    return ConnectionSetupStepResult::WAITING;
+                }
+                socketErrorValue = errno;
             }
-            
+            lastErrorStringValue = std::string("Failed to establish TCP connection: ") + strerror(socketErrorValue);
             ::close(socketFileDescriptor);
             socketFileDescriptor = -1;
         }
         
-        freeaddrinfo(resultsPointer);
+        if (!nextResolvedAddressPointer) {
+            return ConnectionSetupStepResult::FAILED;
+        }
+        
+        struct addrinfo* currentAddressPointer = nextResolvedAddressPointer;
+        nextResolvedAddressPointer = currentAddressPointer->ai_next;
         
+        socketFileDescriptor = socket(currentAddressPointer->ai_family, currentAddressPointer->ai_socktype, currentAddressPointer->ai_protocol);
         if (socketFileDescriptor < 0) {
-            lastErrorStringValue = "Failed to establish TCP connection";
-            return false;
+            lastErrorStringValue = std::string("Failed to create socket: ") + strerror(errno);
+            continue;
         }
-        
         int flagsValue = fcntl(socketFileDescriptor, F_GETFL, 0);
         fcntl(socketFileDescriptor, F_SETFL, flagsValue | O_NONBLOCK);
+        // A new descriptor can reuse the number of the one just closed, so the reactor re-registers on the generation
+        connectionGenerationValue.fetch_add(1);
         
-        return true;
+        if (::connect(socketFileDescriptor, currentAddressPointer->ai_addr, static_cast<socklen_t>(currentAddressPointer->ai_addrlen)) == 0 ||
+            errno == EINPROGRESS) {
+            continue;
+        }
         
-    } catch (const std::exception& tcpExceptionError) {
-        lastErrorStringValue = std::string("TCP connection exception: ") + tcpExceptionError.what();
-        return false;
-    } catch (...) {
-        lastErrorStringValue = "Unknown TCP connection error";
-        return false;
+        lastErrorStringValue = std::string("Failed to establish TCP connection: ") + strerror(errno);
+        ::close(socketFileDescriptor);
+        socketFileDescriptor = -1;
     }
 }
 
-bool WebSocketClient::performSslHandshake() {
-    try {
+WebSocketClient::ConnectionSetupStepResult WebSocketClient::advanceSslHandshake() {
+    if (!sslConnectionPointer) {
         const SSL_METHOD* methodPointer = TLS_client_method();
         sslContextPointer = SSL_CTX_new(methodPointer);
         
         if (!sslContextPointer) {
-            unsigned long sslErrorCode = ERR_get_error();
-            char errorBuffer[512];
-            ERR_error_string_n(sslErrorCode, errorBuffer, sizeof(errorBuffer));
-            lastErrorStringValue = std::string("Failed to create SSL context: ") + errorBuffer;
+            lastErrorStringValue = describeSslError("Failed to create SSL context", SSL_ERROR_SSL);
             WebSocketLogs::log_websocket_ssl_error(lastErrorStringValue, "trading_system.log");
-            return false;
+            return ConnectionSetupStepResult::FAILED;
         }
         
         SSL_CTX_set_options(static_cast<SSL_CTX*>(sslContextPointer), SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3);
@@ -522,117 +731,43 @@ bool WebSocketClient::performSslHandshake() {
         
         sslConnectionPointer = SSL_new(static_cast<SSL_CTX*>(sslContextPointer));
         if (!sslConnectionPointer) {
-            unsigned long sslErrorCode = ERR_get_error();
-            char errorBuffer[512];
-            ERR_error_string_n(sslErrorCode, errorBuffer, sizeof(errorBuffer));
-            lastErrorStringValue = std::string("Failed to create SSL connection: ") + errorBuffer;
-            SSL_CTX_free(static_cast<SSL_CTX*>(sslContextPointer));
-            sslContextPointer = nullptr;
+            lastErrorStringValue = describeSslError("Failed to create SSL connection", SSL_ERROR_SSL);
             WebSocketLogs::log_websocket_ssl_error(lastErrorStringValue, "trading_system.log");
-            return false;
+            return ConnectionSetupStepResult::FAILED;
         }
         
+        // Queued frames are written from a growing buffer, possibly a part at a time
+        SSL_set_mode(static_cast<SSL*>(sslConnectionPointer), SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
         SSL_set_fd(static_cast<SSL*>(sslConnectionPointer), socketFileDescriptor);
         
         std::string hostnameString = extractHostname(websocketUrlStringValue);
         if (!hostnameString.empty()) {
             SSL_set_tlsext_host_name(static_cast<SSL*>(sslConnectionPointer), hostnameString.c_str());
         }
-        
-        SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
-        
-        int sslConnectResult = SSL_connect(sslConnectionPointerTyped);
-        
-        while (sslConnectResult <= 0) {
-            int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, sslConnectResult);
-            
-            if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
-                fd_set readFileDescriptorSet;
-                fd_set writeFileDescriptorSet;
-                struct timeval timeoutStruct;
-                
-                FD_ZERO(&readFileDescriptorSet);
-                FD_ZERO(&writeFileDescriptorSet);
-                
-                if (sslErrorCode == SSL_ERROR_WANT_READ) {
-                    FD_SET(socketFileDescriptor, &readFileDescriptorSet);
-                } else {
-                    FD_SET(socketFileDescriptor, &writeFileDescriptorSet);
-                }
-                
-                timeoutStruct.tv_sec = 10;
-                timeoutStruct.tv_usec = 0;
-                
-                int selectResult = select(socketFileDescriptor + 1, &readFileDescriptorSet, &writeFileDescriptorSet, nullptr, &timeoutStruct);
-                if (selectResult <= 0) {
-                    unsigned long opensslErrorCode = ERR_get_error();
-                    char errorBuffer[512];
-                    if (opensslErrorCode != 0) {
-                        ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
-                        lastErrorStringValue = std::string("SSL handshake timeout/error: ") + errorBuffer;
-                    } else {
-                        lastErrorStringValue = "SSL handshake timeout: select() returned " + std::to_string(selectResult);
-                    }
-                    SSL_free(sslConnectionPointerTyped);
-                    SSL_CTX_free(static_cast<SSL_CTX*>(sslContextPointer));
-                    sslConnectionPointer = nullptr;
-                    sslContextPointer = nullptr;
-                    WebSocketLogs::log_websocket_ssl_error(lastErrorStringValue, "trading_system.log");
-                    return false;
-                }
-                
-                sslConnectResult = SSL_connect(sslConnectionPointerTyped);
-            } else {
-                unsigned long opensslErrorCode = ERR_get_error();
-                char errorBuffer[512];
-                if (opensslErrorCode != 0) {
-                    ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
-                    lastErrorStringValue = std::string("SSL handshake failed: ") + errorBuffer + " (SSL_get_error: " + std::to_string(sslErrorCode) + ")";
-                } else {
-                    lastErrorStringValue = std::string("SSL handshake failed: SSL_get_error=") + std::to_string(sslErrorCode);
-                }
-                SSL_free(sslConnectionPointerTyped);
-                SSL_CTX_free(static_cast<SSL_CTX*>(sslContextPointer));
-                sslConnectionPointer = nullptr;
-                sslContextPointer = nullptr;
-                WebSocketLogs::log_websocket_ssl_error(lastErrorStringValue, "trading_system.log");
-                return false;
-            }
-        }
-        
-        return true;
-        
-    } catch (const std::exception& sslExceptionError) {
-        lastErrorStringValue = std::string("SSL handshake exception: ") + sslExceptionError.what();
-        if (sslConnectionPointer) {
-            SSL_free(static_cast<SSL*>(sslConnectionPointer));
-            sslConnectionPointer = nullptr;
-        }
-        if (sslContextPointer) {
-            SSL_CTX_free(static_cast<SSL_CTX*>(sslContextPointer));
-            sslContextPointer = nullptr;
-        }
-        WebSocketLogs::log_websocket_ssl_error(lastErrorStringValue, "trading_system.log");
-        return false;
-    } catch (...) {
-        lastErrorStringValue = "Unknown SSL handshake error";
-        if (sslConnectionPointer) {
-            SSL_free(static_cast<SSL*>(sslConnectionPointer));
-            sslConnectionPointer = nullptr;
-        }
-        if (sslContextPointer) {
-            SSL_CTX_free(static_cast<SSL_CTX*>(sslContextPointer));
-            sslContextPointer = nullptr;
-        }
-        WebSocketLogs::log_websocket_ssl_error(lastErrorStringValue, "trading_system.log");
-        return false;
     }
+    
+    SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
+    int sslConnectResult = SSL_connect(sslConnectionPointerTyped);
+    if (sslConnectResult == 1) {
+        return ConnectionSetupStepResult::COMPLETE;
+    }
+    
+    int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, sslConnectResult);
+    if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
+        connectionSetupWantsWriteFlag = (sslErrorCode == SSL_ERROR_WANT_WRITE);
+        return ConnectionSetupStepResult::WAITING;
+    }
+    
+    lastErrorStringValue = describeSslError("SSL handshake failed", sslErrorCode);
+    WebSocketLogs::log_websocket_ssl_error(lastErrorStringValue, "trading_system.log");
+    return ConnectionSetupStepResult::FAILED;
 }
 
-bool WebSocketClient::performWebSocketHandshake() {
-    try {
+WebSocketClient::ConnectionSetupStepResult WebSocketClient::advanceUpgradeRequest() {
+    if (upgradeRequestString.empty()) {
         std::vector<unsigned char> webSocketKeyBytes = generateRandomBytes(16);
         std::string webSocketKeyString = base64Encode(std::string(webSocketKeyBytes.begin(), webSocketKeyBytes.end()));
+        upgradeExpectedAcceptString = base64Encode(sha1Hash(webSocketKeyString + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"));
         
         std::string hostnameString = extractHostname(websocketUrlStringValue);
         std::string pathString = extractPath(websocketUrlStringValue);
@@ -649,650 +784,684 @@ bool WebSocketClient::performWebSocketHandshake() {
         handshakeStream << "Sec-WebSocket-Version: 13\r\n";
         handshakeStream << "\r\n";
         
-        std::string handshakeRequestString = handshakeStream.str();
-        
-        int bytesSent = 0;
-        if (sslConnectionPointer) {
-            SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
-            bytesSent = SSL_write(sslConnectionPointerTyped, handshakeRequestString.c_str(), static_cast<int>(handshakeRequestString.length()));
-            
-            if (bytesSent <= 0) {
-                int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, bytesSent);
-                unsigned long opensslErrorCode = ERR_get_error();
-                char errorBuffer[512];
-                if (opensslErrorCode != 0) {
-                    ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
-                    lastErrorStringValue = std::string("SSL write failed: ") + errorBuffer + " (SSL_get_error: " + std::to_string(sslErrorCode) + ")";
-                } else {
-                    lastErrorStringValue = std::string("SSL write failed: SSL_get_error=") + std::to_string(sslErrorCode) + ", bytesSent=" + std::to_string(bytesSent);
-                }
-                WebSocketLogs::log_websocket_handshake_table(handshakeRequestString, "", bytesSent, 0, "trading_system.log");
-                return false;
-            }
-        } else {
-            bytesSent = ::write(socketFileDescriptor, handshakeRequestString.c_str(), handshakeRequestString.length());
-            if (bytesSent < 0) {
-                lastErrorStringValue = std::string("write() failed: errno=") + std::to_string(errno) + " (" + strerror(errno) + ")";
-                WebSocketLogs::log_websocket_handshake_table(handshakeRequestString, "", bytesSent, 0, "trading_system.log");
-                return false;
+        upgradeRequestString = handshakeStream.str();
+        upgradeRequestBytesSentValue = 0;
+    }
+    
+    SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
+    while (upgradeRequestBytesSentValue < upgradeRequestString.size()) {
+        int bytesSent = SSL_write(sslConnectionPointerTyped, upgradeRequestString.data() + upgradeRequestBytesSentValue,
+                                  static_cast<int>(upgradeRequestString.size() - upgradeRequestBytesSentValue));
+        if (bytesSent <= 0) {
+            int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, bytesSent);
+            if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
+                connectionSetupWantsWriteFlag = (sslErrorCode == SSL_ERROR_WANT_WRITE);
+                return ConnectionSetupStepResult::WAITING;
             }
+            lastErrorStringValue = describeSslError("SSL write failed", sslErrorCode);
+            WebSocketLogs::log_websocket_handshake_table(upgradeRequestString, "", static_cast<int>(upgradeRequestBytesSentValue), 0, "trading_system.log");
+            return ConnectionSetupStepResult::FAILED;
+        }
+        upgradeRequestBytesSentValue += static_cast<size_t>(bytesSent);
+    }
+    
+    upgradeResponseString.clear();
+    return ConnectionSetupStepResult::COMPLETE;
+}
+
+WebSocketClient::ConnectionSetupStepResult WebSocketClient::advanceUpgradeResponse() {
+    SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
+    int requestBytesSent = static_cast<int>(upgradeRequestBytesSentValue);
+    char responseBuffer[4096];
+    
+    while (upgradeResponseString.find("\r\n\r\n") == std::string::npos) {
+        if (upgradeResponseString.size() >= maximumUpgradeResponseBytes) {
+            lastErrorStringValue = std::string("WebSocket handshake response headers incomplete after ") + std::to_string(upgradeResponseString.size()) + " bytes";
+            WebSocketLogs::log_websocket_handshake_table(upgradeRequestString, upgradeResponseString, requestBytesSent, static_cast<int>(upgradeResponseString.size()), "trading_system.log");
+            return ConnectionSetupStepResult::FAILED;
         }
         
-        if (static_cast<size_t>(bytesSent) != handshakeRequestString.length()) {
-            lastErrorStringValue = "Failed to send complete WebSocket handshake request";
-            WebSocketLogs::log_websocket_handshake_table(handshakeRequestString, "", bytesSent, 0, "trading_system.log");
-            return false;
-        }
-        
-        std::string handshakeResponseString;
-        char responseBuffer[4096];
-        
-        bool headersComplete = false;
-        int totalBytesReceivedValue = 0;
-        int readAttemptsCount = 0;
-        const int maxReadAttemptsValue = 10;
-        
-        while (!headersComplete && handshakeResponseString.length() < 4096 && readAttemptsCount < maxReadAttemptsValue) {
-            readAttemptsCount++;
-            
-            int bytesReceived = 0;
-            if (sslConnectionPointer) {
-                SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
-                bytesReceived = SSL_read(sslConnectionPointerTyped, responseBuffer, sizeof(responseBuffer) - 1);
-                
-                if (bytesReceived <= 0) {
-                    int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, bytesReceived);
-                    
-                    if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
-                        fd_set readFileDescriptorSet;
-                        fd_set writeFileDescriptorSet;
-                        struct timeval timeoutStruct;
-                        
-                        FD_ZERO(&readFileDescriptorSet);
-                        FD_ZERO(&writeFileDescriptorSet);
-                        
-                        if (sslErrorCode == SSL_ERROR_WANT_READ) {
-                            FD_SET(socketFileDescriptor, &readFileDescriptorSet);
-                        } else {
-                            FD_SET(socketFileDescriptor, &writeFileDescriptorSet);
-                        }
-                        
-                        timeoutStruct.tv_sec = 5;
-                        timeoutStruct.tv_usec = 0;
-                        
-                        int selectResult = select(socketFileDescriptor + 1, &readFileDescriptorSet, &writeFileDescriptorSet, nullptr, &timeoutStruct);
-                        if (selectResult <= 0) {
-                            lastErrorStringValue = std::string("SSL read timeout/error: select() returned ") + std::to_string(selectResult) + ", SSL_get_error=" + std::to_string(sslErrorCode);
-                            WebSocketLogs::log_websocket_ssl_read_error(sslErrorCode, "trading_system.log");
-                            WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
-                            if (totalBytesReceivedValue > 0) {
-                                WebSocketLogs::log_websocket_handshake_table(handshakeRequestString, handshakeResponseString, bytesSent, totalBytesReceivedValue, "trading_system.log");
-                            }
-                            return false;
-                        }
-                        continue;
-                    } else {
-                        unsigned long opensslErrorCode = ERR_get_error();
-                        char errorBuffer[512];
-                        if (opensslErrorCode != 0) {
-                            ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
-                            lastErrorStringValue = std::string("SSL read failed: ") + errorBuffer + " (SSL_get_error: " + std::to_string(sslErrorCode) + ")";
-                        } else {
-                            lastErrorStringValue = std::string("SSL read failed: SSL_get_error=") + std::to_string(sslErrorCode) + ", bytesReceived=" + std::to_string(bytesReceived);
-                        }
-                        WebSocketLogs::log_websocket_ssl_read_error(sslErrorCode, "trading_system.log");
-                        WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
-                        if (totalBytesReceivedValue > 0) {
-                            WebSocketLogs::log_websocket_handshake_table(handshakeRequestString, handshakeResponseString, bytesSent, totalBytesReceivedValue, "trading_system.log");
-                        }
-                        return false;
-                    }
-                }
+        int bytesReceived = SSL_read(sslConnectionPointerTyped, responseBuffer, sizeof(responseBuffer));
+        if (bytesReceived <= 0) {
+            int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, bytesReceived);
+            if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
+                connectionSetupWantsWriteFlag = (sslErrorCode == SSL_ERROR_WANT_WRITE);
+                return ConnectionSetupStepResult::WAITING;
+            }
+            if (sslErrorCode == SSL_ERROR_ZERO_RETURN) {
+                lastErrorStringValue = "Connection closed by server during handshake";
             } else {
-                bytesReceived = ::read(socketFileDescriptor, responseBuffer, sizeof(responseBuffer) - 1);
-                
-                if (bytesReceived < 0) {
-                    if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                        continue;
-                    }
-                    lastErrorStringValue = std::string("read() failed: errno=") + std::to_string(errno) + " (" + strerror(errno) + ")";
-                    WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
-                    if (totalBytesReceivedValue > 0) {
-                        WebSocketLogs::log_websocket_handshake_response(handshakeResponseString, "trading_system.log");
-                    }
-                    return false;
-                } else if (bytesReceived == 0) {
-                    lastErrorStringValue = "Connection closed by server during handshake";
-                    WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
-                    if (totalBytesReceivedValue > 0) {
-                        WebSocketLogs::log_websocket_handshake_response(handshakeResponseString, "trading_system.log");
-                    }
-                    return false;
-                }
+                lastErrorStringValue = describeSslError("SSL read failed", sslErrorCode);
+                WebSocketLogs::log_websocket_ssl_read_error(sslErrorCode, "trading_system.log");
             }
-            
-            responseBuffer[bytesReceived] = '\0';
-            handshakeResponseString.append(responseBuffer, bytesReceived);
-            totalBytesReceivedValue += bytesReceived;
-            
-            WebSocketLogs::log_websocket_handshake_bytes_received(bytesReceived, "trading_system.log");
-            
-            if (handshakeResponseString.find("\r\n\r\n") != std::string::npos) {
-                headersComplete = true;
+            WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
+            if (!upgradeResponseString.empty()) {
+                WebSocketLogs::log_websocket_handshake_table(upgradeRequestString, upgradeResponseString, requestBytesSent, static_cast<int>(upgradeResponseString.size()), "trading_system.log");
             }
+            return ConnectionSetupStepResult::FAILED;
         }
         
-        if (!headersComplete) {
-            lastErrorStringValue = std::string("WebSocket handshake response incomplete after ") + std::to_string(readAttemptsCount) + " read attempts, " + std::to_string(totalBytesReceivedValue) + " bytes received";
-            WebSocketLogs::log_websocket_handshake_table(handshakeRequestString, handshakeResponseString, bytesSent, totalBytesReceivedValue, "trading_system.log");
-            return false;
+        upgradeResponseString.append(responseBuffer, static_cast<size_t>(bytesReceived));
+        WebSocketLogs::log_websocket_handshake_bytes_received(bytesReceived, "trading_system.log");
+    }
+    
+    WebSocketLogs::log_websocket_handshake_table(upgradeRequestString, upgradeResponseString, requestBytesSent, static_cast<int>(upgradeResponseString.size()), "trading_system.log");
+    
+    if (upgradeResponseString.find("HTTP/1.1 101") == std::string::npos &&
+        upgradeResponseString.find("HTTP/1.0 101") == std::string::npos) {
+        size_t firstLineEndPos = upgradeResponseString.find("\r\n");
+        std::string firstLine = firstLineEndPos != std::string::npos ? upgradeResponseString.substr(0, firstLineEndPos) : upgradeResponseString.substr(0, 100);
+        lastErrorStringValue = std::string("WebSocket handshake failed - invalid response code. First line: ") + firstLine;
+        return ConnectionSetupStepResult::FAILED;
+    }
+    
+    if (upgradeResponseString.find(upgradeExpectedAcceptString) == std::string::npos) {
+        size_t acceptKeyStartPos = upgradeResponseString.find("Sec-WebSocket-Accept:");
+        std::string acceptKeyLine = "not found";
+        if (acceptKeyStartPos != std::string::npos) {
+            size_t acceptKeyEndPos = upgradeResponseString.find("\r\n", acceptKeyStartPos);
+            acceptKeyLine = upgradeResponseString.substr(acceptKeyStartPos, acceptKeyEndPos != std::string::npos ? acceptKeyEndPos - acceptKeyStartPos : 200);
         }
-        
-        WebSocketLogs::log_websocket_handshake_table(handshakeRequestString, handshakeResponseString, bytesSent, totalBytesReceivedValue, "trading_system.log");
-        
-        if (handshakeResponseString.find("HTTP/1.1 101") == std::string::npos &&
-            handshakeResponseString.find("HTTP/1.0 101") == std::string::npos) {
-            size_t firstLineEndPos = handshakeResponseString.find("\r\n");
-            std::string firstLine = firstLineEndPos != std::string::npos ? handshakeResponseString.substr(0, firstLineEndPos) : handshakeResponseString.substr(0, 100);
-            lastErrorStringValue = std::string("WebSocket handshake failed - invalid response code. First line: ") + firstLine;
-            return false;
+        lastErrorStringValue = std::string("WebSocket handshake failed - invalid accept key. Expected: ") + upgradeExpectedAcceptString + ", Found in response: " + acceptKeyLine;
+        WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
+        return ConnectionSetupStepResult::FAILED;
+    }
+    
+    // Frames sent right after the upgrade may share a read with the response headers
+    size_t headersEndPosition = upgradeResponseString.find("\r\n\r\n") + 4;
+    resetReceiveBuffer();
+    if (headersEndPosition < upgradeResponseString.size()) {
+        size_t leftoverBytesCount = upgradeResponseString.size() - headersEndPosition;
+        if (receiveBufferBytes.size() < leftoverBytesCount) {
+            receiveBufferBytes.resize(leftoverBytesCount);
         }
-        
-        std::string expectedAcceptString = webSocketKeyString + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
-        std::string expectedAcceptHashString = sha1Hash(expectedAcceptString);
-        std::string expectedAcceptBase64String = base64Encode(expectedAcceptHashString);
-        
-        if (handshakeResponseString.find(expectedAcceptBase64String) == std::string::npos) {
-            size_t acceptKeyStartPos = handshakeResponseString.find("Sec-WebSocket-Accept:");
-            std::string acceptKeyLine = "not found";
-            if (acceptKeyStartPos != std::string::npos) {
-                size_t acceptKeyEndPos = handshakeResponseString.find("\r\n", acceptKeyStartPos);
-                acceptKeyLine = handshakeResponseString.substr(acceptKeyStartPos, acceptKeyEndPos != std::string::npos ? acceptKeyEndPos - acceptKeyStartPos : 200);
+        std::memcpy(receiveBufferBytes.data(), upgradeResponseString.data() + headersEndPosition, leftoverBytesCount);
+        receiveBufferWriteOffsetValue = leftoverBytesCount;
+    }
+    
+    upgradeRequestString.clear();
+    upgradeResponseString.clear();
+    upgradeExpectedAcceptString.clear();
+    return ConnectionSetupStepResult::COMPLETE;
+}
+
+bool WebSocketClient::waitForConnectionSetupReadiness() {
+    auto remainingDuration = connectionSetupDeadlineTimePoint - std::chrono::steady_clock::now();
+    if (remainingDuration <= std::chrono::steady_clock::duration::zero()) {
+        lastErrorStringValue = "Connection setup timed out";
+        return false;
+    }
+    
+    struct pollfd setupPollStruct;
+    setupPollStruct.fd = socketFileDescriptor;
+    setupPollStruct.events = connectionSetupWantsWriteFlag ? POLLOUT : POLLIN;
+    setupPollStruct.revents = 0;
+    // Round up so the wait never ends just before the deadline
+    int remainingMilliseconds = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(remainingDuration + std::chrono::microseconds(999)).count());
+    if (::poll(&setupPollStruct, 1, remainingMilliseconds) < 0 && errno != EINTR) {
+        lastErrorStringValue = std::string("poll() failed during connection setup: ") + strerror(errno);
+        return false;
+    }
+    return true;
+}
+
+int WebSocketClient::getReactorSocketFileDescriptor() const {
+    return (connectedFlag.load() || reconnectSetupInProgressFlag) ? socketFileDescriptor : -1;
+}
+
+unsigned long WebSocketClient::getConnectionGeneration() const {
+    return connectionGenerationValue.load();
+}
+
+bool WebSocketClient::isWaitingForWriteReadiness() const {
+    if (reconnectSetupInProgressFlag) {
+        return connectionSetupWantsWriteFlag;
+    }
+    return receiveWantsWriteFlag || (sendPendingFlag.load() && !sendWaitsForReadFlag);
+}
+
+void WebSocketClient::handleSocketReadiness() {
+    if (reconnectSetupInProgressFlag) {
+        advanceReconnect();
+        // A completed upgrade may have left frames in the receive buffer
+        if (!connectedFlag.load()) {
+            return;
+        }
+    }
+    
+    try {
+        if (sendPendingFlag.load()) {
+            std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+            if (!flushPendingSends()) {
+                connectedFlag.store(false);
             }
-            lastErrorStringValue = std::string("WebSocket handshake failed - invalid accept key. Expected: ") + expectedAcceptBase64String + ", Found in response: " + acceptKeyLine;
-            WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
-            return false;
         }
         
-        return true;
-        
-    } catch (const std::exception& handshakeExceptionError) {
-        lastErrorStringValue = std::string("WebSocket handshake exception: ") + handshakeExceptionError.what();
-        WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
-        return false;
+        // Drain until the socket would block; SSL may hold decrypted bytes the poller cannot see
+        while (shouldReceiveLoopContinue.load() && connectedFlag.load()) {
+            if (!receiveAndProcessMessage()) {
+                break;
+            }
+        }
+    } catch (const std::exception& readinessExceptionError) {
+        try {
+            WebSocketLogs::log_websocket_receive_error(readinessExceptionError.what(), "trading_system.log");
+        } catch (...) {
+            std::cerr << "WebSocket receive error: " << readinessExceptionError.what() << std::endl;
+        }
+        connectedFlag.store(false);
     } catch (...) {
-        lastErrorStringValue = "Unknown WebSocket handshake error";
-        WebSocketLogs::log_websocket_handshake_error(lastErrorStringValue, "trading_system.log");
+        try {
+            WebSocketLogs::log_websocket_receive_error("Unknown receive loop error", "trading_system.log");
+        } catch (...) {
+            std::cerr << "WebSocket receive loop unknown error" << std::endl;
+        }
+        connectedFlag.store(false);
+    }
+    
+    if (shouldReceiveLoopContinue.load() && !connectedFlag.load() && !reconnectScheduledFlag) {
+        scheduleReconnect(std::chrono::steady_clock::now() + reconnectInitialDelay);
+    }
+}
+
+bool WebSocketClient::getNextTimerDeadline(std::chrono::steady_clock::time_point& deadlineTimePoint) const {
+    if (!shouldReceiveLoopContinue.load()) {
         return false;
     }
+    
+    bool hasDeadlineFlag = false;
+    
+    if (reconnectSetupInProgressFlag) {
+        // Readiness drives the setup; the deadline only bounds it, except when the lookup thread has finished
+        bool resolutionReadyFlag = connectionSetupPhase == ConnectionSetupPhase::RESOLVING && addressResolutionPointer &&
+                                   addressResolutionPointer->completeFlag.load(std::memory_order_acquire);
+        deadlineTimePoint = resolutionReadyFlag ? std::chrono::steady_clock::now() : connectionSetupDeadlineTimePoint;
+        hasDeadlineFlag = true;
+    } else if (!connectedFlag.load()) {
+        // Disconnect noticed outside the reactor (e.g. a failed send) still needs a reconnect
+        deadlineTimePoint = reconnectScheduledFlag ? reconnectDeadlineTimePoint : std::chrono::steady_clock::now();
+        hasDeadlineFlag = true;
+    }
+    
+    if (subscriptionRequestedFlag.load() && connectedFlag.load()) {
+        deadlineTimePoint = std::chrono::steady_clock::now();
+        hasDeadlineFlag = true;
+    }
+    
+    if (subscriptionPendingFlag && (!hasDeadlineFlag || subscriptionDeadlineTimePoint < deadlineTimePoint)) {
+        deadlineTimePoint = subscriptionDeadlineTimePoint;
+        hasDeadlineFlag = true;
+    }
+    
+    if (periodicTimerCallbackFunction && (!hasDeadlineFlag || periodicTimerDeadlineTimePoint < deadlineTimePoint)) {
+        deadlineTimePoint = periodicTimerDeadlineTimePoint;
+        hasDeadlineFlag = true;
+    }
+    
+    return hasDeadlineFlag;
 }
 
-void WebSocketClient::receiveLoopWorker() {
-    int loopIterationCount = 0;
-    auto lastHeartbeatLogTime = std::chrono::steady_clock::now();
+void WebSocketClient::handleTimerExpiry(std::chrono::steady_clock::time_point currentTimePoint) {
+    if (!shouldReceiveLoopContinue.load()) {
+        return;
+    }
     
-    try {
-        AlpacaTrader::Logging::LoggingContext* parentLoggingContextValue = parentLoggingContextPointer;
-        if (parentLoggingContextValue) {
+    if (periodicTimerCallbackFunction && currentTimePoint >= periodicTimerDeadlineTimePoint) {
+        // Skip missed ticks instead of firing a burst after a stall
+        periodicTimerDeadlineTimePoint += periodicTimerIntervalDuration;
+        if (periodicTimerDeadlineTimePoint <= currentTimePoint) {
+            periodicTimerDeadlineTimePoint = currentTimePoint + periodicTimerIntervalDuration;
+        }
+        try {
+            periodicTimerCallbackFunction();
+        } catch (const std::exception& timerCallbackExceptionError) {
             try {
-                AlpacaTrader::Logging::set_logging_context(*parentLoggingContextValue);
-                AlpacaTrader::Logging::set_log_thread_tag("WS    ");
-                // Receive loop started log removed to reduce log noise
-            } catch (const std::exception& setContextExceptionError) {
-                std::cerr << "WARNING: WebSocket receive loop could not set logging context: " << setContextExceptionError.what() << " - continuing without logging context" << std::endl;
+                WebSocketLogs::log_websocket_receive_error(std::string("Periodic timer callback error: ") + timerCallbackExceptionError.what(), "trading_system.log");
             } catch (...) {
-                std::cerr << "WARNING: WebSocket receive loop could not set logging context - continuing without logging context" << std::endl;
+                // Logging failed, continue
             }
-        } else {
-            std::cerr << "WebSocket receive loop started (no logging context available from parent thread)" << std::endl;
+        } catch (...) {
+            // Timer callback failures must not stop the reactor
         }
+    }
+    
+    if (reconnectSetupInProgressFlag) {
+        advanceReconnect();
+        if (connectedFlag.load()) {
+            handleSocketReadiness();
+        }
+        return;
+    }
+    
+    if (!connectedFlag.load()) {
+        if (!reconnectScheduledFlag) {
+            scheduleReconnect(currentTimePoint + reconnectInitialDelay);
+        } else if (currentTimePoint >= reconnectDeadlineTimePoint) {
+            reconnectScheduledFlag = false;
+            attemptReconnect();
+        }
+        return;
+    }
+    
+    if (subscriptionRequestedFlag.exchange(false)) {
+        std::string requestedParamsString;
+        {
+            std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+            requestedParamsString = subscriptionParamsStringValue;
+        }
+        subscribe(requestedParamsString);
+    }
+    
+    if (subscriptionPendingFlag && currentTimePoint >= subscriptionDeadlineTimePoint) {
+        subscriptionPendingFlag = false;
+        if (!subscriptionParamsStringValue.empty()) {
+            subscribe(subscriptionParamsStringValue);
+        }
+    }
+}
+
+void WebSocketClient::scheduleReconnect(std::chrono::steady_clock::time_point deadlineTimePoint) {
+    // Cleanup old connection right away so the server can release it while we wait
+    {
+        std::lock_guard<std::mutex> cleanupGuard(clientStateMutex);
+        try {
+            cleanupConnection();
+        } catch (...) {
+            // Ignore cleanup errors, continue with reconnection
+        }
+        connectedFlag.store(false);
+    }
+    
+    subscriptionPendingFlag = false;
+    reconnectScheduledFlag = true;
+    reconnectDeadlineTimePoint = deadlineTimePoint;
+}
+
+void WebSocketClient::attemptReconnect() {
+    try {
+        WebSocketLogs::log_websocket_reconnection_attempt("trading_system.log");
     } catch (...) {
-        std::cerr << "WebSocket receive loop started (logging initialization failed)" << std::endl;
+        std::cerr << "WebSocket attempting reconnection..." << std::endl;
     }
     
-    while (shouldReceiveLoopContinue.load()) {
+    bool setupStartedFlag = false;
+    {
+        std::lock_guard<std::mutex> stateGuard(clientStateMutex);
         try {
-            if (!connectedFlag.load()) {
-                if (shouldReceiveLoopContinue.load()) {
-                    // Cleanup old connection before reconnecting to prevent connection limit issues
-                    {
-                        std::lock_guard<std::mutex> cleanupGuard(clientStateMutex);
-                        try {
-                            cleanupConnection();
-                        } catch (...) {
-                            // Ignore cleanup errors, continue with reconnection
-                        }
-                        connectedFlag.store(false);
-                    }
-                    
-                    // Wait longer before reconnection to allow server-side cleanup
-                    // This prevents hitting max_connections limit
-                    std::this_thread::sleep_for(std::chrono::milliseconds(200));
-                    
-                    try {
-                        WebSocketLogs::log_websocket_reconnection_attempt("trading_system.log");
-                    } catch (...) {
-                        std::cerr << "WebSocket attempting reconnection..." << std::endl;
-                    }
-                    
-                    if (connect(websocketUrlStringValue)) {
-                        if (!apiKeyStringValue.empty()) {
-                            authenticate(apiKeyStringValue);
-                            std::this_thread::sleep_for(std::chrono::milliseconds(500));
-                            if (!subscriptionParamsStringValue.empty()) {
-                                subscribe(subscriptionParamsStringValue);
-                            }
-                        }
-                        try {
-                            WebSocketLogs::log_websocket_reconnection_success("trading_system.log");
-                        } catch (...) {
-                            std::cerr << "WebSocket reconnection successful" << std::endl;
-                        }
-                    } else {
-                        try {
-                            WebSocketLogs::log_websocket_reconnection_failure(lastErrorStringValue, "trading_system.log");
-                        } catch (...) {
-                            std::cerr << "WebSocket reconnection failed: " << lastErrorStringValue << std::endl;
-                        }
-                        // Longer delay on failure to prevent rapid retry loops
-                        std::this_thread::sleep_for(std::chrono::milliseconds(10000));
-                        continue;
-                    }
-                } else {
-                    break;
-                }
-            }
-            
-            bool messageProcessed = receiveAndProcessMessage();
-            
-            if (!messageProcessed && connectedFlag.load()) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-            }
-            
-            loopIterationCount++;
-            
-            auto currentTime = std::chrono::steady_clock::now();
-            auto timeSinceLastLog = std::chrono::duration_cast<std::chrono::seconds>(currentTime - lastHeartbeatLogTime).count();
-            
-            // Receive loop status logs removed to reduce log noise
-            (void)loopIterationCount;
-            (void)messageProcessed;
-            (void)timeSinceLastLog;
-            (void)lastHeartbeatLogTime;
-            (void)currentTime;
-            
-        } catch (const std::exception& receiveLoopExceptionError) {
-            try {
-                WebSocketLogs::log_websocket_receive_error(receiveLoopExceptionError.what(), "trading_system.log");
-            } catch (...) {
-                std::cerr << "WebSocket receive loop error: " << receiveLoopExceptionError.what() << std::endl;
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            
-            if (shouldReceiveLoopContinue.load()) {
-                // Cleanup old connection before reconnecting to prevent connection limit issues
-                {
-                    std::lock_guard<std::mutex> cleanupGuard(clientStateMutex);
-                    try {
-                        cleanupConnection();
-                    } catch (...) {
-                        // Ignore cleanup errors, continue with reconnection
-                    }
-                    connectedFlag.store(false);
-                }
-                
-                // Wait longer before reconnection to allow server-side cleanup
-                // This prevents hitting max_connections limit
-                std::this_thread::sleep_for(std::chrono::milliseconds(2000));
-                
-                try {
-                    WebSocketLogs::log_websocket_reconnection_attempt("trading_system.log");
-                } catch (...) {
-                    std::cerr << "WebSocket attempting reconnection..." << std::endl;
-                }
-                
-                if (connect(websocketUrlStringValue)) {
-                    if (!apiKeyStringValue.empty()) {
-                        authenticate(apiKeyStringValue);
-                        std::this_thread::sleep_for(std::chrono::milliseconds(500));
-                        if (!subscriptionParamsStringValue.empty()) {
-                            subscribe(subscriptionParamsStringValue);
-                        }
-                    }
-                    try {
-                        WebSocketLogs::log_websocket_reconnection_success("trading_system.log");
-                    } catch (...) {
-                        std::cerr << "WebSocket reconnection successful" << std::endl;
-                    }
-                } else {
-                    try {
-                        WebSocketLogs::log_websocket_reconnection_failure(lastErrorStringValue, "trading_system.log");
-                    } catch (...) {
-                        std::cerr << "WebSocket reconnection failed: " << lastErrorStringValue << std::endl;
-                    }
-                    // Longer delay on failure to prevent rapid retry loops
-                    std::this_thread::sleep_for(std::chrono::milliseconds(10000));
+            setupStartedFlag = beginConnectionSetup(websocketUrlStringValue, true);
+        } catch (const std::exception& setupExceptionError) {
+            lastErrorStringValue = std::string("Connection exception: ") + setupExceptionError.what();
+        } catch (...) {
+            lastErrorStringValue = "Unknown connection error";
+        }
+    }
+    
+    if (!setupStartedFlag) {
+        finishReconnect(ConnectionSetupStepResult::FAILED);
+        return;
+    }
+    reconnectSetupInProgressFlag = true;
+}
+
+void WebSocketClient::advanceReconnect() {
+    ConnectionSetupStepResult setupResult = ConnectionSetupStepResult::FAILED;
+    {
+        std::lock_guard<std::mutex> stateGuard(clientStateMutex);
+        try {
+            if (connectionSetupPhase == ConnectionSetupPhase::IDLE) {
+                lastErrorStringValue = "Connection setup was abandoned";
+            } else {
+                setupResult = advanceConnectionSetup();
+                if (setupResult == ConnectionSetupStepResult::WAITING &&
+                    std::chrono::steady_clock::now() >= connectionSetupDeadlineTimePoint) {
+                    lastErrorStringValue = "Connection setup timed out";
+                    setupResult = ConnectionSetupStepResult::FAILED;
                 }
             }
+        } catch (const std::exception& setupExceptionError) {
+            lastErrorStringValue = std::string("Connection exception: ") + setupExceptionError.what();
+            setupResult = ConnectionSetupStepResult::FAILED;
         } catch (...) {
-            try {
-                WebSocketLogs::log_websocket_receive_error("Unknown receive loop error", "trading_system.log");
-            } catch (...) {
-                std::cerr << "WebSocket receive loop unknown error" << std::endl;
+            lastErrorStringValue = "Unknown connection error";
+            setupResult = ConnectionSetupStepResult::FAILED;
+        }
+    }
+    
+    if (setupResult != ConnectionSetupStepResult::WAITING) {
+        finishReconnect(setupResult);
+    }
+}
+
+void WebSocketClient::finishReconnect(ConnectionSetupStepResult setupResult) {
+    reconnectSetupInProgressFlag = false;
+    
+    if (setupResult == ConnectionSetupStepResult::COMPLETE) {
+        if (!apiKeyStringValue.empty()) {
+            authenticate(apiKeyStringValue);
+            // Subscribe once the server has had time to process the auth message
+            if (!subscriptionParamsStringValue.empty()) {
+                subscriptionPendingFlag = true;
+                subscriptionDeadlineTimePoint = std::chrono::steady_clock::now() + subscriptionAfterAuthenticationDelay;
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
         }
+        try {
+            WebSocketLogs::log_websocket_reconnection_success("trading_system.log");
+        } catch (...) {
+            std::cerr << "WebSocket reconnection successful" << std::endl;
+        }
+        return;
     }
     
     try {
-        WebSocketLogs::log_websocket_receive_loop_table("RECEIVE_LOOP", "WebSocket receive loop stopped - total iterations: " + std::to_string(loopIterationCount), "trading_system.log");
+        WebSocketLogs::log_websocket_connection_table(websocketUrlStringValue, false, lastErrorStringValue, "trading_system.log");
+        WebSocketLogs::log_websocket_reconnection_failure(lastErrorStringValue, "trading_system.log");
     } catch (...) {
-        std::cerr << "WebSocket receive loop stopped - total iterations: " << loopIterationCount << std::endl;
+        std::cerr << "WebSocket reconnection failed: " << lastErrorStringValue << std::endl;
     }
+    // Longer delay on failure to prevent rapid retry loops
+    scheduleReconnect(std::chrono::steady_clock::now() + reconnectFailureDelay);
 }
 
 bool WebSocketClient::receiveAndProcessMessage() {
     try {
-        unsigned char frameHeaderBytes[14];
-        int headerBytesRead = 0;
+        // One read pulls everything currently available; every complete frame in the buffer
+        // is then dispatched before returning, so bursts cost a single read call
+        int bytesReadValue = readIntoReceiveBuffer();
         
-        if (sslConnectionPointer) {
-            SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
-            headerBytesRead = SSL_read(sslConnectionPointerTyped, frameHeaderBytes, 2);
-            
-            if (headerBytesRead <= 0) {
-                int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, headerBytesRead);
-                if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
-                    return false;
-                } else if (sslErrorCode == SSL_ERROR_ZERO_RETURN) {
-                    try {
-                        WebSocketLogs::log_websocket_message_details("SSL_CLOSED", 
-                            "SSL connection closed by server",
-                            "trading_system.log");
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                    connectedFlag.store(false);
-                    return false;
-                } else {
-                    unsigned long opensslErrorCode = ERR_get_error();
-                    char errorBuffer[512];
-                    try {
-                        if (opensslErrorCode != 0) {
-                            ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
-                            WebSocketLogs::log_websocket_message_details("SSL_READ_ERROR", 
-                                std::string("SSL read error: ") + errorBuffer + " (SSL_get_error: " + std::to_string(sslErrorCode) + ")",
-                                "trading_system.log");
-                        } else {
-                            WebSocketLogs::log_websocket_message_details("SSL_READ_ERROR", 
-                                "SSL read error: SSL_get_error=" + std::to_string(sslErrorCode) + ", bytesRead=" + std::to_string(headerBytesRead),
-                                "trading_system.log");
-                        }
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                    return false;
-                }
-            }
-        } else {
-            headerBytesRead = ::read(socketFileDescriptor, frameHeaderBytes, 2);
-            
-            if (headerBytesRead <= 0) {
-                if (headerBytesRead == 0) {
-                    try {
-                        WebSocketLogs::log_websocket_message_details("SOCKET_CLOSED", 
-                            "Socket connection closed by server",
-                            "trading_system.log");
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                    connectedFlag.store(false);
-                } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                    return false;
-                } else {
-                    try {
-                        WebSocketLogs::log_websocket_message_details("READ_ERROR", 
-                            "read() error: errno=" + std::to_string(errno) + " (" + strerror(errno) + ")",
-                            "trading_system.log");
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                }
-                return false;
-            }
+        size_t framesDeliveredCount = processBufferedFrames();
+        if (framesDeliveredCount > 0) {
+            return true;
         }
         
-        if (headerBytesRead < 2) {
-            try {
-                WebSocketLogs::log_websocket_frame_parse_error("Incomplete frame header", "trading_system.log");
-            } catch (...) {
-                // Logging failed, continue
-            }
-            return false;
-        }
+        return bytesReadValue > 0;
         
-        unsigned char opcodeValue = frameHeaderBytes[0] & 0x0F;
-        bool maskedFlag = (frameHeaderBytes[1] & 0x80) != 0;
-        unsigned long long payloadLengthValue = frameHeaderBytes[1] & 0x7F;
+    } catch (const std::exception& receiveExceptionError) {
+        try {
+            WebSocketLogs::log_websocket_receive_error(receiveExceptionError.what(), "trading_system.log");
+        } catch (...) {
+            // Logging failed, continue
+        }
+        return false;
+    } catch (...) {
+        try {
+            WebSocketLogs::log_websocket_receive_error("Unknown receive error", "trading_system.log");
+        } catch (...) {
+            // Logging failed, continue
+        }
+        return false;
+    }
+}
+
+int WebSocketClient::readIntoReceiveBuffer() {
+    // Compact consumed bytes to the front so the free tail is contiguous
+    if (receiveBufferReadOffsetValue > 0) {
+        size_t unconsumedBytesCount = receiveBufferWriteOffsetValue - receiveBufferReadOffsetValue;
+        if (unconsumedBytesCount > 0) {
+            std::memmove(receiveBufferBytes.data(), receiveBufferBytes.data() + receiveBufferReadOffsetValue, unconsumedBytesCount);
+        }
+        receiveBufferReadOffsetValue = 0;
+        receiveBufferWriteOffsetValue = unconsumedBytesCount;
+    }
+    
+    if (receiveBufferBytes.size() - receiveBufferWriteOffsetValue < receiveChunkSizeBytes) {
+        receiveBufferBytes.resize(receiveBufferWriteOffsetValue + receiveChunkSizeBytes);
+    }
+    
+    unsigned char* readDestinationPointer = receiveBufferBytes.data() + receiveBufferWriteOffsetValue;
+    int readCapacityValue = static_cast<int>(receiveBufferBytes.size() - receiveBufferWriteOffsetValue);
+    int bytesReadValue = 0;
+    
+    if (sslConnectionPointer) {
+        SSL* sslConnectionPointerTyped = static_cast<SSL*>(sslConnectionPointer);
+        bytesReadValue = SSL_read(sslConnectionPointerTyped, readDestinationPointer, readCapacityValue);
         
-        if (opcodeValue == 0x8) {
-            std::string closeReasonString = "Unknown reason";
-            try {
-                if (payloadLengthValue >= 2) {
-                    std::vector<unsigned char> closePayloadBytes(payloadLengthValue);
-                    int closeBytesRead = 0;
-                    if (sslConnectionPointer) {
-                        closeBytesRead = SSL_read(static_cast<SSL*>(sslConnectionPointer), closePayloadBytes.data(), static_cast<int>(payloadLengthValue));
-                    } else {
-                        closeBytesRead = ::read(socketFileDescriptor, closePayloadBytes.data(), static_cast<int>(payloadLengthValue));
-                    }
-                    
-                    if (closeBytesRead >= 2) {
-                        unsigned short closeCodeValue = (static_cast<unsigned short>(closePayloadBytes[0]) << 8) | closePayloadBytes[1];
-                        closeReasonString = "Close code: " + std::to_string(closeCodeValue);
-                        
-                        if (closeBytesRead > 2) {
-                            std::string closeMessageString(reinterpret_cast<const char*>(closePayloadBytes.data() + 2), closeBytesRead - 2);
-                            if (!closeMessageString.empty()) {
-                                closeReasonString += ", Message: " + closeMessageString;
-                            }
-                        }
-                    }
-                }
-                
-                WebSocketLogs::log_websocket_message_details("CLOSE_FRAME", 
-                    "Received WebSocket close frame - " + closeReasonString,
-                    "trading_system.log");
-            } catch (...) {
+        if (bytesReadValue <= 0) {
+            int sslErrorCode = SSL_get_error(sslConnectionPointerTyped, bytesReadValue);
+            if (sslErrorCode == SSL_ERROR_WANT_READ || sslErrorCode == SSL_ERROR_WANT_WRITE) {
+                // Renegotiation can make a read wait on writability
+                receiveWantsWriteFlag = (sslErrorCode == SSL_ERROR_WANT_WRITE);
+                return 0;
+            } else if (sslErrorCode == SSL_ERROR_ZERO_RETURN) {
                 try {
-                    WebSocketLogs::log_websocket_message_details("CLOSE_FRAME", 
-                        "Received WebSocket close frame (error reading close reason)",
+                    WebSocketLogs::log_websocket_message_details("SSL_CLOSED", 
+                        "SSL connection closed by server",
                         "trading_system.log");
                 } catch (...) {
                     // Logging failed, continue
                 }
-            }
-            // Cleanup connection resources before marking as disconnected
-            // This prevents connection accumulation when server closes connection
-            {
-                std::lock_guard<std::mutex> cleanupGuard(clientStateMutex);
+                connectedFlag.store(false);
+                return -1;
+            } else {
+                unsigned long opensslErrorCode = ERR_get_error();
+                char errorBuffer[512];
                 try {
-                    cleanupConnection();
+                    if (opensslErrorCode != 0) {
+                        ERR_error_string_n(opensslErrorCode, errorBuffer, sizeof(errorBuffer));
+                        WebSocketLogs::log_websocket_message_details("SSL_READ_ERROR", 
+                            std::string("SSL read error: ") + errorBuffer + " (SSL_get_error: " + std::to_string(sslErrorCode) + ")",
+                            "trading_system.log");
+                    } else {
+                        WebSocketLogs::log_websocket_message_details("SSL_READ_ERROR", 
+                            "SSL read error: SSL_get_error=" + std::to_string(sslErrorCode) + ", bytesRead=" + std::to_string(bytesReadValue),
+                            "trading_system.log");
+                    }
                 } catch (...) {
-                    // Ignore cleanup errors, continue
+                    // Logging failed, continue
                 }
+                // The TLS session is unusable after a fatal error
+                connectedFlag.store(false);
+                return -1;
             }
-            connectedFlag.store(false);
-            return false;
         }
+        receiveWantsWriteFlag = false;
+    } else {
+        bytesReadValue = static_cast<int>(::read(socketFileDescriptor, readDestinationPointer, readCapacityValue));
         
-        if (payloadLengthValue == 126) {
-            unsigned char lengthBytes[2];
-            int lengthBytesRead = 0;
-            if (sslConnectionPointer) {
-                lengthBytesRead = SSL_read(static_cast<SSL*>(sslConnectionPointer), lengthBytes, 2);
-            } else {
-                lengthBytesRead = ::read(socketFileDescriptor, lengthBytes, 2);
-            }
-            
-            if (lengthBytesRead != 2) {
+        if (bytesReadValue <= 0) {
+            if (bytesReadValue == 0) {
                 try {
-                    WebSocketLogs::log_websocket_frame_parse_error("Failed to read extended length", "trading_system.log");
+                    WebSocketLogs::log_websocket_message_details("SOCKET_CLOSED", 
+                        "Socket connection closed by server",
+                        "trading_system.log");
                 } catch (...) {
                     // Logging failed, continue
                 }
-                return false;
-            }
-            
-            payloadLengthValue = (static_cast<unsigned long long>(lengthBytes[0]) << 8) | lengthBytes[1];
-        } else if (payloadLengthValue == 127) {
-            unsigned char lengthBytes[8];
-            int lengthBytesRead = 0;
-            if (sslConnectionPointer) {
-                lengthBytesRead = SSL_read(static_cast<SSL*>(sslConnectionPointer), lengthBytes, 8);
+                connectedFlag.store(false);
+                return -1;
+            } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return 0;
             } else {
-                lengthBytesRead = ::read(socketFileDescriptor, lengthBytes, 8);
-            }
-            
-            if (lengthBytesRead != 8) {
                 try {
-                    WebSocketLogs::log_websocket_frame_parse_error("Failed to read extended length (64-bit)", "trading_system.log");
+                    WebSocketLogs::log_websocket_message_details("READ_ERROR", 
+                        "read() error: errno=" + std::to_string(errno) + " (" + strerror(errno) + ")",
+                        "trading_system.log");
                 } catch (...) {
                     // Logging failed, continue
                 }
-                return false;
+                connectedFlag.store(false);
+                return -1;
+            }
+        }
+    }
+    
+    receiveBufferWriteOffsetValue += static_cast<size_t>(bytesReadValue);
+    return bytesReadValue;
+}
+
+size_t WebSocketClient::processBufferedFrames() {
+    size_t framesDeliveredCount = 0;
+    
+    while (receiveBufferWriteOffsetValue - receiveBufferReadOffsetValue >= 2) {
+        unsigned char* frameStartPointer = receiveBufferBytes.data() + receiveBufferReadOffsetValue;
+        size_t availableBytesCount = receiveBufferWriteOffsetValue - receiveBufferReadOffsetValue;
+        
+        unsigned char opcodeValue = frameStartPointer[0] & 0x0F;
+        bool maskedFlag = (frameStartPointer[1] & 0x80) != 0;
+        unsigned long long payloadLengthValue = frameStartPointer[1] & 0x7F;
+        size_t headerLengthValue = 2;
+        
+        if (payloadLengthValue == 126) {
+            headerLengthValue += 2;
+            if (availableBytesCount < headerLengthValue) {
+                break;
+            }
+            payloadLengthValue = (static_cast<unsigned long long>(frameStartPointer[2]) << 8) | frameStartPointer[3];
+        } else if (payloadLengthValue == 127) {
+            headerLengthValue += 8;
+            if (availableBytesCount < headerLengthValue) {
+                break;
             }
-            
             payloadLengthValue = 0;
             for (int i = 0; i < 8; ++i) {
-                payloadLengthValue = (payloadLengthValue << 8) | lengthBytes[i];
+                payloadLengthValue = (payloadLengthValue << 8) | frameStartPointer[2 + i];
             }
         }
         
-        unsigned char maskingKeyBytes[4];
-        if (maskedFlag) {
-            int maskingKeyBytesRead = 0;
-            if (sslConnectionPointer) {
-                maskingKeyBytesRead = SSL_read(static_cast<SSL*>(sslConnectionPointer), maskingKeyBytes, 4);
-            } else {
-                maskingKeyBytesRead = ::read(socketFileDescriptor, maskingKeyBytes, 4);
-            }
-            
-            if (maskingKeyBytesRead != 4) {
-                try {
-                    WebSocketLogs::log_websocket_frame_parse_error("Failed to read masking key", "trading_system.log");
-                } catch (...) {
-                    // Logging failed, continue
-                }
-                return false;
+        if (payloadLengthValue > maximumFramePayloadBytes) {
+            try {
+                WebSocketLogs::log_websocket_frame_parse_error("Frame payload length " + std::to_string(payloadLengthValue) + " exceeds limit", "trading_system.log");
+            } catch (...) {
+                // Logging failed, continue
             }
+            // Stream position is unrecoverable, force a reconnect
+            resetReceiveBuffer();
+            connectedFlag.store(false);
+            return framesDeliveredCount;
         }
         
-        std::vector<unsigned char> payloadBuffer(payloadLengthValue);
-        size_t totalBytesRead = 0;
+        const unsigned char* maskingKeyPointer = nullptr;
+        if (maskedFlag) {
+            maskingKeyPointer = frameStartPointer + headerLengthValue;
+            headerLengthValue += 4;
+        }
         
-        while (totalBytesRead < payloadLengthValue) {
-            int bytesRead = 0;
-            if (sslConnectionPointer) {
-                bytesRead = SSL_read(static_cast<SSL*>(sslConnectionPointer), 
-                                   payloadBuffer.data() + totalBytesRead, 
-                                   static_cast<int>(payloadLengthValue - totalBytesRead));
-            } else {
-                bytesRead = ::read(socketFileDescriptor, 
-                                 payloadBuffer.data() + totalBytesRead, 
-                                 static_cast<int>(payloadLengthValue - totalBytesRead));
-            }
-            
-            if (bytesRead <= 0) {
-                try {
-                    WebSocketLogs::log_websocket_frame_parse_error("Failed to read payload", "trading_system.log");
-                } catch (...) {
-                    // Logging failed, continue
-                }
-                return false;
+        size_t frameLengthValue = headerLengthValue + static_cast<size_t>(payloadLengthValue);
+        if (availableBytesCount < frameLengthValue) {
+            // Partial frame, make sure the next read has room for the remainder
+            if (receiveBufferBytes.size() - receiveBufferReadOffsetValue < frameLengthValue) {
+                receiveBufferBytes.resize(receiveBufferReadOffsetValue + frameLengthValue);
             }
-            
-            totalBytesRead += bytesRead;
+            break;
         }
         
-        if (maskedFlag) {
+        unsigned char* payloadPointer = frameStartPointer + headerLengthValue;
+        if (maskingKeyPointer) {
             for (size_t i = 0; i < payloadLengthValue; ++i) {
-                payloadBuffer[i] ^= maskingKeyBytes[i % 4];
+                payloadPointer[i] ^= maskingKeyPointer[i % 4];
             }
         }
         
-        std::string messageString(payloadBuffer.begin(), payloadBuffer.end());
+        receiveBufferReadOffsetValue += frameLengthValue;
         
-        if (!messageString.empty()) {
-            if (messageCallbackFunction) {
-                bool callbackResult = false;
-                try {
-                    callbackResult = messageCallbackFunction(messageString);
-                } catch (const std::exception& callbackExceptionError) {
-                    try {
-                        WebSocketLogs::log_websocket_message_details("CALLBACK_EXCEPTION", 
-                            "Exception in message callback: " + std::string(callbackExceptionError.what()),
-                            "trading_system.log");
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                    callbackResult = false;
-                } catch (...) {
-                    try {
-                        WebSocketLogs::log_websocket_message_details("CALLBACK_UNKNOWN_EXCEPTION", 
-                            "Unknown exception in message callback",
-                            "trading_system.log");
-                    } catch (...) {
-                        // Logging failed, continue
+        if (opcodeValue == 0x8) {
+            std::string closeReasonString = "Unknown reason";
+            try {
+                if (payloadLengthValue >= 2) {
+                    unsigned short closeCodeValue = (static_cast<unsigned short>(payloadPointer[0]) << 8) | payloadPointer[1];
+                    closeReasonString = "Close code: " + std::to_string(closeCodeValue);
+                    
+                    if (payloadLengthValue > 2) {
+                        std::string closeMessageString(reinterpret_cast<const char*>(payloadPointer + 2), static_cast<size_t>(payloadLengthValue - 2));
+                        if (!closeMessageString.empty()) {
+                            closeReasonString += ", Message: " + closeMessageString;
+                        }
                     }
-                    callbackResult = false;
                 }
                 
-                if (!callbackResult) {
-                    try {
-                        WebSocketLogs::log_websocket_message_details("CALLBACK_FAILED", 
-                            "Message callback returned false for message: " + messageString.substr(0, 100),
-                            "trading_system.log");
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                } else {
-                    try {
-                        // "Message received" log removed to reduce log noise
-                    } catch (...) {
-                        // Logging failed, continue
-                    }
-                }
-            } else {
+                WebSocketLogs::log_websocket_message_details("CLOSE_FRAME", 
+                    "Received WebSocket close frame - " + closeReasonString,
+                    "trading_system.log");
+            } catch (...) {
                 try {
-                    WebSocketLogs::log_websocket_message_details("NO_CALLBACK", 
-                        "Message received but no callback function set. Message: " + messageString.substr(0, 100),
+                    WebSocketLogs::log_websocket_message_details("CLOSE_FRAME", 
+                        "Received WebSocket close frame (error reading close reason)",
                         "trading_system.log");
                 } catch (...) {
                     // Logging failed, continue
                 }
             }
+            // Cleanup connection resources before marking as disconnected
+            // This prevents connection accumulation when server closes connection
+            {
+                std::lock_guard<std::mutex> cleanupGuard(clientStateMutex);
+                try {
+                    cleanupConnection();
+                } catch (...) {
+                    // Ignore cleanup errors, continue
+                }
+            }
+            connectedFlag.store(false);
+            return framesDeliveredCount;
         }
         
-        return true;
-        
-    } catch (const std::exception& receiveExceptionError) {
+        // Reuse the message string capacity across frames to avoid a fresh allocation per message
+        receivedMessageStringValue.assign(reinterpret_cast<const char*>(payloadPointer), static_cast<size_t>(payloadLengthValue));
+        deliverMessageToCallback(receivedMessageStringValue);
+        framesDeliveredCount++;
+    }
+    
+    if (receiveBufferReadOffsetValue == receiveBufferWriteOffsetValue) {
+        receiveBufferReadOffsetValue = 0;
+        receiveBufferWriteOffsetValue = 0;
+    }
+    
+    return framesDeliveredCount;
+}
+
+void WebSocketClient::deliverMessageToCallback(const std::string& messageString) {
+    if (messageString.empty()) {
+        return;
+    }
+    
+    if (messageCallbackFunction) {
+        bool callbackResult = false;
         try {
-            WebSocketLogs::log_websocket_receive_error(receiveExceptionError.what(), "trading_system.log");
+            callbackResult = messageCallbackFunction(messageString);
+        } catch (const std::exception& callbackExceptionError) {
+            try {
+                WebSocketLogs::log_websocket_message_details("CALLBACK_EXCEPTION", 
+                    "Exception in message callback: " + std::string(callbackExceptionError.what()),
+                    "trading_system.log");
+            } catch (...) {
+                // Logging failed, continue
+            }
+            callbackResult = false;
         } catch (...) {
-            // Logging failed, continue
+            try {
+                WebSocketLogs::log_websocket_message_details("CALLBACK_UNKNOWN_EXCEPTION", 
+                    "Unknown exception in message callback",
+                    "trading_system.log");
+            } catch (...) {
+                // Logging failed, continue
+            }
+            callbackResult = false;
         }
-        return false;
-    } catch (...) {
+        
+        if (!callbackResult) {
+            try {
+                WebSocketLogs::log_websocket_message_details("CALLBACK_FAILED", 
+                    "Message callback returned false for message: " + messageString.substr(0, 100),
+                    "trading_system.log");
+            } catch (...) {
+                // Logging failed, continue
+            }
+        }
+    } else {
         try {
-            WebSocketLogs::log_websocket_receive_error("Unknown receive error", "trading_system.log");
+            WebSocketLogs::log_websocket_message_details("NO_CALLBACK", 
+                "Message received but no callback function set. Message: " + messageString.substr(0, 100),
+                "trading_system.log");
         } catch (...) {
             // Logging failed, continue
         }
-        return false;
     }
 }
 
+void WebSocketClient::resetReceiveBuffer() {
+    receiveBufferReadOffsetValue = 0;
+    receiveBufferWriteOffsetValue = 0;
+}
+
 std::string WebSocketClient::base64Encode(const std::string& inputDataString) {
     static const std::string base64Chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     
@@ -1367,6 +1536,22 @@ std::vector<unsigned char> WebSocketClient::generateRandomBytes(size_t byteCount
 
 void WebSocketClient::cleanupConnection() {
     try {
+        // Buffered bytes belong to the old stream and must not leak into a new connection
+        resetReceiveBuffer();
+        receiveWantsWriteFlag = false;
+        clearPendingSends();
+        connectionGenerationValue.fetch_add(1);
+        
+        // An abandoned setup drops its lookup; a lookup thread still running frees the result itself
+        connectionSetupPhase = ConnectionSetupPhase::IDLE;
+        connectionSetupWantsWriteFlag = false;
+        addressResolutionPointer.reset();
+        nextResolvedAddressPointer = nullptr;
+        upgradeRequestString.clear();
+        upgradeRequestBytesSentValue = 0;
+        upgradeResponseString.clear();
+        upgradeExpectedAcceptString.clear();
+        
         // Cleanup SSL connection - check if pointer is valid before freeing
         void* sslConnectionToFree = sslConnectionPointer;
         if (sslConnectionToFree) {
@@ -5,23 +5,28 @@
 #include <functional>
 #include <atomic>
 #include <mutex>
-#include <thread>
 #include <vector>
+#include <memory>
+#include <chrono>
+
+struct addrinfo;
 
 namespace AlpacaTrader {
-namespace Logging {
-struct LoggingContext;
-} // namespace Logging
 namespace API {
 namespace Polygon {
 
+class WebSocketReactor;
+
 class WebSocketClient {
 public:
     using MessageCallback = std::function<bool(const std::string& message)>;
+    using TimerCallback = std::function<void()>;
     
     WebSocketClient();
     ~WebSocketClient();
     
+    // Blocks the calling thread until the connection is up or failed; reconnects made by the
+    // reactor run the same steps without blocking, driven by socket readiness
     bool connect(const std::string& websocketUrlString);
     void disconnect();
     bool isConnected() const;
@@ -29,29 +34,61 @@ public:
     bool authenticate(const std::string& apiKeyString);
     bool subscribe(const std::string& subscriptionParamsString);
     bool unsubscribe(const std::string& subscriptionParamsString);
+    // Replaces the subscription from any thread; the reactor thread sends it, so it never races the receive path
+    void requestSubscription(const std::string& subscriptionParamsString);
     
     void setMessageCallback(MessageCallback callbackFunction);
+    // Invoked on the reactor thread every interval while the receive loop runs, connected or not
+    void setPeriodicTimerCallback(TimerCallback callbackFunction, std::chrono::milliseconds intervalDuration);
     
+    // Once the receive loop runs, frames are queued and the reactor writes them when the socket is writable
     bool sendMessage(const std::string& messageContent);
     
+    // Use a reactor shared with other clients; a private one is created on start otherwise
+    void setReactor(std::shared_ptr<WebSocketReactor> reactorPointer);
+    
     void startReceiveLoop();
     void stopReceiveLoop();
     
     std::string getLastError() const;
 
 private:
+    friend class WebSocketReactor;
+    
+    // Connection setup steps, in order; IDLE when no setup is in progress
+    enum class ConnectionSetupPhase {
+        IDLE,
+        RESOLVING,
+        TCP_CONNECTING,
+        TLS_HANDSHAKING,
+        UPGRADE_SENDING,
+        UPGRADE_RECEIVING
+    };
+    
+    enum class ConnectionSetupStepResult {
+        WAITING,        // Needs socket readiness (or the lookup) before it can continue
+        COMPLETE,
+        FAILED
+    };
+    
+    // Host lookup result, shared with the lookup thread so an abandoned attempt cleans up after itself
+    struct AddressResolution;
+    
     std::string websocketUrlStringValue;
     std::string apiKeyStringValue;
     std::string subscriptionParamsStringValue;
     MessageCallback messageCallbackFunction;
+    TimerCallback periodicTimerCallbackFunction;
+    std::chrono::milliseconds periodicTimerIntervalDuration;
     
-    Logging::LoggingContext* parentLoggingContextPointer;
+    std::shared_ptr<WebSocketReactor> websocketReactorPointer;
     
     std::atomic<bool> connectedFlag;
     std::atomic<bool> shouldReceiveLoopContinue;
+    std::atomic<unsigned long> connectionGenerationValue;
+    std::atomic<bool> subscriptionRequestedFlag;
     
     mutable std::mutex clientStateMutex;
-    std::thread receiveLoopThread;
     
     std::string lastErrorStringValue;
     
@@ -59,11 +96,51 @@ private:
     void* sslContextPointer;
     void* sslConnectionPointer;
     
-    bool establishTcpConnection();
-    bool performSslHandshake();
-    bool performWebSocketHandshake();
-    void receiveLoopWorker();
+    std::vector<unsigned char> receiveBufferBytes;
+    size_t receiveBufferReadOffsetValue;
+    size_t receiveBufferWriteOffsetValue;
+    std::string receivedMessageStringValue;
+    bool receiveWantsWriteFlag;
+    
+    // Frames not yet written; the reactor owns the socket while the receive loop runs
+    std::vector<unsigned char> pendingSendBytes;
+    size_t pendingSendOffsetValue;
+    std::atomic<bool> sendPendingFlag;
+    bool sendWaitsForReadFlag;
+    
+    // Connection setup state, touched by connect() before the loop starts and by the reactor afterwards
+    ConnectionSetupPhase connectionSetupPhase;
+    bool connectionSetupWantsWriteFlag;
+    std::chrono::steady_clock::time_point connectionSetupDeadlineTimePoint;
+    std::shared_ptr<AddressResolution> addressResolutionPointer;
+    struct addrinfo* nextResolvedAddressPointer;
+    std::string upgradeRequestString;
+    size_t upgradeRequestBytesSentValue;
+    std::string upgradeResponseString;
+    std::string upgradeExpectedAcceptString;
+    
+    // Reactor timer state, only touched from the reactor thread once the loop is started
+    bool reconnectScheduledFlag;
+    bool reconnectSetupInProgressFlag;
+    std::chrono::steady_clock::time_point reconnectDeadlineTimePoint;
+    bool subscriptionPendingFlag;
+    std::chrono::steady_clock::time_point subscriptionDeadlineTimePoint;
+    std::chrono::steady_clock::time_point periodicTimerDeadlineTimePoint;
+    
+    bool beginConnectionSetup(const std::string& websocketUrlString, bool resolveInBackgroundFlag);
+    static void resolveAddresses(AddressResolution& addressResolution, const std::string& hostnameString, const std::string& portString);
+    ConnectionSetupStepResult advanceConnectionSetup();
+    ConnectionSetupStepResult advanceAddressResolution();
+    ConnectionSetupStepResult advanceTcpConnection();
+    ConnectionSetupStepResult advanceSslHandshake();
+    ConnectionSetupStepResult advanceUpgradeRequest();
+    ConnectionSetupStepResult advanceUpgradeResponse();
+    bool waitForConnectionSetupReadiness();
     bool receiveAndProcessMessage();
+    int readIntoReceiveBuffer();
+    size_t processBufferedFrames();
+    void deliverMessageToCallback(const std::string& messageString);
+    void resetReceiveBuffer();
     std::string base64Encode(const std::string& inputDataString);
     std::string sha1Hash(const std::string& inputDataString);
     std::vector<unsigned char> generateRandomBytes(size_t byteCount);
@@ -75,6 +152,20 @@ private:
     std::string extractPath(const std::string& urlString) const;
     
     bool sendMessageInternal(const std::string& messageContent);
+    bool flushPendingSends();
+    bool flushPendingSendsBlocking();
+    void clearPendingSends();
+    
+    int getReactorSocketFileDescriptor() const;
+    unsigned long getConnectionGeneration() const;
+    bool isWaitingForWriteReadiness() const;
+    void handleSocketReadiness();
+    bool getNextTimerDeadline(std::chrono::steady_clock::time_point& deadlineTimePoint) const;
+    void handleTimerExpiry(std::chrono::steady_clock::time_point currentTimePoint);
+    void scheduleReconnect(std::chrono::steady_clock::time_point deadlineTimePoint);
+    void attemptReconnect();
+    void advanceReconnect();
+    void finishReconnect(ConnectionSetupStepResult setupResult);
 };
 
 } // namespace Polygon
@@ -0,0 +1,411 @@
+#include "websocket_reactor.hpp"
+#include "websocket_client.hpp"
+#include "logging/logs/websocket_logs.hpp"
+#include "logging/logger/async_logger.hpp"
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#include <cstring>
+#include <chrono>
+#include <iostream>
+#ifdef __linux__
+#include <sys/epoll.h>
+#else
+#include <poll.h>
+#endif
+
+using AlpacaTrader::Logging::WebSocketLogs;
+
+namespace AlpacaTrader {
+namespace API {
+namespace Polygon {
+
+namespace {
+const int maximumReadyEventsPerWait = 64;
+// Upper bound on a single wait so connection state changed from other threads is picked up
+const int maximumReactorWaitMilliseconds = 1000;
+} // namespace
+
+WebSocketReactor::WebSocketReactor()
+    : reactorRunningFlag(false)
+    , parentLoggingContextPointer(nullptr)
+    , pollingFileDescriptor(-1)
+    , wakeupPipeReadFileDescriptor(-1)
+    , wakeupPipeWriteFileDescriptor(-1)
+{
+}
+
+WebSocketReactor::~WebSocketReactor() {
+    try {
+        stop();
+    } catch (...) {
+        // Ignore shutdown errors in destructor
+    }
+}
+
+bool WebSocketReactor::start() {
+    std::lock_guard<std::mutex> stateGuard(reactorStateMutex);
+
+    if (reactorRunningFlag.load()) {
+        return true;
+    }
+
+    try {
+        int wakeupPipeFileDescriptors[2];
+        if (::pipe(wakeupPipeFileDescriptors) != 0) {
+            WebSocketLogs::log_websocket_receive_error(std::string("Reactor wakeup pipe creation failed: ") + strerror(errno), "trading_system.log");
+            return false;
+        }
+        wakeupPipeReadFileDescriptor = wakeupPipeFileDescriptors[0];
+        wakeupPipeWriteFileDescriptor = wakeupPipeFileDescriptors[1];
+        fcntl(wakeupPipeReadFileDescriptor, F_SETFL, fcntl(wakeupPipeReadFileDescriptor, F_GETFL, 0) | O_NONBLOCK);
+        fcntl(wakeupPipeWriteFileDescriptor, F_SETFL, fcntl(wakeupPipeWriteFileDescriptor, F_GETFL, 0) | O_NONBLOCK);
+
+#ifdef __linux__
+        pollingFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+        if (pollingFileDescriptor < 0) {
+            WebSocketLogs::log_websocket_receive_error(std::string("epoll_create1 failed: ") + strerror(errno), "trading_system.log");
+            closeReactorDescriptors();
+            return false;
+        }
+
+        struct epoll_event wakeupEventStruct;
+        wakeupEventStruct.events = EPOLLIN;
+        wakeupEventStruct.data.fd = wakeupPipeReadFileDescriptor;
+        if (epoll_ctl(pollingFileDescriptor, EPOLL_CTL_ADD, wakeupPipeReadFileDescriptor, &wakeupEventStruct) != 0) {
+            WebSocketLogs::log_websocket_receive_error(std::string("epoll_ctl for wakeup pipe failed: ") + strerror(errno), "trading_system.log");
+            closeReactorDescriptors();
+            return false;
+        }
+#endif
+
+        try {
+            parentLoggingContextPointer = AlpacaTrader::Logging::get_logging_context();
+        } catch (...) {
+            parentLoggingContextPointer = nullptr;
+        }
+
+        reactorRunningFlag.store(true);
+        reactorThread = std::thread(&WebSocketReactor::reactorLoopWorker, this);
+        return true;
+
+    } catch (const std::exception& startExceptionError) {
+        reactorRunningFlag.store(false);
+        closeReactorDescriptors();
+        try {
+            WebSocketLogs::log_websocket_receive_error(std::string("Reactor start failed: ") + startExceptionError.what(), "trading_system.log");
+        } catch (...) {
+            // Logging failed, continue
+        }
+        return false;
+    }
+}
+
+void WebSocketReactor::stop() {
+    if (!reactorRunningFlag.exchange(false)) {
+        return;
+    }
+
+    wakeReactor();
+
+    if (reactorThread.joinable()) {
+        reactorThread.join();
+    }
+
+    std::lock_guard<std::mutex> stateGuard(reactorStateMutex);
+    for (WebSocketClient* clientPointer : registeredClientPointers) {
+        clientRegistrationStateMap[clientPointer] = ClientRegistrationState{-1, 0, false};
+    }
+    socketFileDescriptorClientMap.clear();
+    closeReactorDescriptors();
+}
+
+bool WebSocketReactor::isRunning() const {
+    return reactorRunningFlag.load();
+}
+
+bool WebSocketReactor::registerClient(WebSocketClient* clientPointer) {
+    if (!clientPointer) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> stateGuard(reactorStateMutex);
+        for (WebSocketClient* registeredClientPointer : registeredClientPointers) {
+            if (registeredClientPointer == clientPointer) {
+                return true;
+            }
+        }
+        registeredClientPointers.push_back(clientPointer);
+        clientRegistrationStateMap[clientPointer] = ClientRegistrationState{-1, 0, false};
+    }
+
+    wakeReactor();
+    return true;
+}
+
+void WebSocketReactor::unregisterClient(WebSocketClient* clientPointer) {
+    // Taking the state mutex waits out any dispatch in progress for this client
+    std::lock_guard<std::mutex> stateGuard(reactorStateMutex);
+
+    for (auto clientIterator = registeredClientPointers.begin(); clientIterator != registeredClientPointers.end(); ++clientIterator) {
+        if (*clientIterator == clientPointer) {
+            registeredClientPointers.erase(clientIterator);
+            break;
+        }
+    }
+
+    auto registrationIterator = clientRegistrationStateMap.find(clientPointer);
+    if (registrationIterator != clientRegistrationStateMap.end()) {
+        int registeredSocketFileDescriptor = registrationIterator->second.registeredSocketFileDescriptor;
+        if (registeredSocketFileDescriptor >= 0) {
+            removeSocketFromPolling(registeredSocketFileDescriptor);
+            socketFileDescriptorClientMap.erase(registeredSocketFileDescriptor);
+        }
+        clientRegistrationStateMap.erase(registrationIterator);
+    }
+}
+
+void WebSocketReactor::wakeReactor() {
+    if (wakeupPipeWriteFileDescriptor >= 0) {
+        unsigned char wakeupByte = 1;
+        ssize_t bytesWritten = ::write(wakeupPipeWriteFileDescriptor, &wakeupByte, 1);
+        (void)bytesWritten; // Pipe already full means a wakeup is pending
+    }
+}
+
+void WebSocketReactor::reactorLoopWorker() {
+    if (parentLoggingContextPointer) {
+        try {
+            AlpacaTrader::Logging::set_logging_context(*parentLoggingContextPointer);
+            AlpacaTrader::Logging::set_log_thread_tag("WS    ");
+        } catch (const std::exception& setContextExceptionError) {
+            std::cerr << "WARNING: WebSocket reactor could not set logging context: " << setContextExceptionError.what() << " - continuing without logging context" << std::endl;
+        } catch (...) {
+            std::cerr << "WARNING: WebSocket reactor could not set logging context - continuing without logging context" << std::endl;
+        }
+    } else {
+        std::cerr << "WebSocket reactor started (no logging context available from parent thread)" << std::endl;
+    }
+
+    while (reactorRunningFlag.load()) {
+        try {
+            int waitTimeoutMilliseconds = 0;
+            {
+                std::lock_guard<std::mutex> stateGuard(reactorStateMutex);
+                synchronizeClientRegistrations();
+                waitTimeoutMilliseconds = computeWaitTimeoutMilliseconds();
+            }
+
+            waitAndDispatchReadiness(waitTimeoutMilliseconds);
+
+            {
+                std::lock_guard<std::mutex> stateGuard(reactorStateMutex);
+                dispatchClientTimers();
+            }
+        } catch (const std::exception& reactorExceptionError) {
+            try {
+                WebSocketLogs::log_websocket_receive_error(std::string("Reactor loop error: ") + reactorExceptionError.what(), "trading_system.log");
+            } catch (...) {
+                std::cerr << "WebSocket reactor loop error: " << reactorExceptionError.what() << std::endl;
+            }
+        } catch (...) {
+            try {
+                WebSocketLogs::log_websocket_receive_error("Unknown reactor loop error", "trading_system.log");
+            } catch (...) {
+                std::cerr << "WebSocket reactor loop unknown error" << std::endl;
+            }
+        }
+    }
+
+    try {
+        WebSocketLogs::log_websocket_receive_loop_table("RECEIVE_LOOP", "WebSocket reactor stopped", "trading_system.log");
+    } catch (...) {
+        std::cerr << "WebSocket reactor stopped" << std::endl;
+    }
+}
+
+void WebSocketReactor::synchronizeClientRegistrations() {
+    socketFileDescriptorClientMap.clear();
+
+    for (WebSocketClient* clientPointer : registeredClientPointers) {
+        int currentSocketFileDescriptor = clientPointer->getReactorSocketFileDescriptor();
+        unsigned long currentConnectionGenerationValue = clientPointer->getConnectionGeneration();
+        bool currentWantsWriteFlag = clientPointer->isWaitingForWriteReadiness();
+
+        ClientRegistrationState& registrationState = clientRegistrationStateMap[clientPointer];
+
+        // A reconnect can hand back the same descriptor number, so the generation is compared too
+        bool registrationChangedFlag = registrationState.registeredSocketFileDescriptor != currentSocketFileDescriptor ||
+                                       registrationState.registeredConnectionGenerationValue != currentConnectionGenerationValue ||
+                                       registrationState.registeredForWriteFlag != currentWantsWriteFlag;
+
+        if (registrationChangedFlag) {
+            if (registrationState.registeredSocketFileDescriptor >= 0) {
+                removeSocketFromPolling(registrationState.registeredSocketFileDescriptor);
+            }
+
+#ifdef __linux__
+            if (currentSocketFileDescriptor >= 0) {
+                struct epoll_event socketEventStruct;
+                socketEventStruct.events = EPOLLIN | EPOLLRDHUP;
+                if (currentWantsWriteFlag) {
+                    socketEventStruct.events |= EPOLLOUT;
+                }
+                socketEventStruct.data.fd = currentSocketFileDescriptor;
+                if (epoll_ctl(pollingFileDescriptor, EPOLL_CTL_ADD, currentSocketFileDescriptor, &socketEventStruct) != 0 && errno == EEXIST) {
+                    epoll_ctl(pollingFileDescriptor, EPOLL_CTL_MOD, currentSocketFileDescriptor, &socketEventStruct);
+                }
+            }
+#endif
+
+            registrationState.registeredSocketFileDescriptor = currentSocketFileDescriptor;
+            registrationState.registeredConnectionGenerationValue = currentConnectionGenerationValue;
+            registrationState.registeredForWriteFlag = currentWantsWriteFlag;
+        }
+
+        if (currentSocketFileDescriptor >= 0) {
+            socketFileDescriptorClientMap[currentSocketFileDescriptor] = clientPointer;
+        }
+    }
+}
+
+int WebSocketReactor::computeWaitTimeoutMilliseconds() const {
+    auto currentTime = std::chrono::steady_clock::now();
+    long long waitTimeoutMilliseconds = maximumReactorWaitMilliseconds;
+
+    for (WebSocketClient* clientPointer : registeredClientPointers) {
+        std::chrono::steady_clock::time_point clientDeadlineTimePoint;
+        if (clientPointer->getNextTimerDeadline(clientDeadlineTimePoint)) {
+            if (clientDeadlineTimePoint <= currentTime) {
+                return 0;
+            }
+            // Round up so the wait never ends just before the deadline
+            long long untilDeadlineMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(clientDeadlineTimePoint - currentTime + std::chrono::microseconds(999)).count();
+            if (untilDeadlineMilliseconds < waitTimeoutMilliseconds) {
+                waitTimeoutMilliseconds = untilDeadlineMilliseconds;
+            }
+        }
+    }
+
+    return static_cast<int>(waitTimeoutMilliseconds);
+}
+
+void WebSocketReactor::waitAndDispatchReadiness(int waitTimeoutMilliseconds) {
+    std::vector<int> readySocketFileDescriptors;
+
+#ifdef __linux__
+    struct epoll_event readyEventStructs[maximumReadyEventsPerWait];
+    int readyEventCount = epoll_wait(pollingFileDescriptor, readyEventStructs, maximumReadyEventsPerWait, waitTimeoutMilliseconds);
+    if (readyEventCount < 0) {
+        if (errno != EINTR) {
+            WebSocketLogs::log_websocket_receive_error(std::string("epoll_wait failed: ") + strerror(errno), "trading_system.log");
+        }
+        return;
+    }
+
+    for (int eventIndex = 0; eventIndex < readyEventCount; ++eventIndex) {
+        int readyFileDescriptor = readyEventStructs[eventIndex].data.fd;
+        if (readyFileDescriptor == wakeupPipeReadFileDescriptor) {
+            drainWakeupPipe();
+        } else {
+            readySocketFileDescriptors.push_back(readyFileDescriptor);
+        }
+    }
+#else
+    std::vector<struct pollfd> pollFileDescriptorStructs;
+    {
+        std::lock_guard<std::mutex> stateGuard(reactorStateMutex);
+        pollFileDescriptorStructs.reserve(socketFileDescriptorClientMap.size() + 1);
+        pollFileDescriptorStructs.push_back(pollfd{wakeupPipeReadFileDescriptor, POLLIN, 0});
+        for (const auto& socketClientEntry : socketFileDescriptorClientMap) {
+            short requestedEvents = POLLIN;
+            auto registrationIterator = clientRegistrationStateMap.find(socketClientEntry.second);
+            if (registrationIterator != clientRegistrationStateMap.end() && registrationIterator->second.registeredForWriteFlag) {
+                requestedEvents |= POLLOUT;
+            }
+            pollFileDescriptorStructs.push_back(pollfd{socketClientEntry.first, requestedEvents, 0});
+        }
+    }
+
+    int readyEventCount = ::poll(pollFileDescriptorStructs.data(), static_cast<nfds_t>(pollFileDescriptorStructs.size()), waitTimeoutMilliseconds);
+    if (readyEventCount < 0) {
+        if (errno != EINTR) {
+            WebSocketLogs::log_websocket_receive_error(std::string("poll failed: ") + strerror(errno), "trading_system.log");
+        }
+        return;
+    }
+
+    for (const struct pollfd& pollFileDescriptorStruct : pollFileDescriptorStructs) {
+        if (pollFileDescriptorStruct.revents == 0) {
+            continue;
+        }
+        if (pollFileDescriptorStruct.fd == wakeupPipeReadFileDescriptor) {
+            drainWakeupPipe();
+        } else {
+            readySocketFileDescriptors.push_back(pollFileDescriptorStruct.fd);
+        }
+    }
+#endif
+
+    if (readySocketFileDescriptors.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> stateGuard(reactorStateMutex);
+    for (int readyFileDescriptor : readySocketFileDescriptors) {
+        // Client may have been unregistered while the wait was in progress
+        auto clientIterator = socketFileDescriptorClientMap.find(readyFileDescriptor);
+        if (clientIterator == socketFileDescriptorClientMap.end()) {
+            continue;
+        }
+        clientIterator->second->handleSocketReadiness();
+    }
+}
+
+void WebSocketReactor::dispatchClientTimers() {
+    auto currentTime = std::chrono::steady_clock::now();
+
+    for (WebSocketClient* clientPointer : registeredClientPointers) {
+        std::chrono::steady_clock::time_point clientDeadlineTimePoint;
+        if (clientPointer->getNextTimerDeadline(clientDeadlineTimePoint) && clientDeadlineTimePoint <= currentTime) {
+            clientPointer->handleTimerExpiry(currentTime);
+        }
+    }
+}
+
+void WebSocketReactor::drainWakeupPipe() {
+    unsigned char drainBuffer[64];
+    while (::read(wakeupPipeReadFileDescriptor, drainBuffer, sizeof(drainBuffer)) > 0) {
+    }
+}
+
+void WebSocketReactor::removeSocketFromPolling(int socketFileDescriptorValue) {
+#ifdef __linux__
+    if (pollingFileDescriptor >= 0) {
+        // Fails harmlessly when the descriptor was already closed, which drops it from epoll
+        epoll_ctl(pollingFileDescriptor, EPOLL_CTL_DEL, socketFileDescriptorValue, nullptr);
+    }
+#else
+    (void)socketFileDescriptorValue;
+#endif
+}
+
+void WebSocketReactor::closeReactorDescriptors() {
+    if (pollingFileDescriptor >= 0) {
+        ::close(pollingFileDescriptor);
+        pollingFileDescriptor = -1;
+    }
+    if (wakeupPipeReadFileDescriptor >= 0) {
+        ::close(wakeupPipeReadFileDescriptor);
+        wakeupPipeReadFileDescriptor = -1;
+    }
+    if (wakeupPipeWriteFileDescriptor >= 0) {
+        ::close(wakeupPipeWriteFileDescriptor);
+        wakeupPipeWriteFileDescriptor = -1;
+    }
+}
+
+} // namespace Polygon
+} // namespace API
+} // namespace AlpacaTrader
@@ -0,0 +1,74 @@
+#ifndef WEBSOCKET_REACTOR_HPP
+#define WEBSOCKET_REACTOR_HPP
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+
+namespace AlpacaTrader {
+namespace Logging {
+struct LoggingContext;
+} // namespace Logging
+namespace API {
+namespace Polygon {
+
+class WebSocketClient;
+
+// Single I/O thread that waits on socket readiness (epoll on Linux, poll elsewhere)
+// and on client timer deadlines, and drives any number of WebSocketClient connections.
+class WebSocketReactor {
+public:
+    WebSocketReactor();
+    ~WebSocketReactor();
+
+    WebSocketReactor(const WebSocketReactor&) = delete;
+    WebSocketReactor& operator=(const WebSocketReactor&) = delete;
+
+    bool start();
+    void stop();
+    bool isRunning() const;
+
+    bool registerClient(WebSocketClient* clientPointer);
+    void unregisterClient(WebSocketClient* clientPointer);
+
+    // Interrupts the current wait so registrations and deadlines are re-evaluated
+    void wakeReactor();
+
+private:
+    struct ClientRegistrationState {
+        int registeredSocketFileDescriptor;
+        unsigned long registeredConnectionGenerationValue;
+        bool registeredForWriteFlag;
+    };
+
+    std::atomic<bool> reactorRunningFlag;
+    std::thread reactorThread;
+    mutable std::mutex reactorStateMutex;
+
+    std::vector<WebSocketClient*> registeredClientPointers;
+    std::unordered_map<WebSocketClient*, ClientRegistrationState> clientRegistrationStateMap;
+    std::unordered_map<int, WebSocketClient*> socketFileDescriptorClientMap;
+
+    Logging::LoggingContext* parentLoggingContextPointer;
+
+    int pollingFileDescriptor;
+    int wakeupPipeReadFileDescriptor;
+    int wakeupPipeWriteFileDescriptor;
+
+    void reactorLoopWorker();
+    void synchronizeClientRegistrations();
+    int computeWaitTimeoutMilliseconds() const;
+    void waitAndDispatchReadiness(int waitTimeoutMilliseconds);
+    void dispatchClientTimers();
+    void drainWakeupPipe();
+    void removeSocketFromPolling(int socketFileDescriptorValue);
+    void closeReactorDescriptors();
+};
+
+} // namespace Polygon
+} // namespace API
+} // namespace AlpacaTrader
+
+#endif // WEBSOCKET_REACTOR_HPP
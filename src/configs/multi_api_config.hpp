@@ -2,6 +2,7 @@
 #define MULTI_API_CONFIG_HPP
 
 #include <string>
+#include <vector>
 #include <unordered_map>
 
 namespace AlpacaTrader {
@@ -30,6 +31,7 @@ struct ApiProviderConfig {
     int bars_range_minutes;
     int websocket_bar_accumulation_seconds;
     int websocket_second_level_accumulation_seconds;
+    std::vector<int> websocket_higher_timeframes_seconds;
     int websocket_max_bar_history_size;
     
     struct EndpointConfig {
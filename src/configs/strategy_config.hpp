@@ -2,6 +2,7 @@
 #define STRATEGY_CONFIG_HPP
 
 #include <string>
+#include <vector>
 
 struct StrategyConfig {
     // ========================================================================
@@ -48,10 +49,64 @@ struct StrategyConfig {
     int daily_bars_count;                            // Number of daily bars to fetch for historical comparison
     int minimum_data_accumulation_seconds_before_trading;  // Minimum seconds of data accumulation required before allowing trades
 
+    // Range and swing indicator configuration (rolling extrema, incremental per symbol/timeframe)
+    int donchian_channel_bars;                       // Donchian channel lookback in bars
+    int stochastic_k_bars;                           // Stochastic %K lookback in bars
+    int stochastic_d_bars;                           // Stochastic %D smoothing in %K values
+    int swing_lookback_bars;                         // Swing high/low lookback in bars (Fibonacci retracement anchors)
+
     // ATR-based signal validation
     double atr_absolute_minimum_threshold;           // Absolute ATR minimum threshold
     bool use_absolute_atr_threshold;                 // Use absolute ATR threshold instead of relative
 
+    // Rolling percentile filters (ATR/volume ranked against their own recent distribution per symbol)
+    bool use_rolling_percentile_filters;             // Use rolling percentile filters instead of fixed multipliers
+    int percentile_window_bars;                      // Number of closed bars in each rolling percentile window
+    int minimum_percentile_samples;                  // Minimum samples before percentile filters replace the fixed multipliers
+    double minimum_atr_percentile;                   // Minimum ATR percentile (0.0 to 1.0) for the ATR filter
+    double minimum_volume_percentile;                // Minimum volume percentile (0.0 to 1.0) for the volume filter
+
+    // Volatility regime (EWMA and GARCH(1,1) on per-bar log returns, GARCH refit in the background)
+    double ewma_volatility_decay;                    // EWMA variance decay factor (lambda, 0.0 to 1.0)
+    int garch_refit_window_bars;                     // Number of returns used for each GARCH refit
+    int garch_refit_interval_bars;                   // Closed bars between GARCH refits
+    double high_volatility_regime_ratio;             // GARCH/long-run volatility ratio that enters the HIGH regime
+    double low_volatility_regime_ratio;              // GARCH/long-run volatility ratio that enters the LOW regime
+    double volatility_regime_hysteresis;             // Ratio band that must be crossed back before leaving HIGH or LOW
+    bool enable_volatility_regime_adaptation;        // Adapt signal threshold and position size to the regime
+    double high_volatility_signal_threshold_multiplier;  // Signal strength threshold multiplier in the HIGH regime
+    double low_volatility_signal_threshold_multiplier;   // Signal strength threshold multiplier in the LOW regime
+    double high_volatility_position_size_multiplier;     // Position size multiplier in the HIGH regime
+    double low_volatility_position_size_multiplier;      // Position size multiplier in the LOW regime
+
+    // Multi-timeframe signal confirmation (higher timeframes rolled up from the base bars, no extra fetches)
+    bool enable_multi_timeframe_confirmation;        // Combine signal rules across the base and confirmation timeframes
+    std::vector<int> confirmation_timeframes_seconds;    // Confirmation timeframes in seconds, increasing (e.g., 60;300)
+    std::vector<double> confirmation_timeframe_weights;  // Weight per confirmation timeframe, same order
+    double base_timeframe_signal_weight;             // Weight of the base timeframe in the combined signal strength
+
+    // Oscillator confirmation (RSI, MACD, Bollinger Bands and Stochastic over each portfolio symbol's fetched bars)
+    bool enable_oscillator_signals;                  // Add oscillator confirmation to the base timeframe signal strength (portfolio mode)
+    int rsi_period_bars;                             // RSI (Wilder) lookback in bars
+    double rsi_oversold_level;                       // RSI at or below which the oscillator confirms a buy
+    double rsi_overbought_level;                     // RSI at or above which the oscillator confirms a sell
+    int macd_fast_period_bars;                       // MACD fast EMA period in bars
+    int macd_slow_period_bars;                       // MACD slow EMA period in bars
+    int macd_signal_period_bars;                     // MACD signal line EMA period in MACD values
+    int bollinger_period_bars;                       // Bollinger Bands moving average period in bars
+    double bollinger_standard_deviations;            // Bollinger Bands width in standard deviations
+    double oscillator_signal_weight;                 // Signal strength added when all four oscillators confirm
+
+    // Multi-symbol portfolio (trading_mode.enable_symbol_universe)
+    int portfolio_worker_threads;                    // Pool threads evaluating symbols in parallel (the trader thread also takes part)
+    int max_portfolio_orders_per_cycle;              // Orders placed per portfolio cycle, strongest signals first
+    int max_portfolio_open_positions;                // Symbols that may hold a position at the same time
+
+    // Strategy ensemble (variants evaluated on the same data, decisions arbitrated by the combiner)
+    bool enable_strategy_ensemble;                   // Evaluate the strategy variants next to the primary strategy
+    std::vector<std::string> strategy_variant_names; // Variant names, each loaded from config/strategy_variants/<name>.csv
+    std::string strategy_combiner_mode;              // Combiner: strongest, majority or unanimous
+
     // Momentum signal requirements (for signal strength)
     double minimum_price_change_percentage_for_momentum;  // Min price change % for momentum signals
     double minimum_volume_increase_percentage_for_buy_signals;  // Min volume increase % for buy signals
@@ -219,6 +274,12 @@ struct StrategyConfig {
     std::string position_short_string;                // String label for short positions
 };
 
+// Strategy parameter set of one ensemble variant: strategy_config.csv with the variant file's overrides
+struct StrategyVariantConfig {
+    std::string variant_name;
+    StrategyConfig strategy;
+};
+
 #endif // STRATEGY_CONFIG_HPP
 
 
@@ -7,6 +7,7 @@
 #include "multi_api_config.hpp"
 #include "trading_mode_config.hpp"
 #include "threads/thread_register.hpp"
+#include <vector>
 
 namespace AlpacaTrader {
 namespace Config {
@@ -26,6 +27,7 @@ struct SystemConfig {
     MultiApiConfig multi_api;          // Multi-provider API configuration
     TradingModeConfig trading_mode;    // Trading mode configuration (stocks vs crypto)
     ThreadConfigRegistry thread_registry; // Thread priorities and CPU affinity
+    std::vector<StrategyVariantConfig> strategy_variants; // Strategy ensemble variants (config/strategy_variants/*.csv)
 };
 
 } // namespace Config
@@ -12,6 +12,10 @@ struct TimingConfig {
     int thread_market_gate_poll_interval_sec;        // Market gate thread polling interval in seconds
     int thread_trader_poll_interval_sec;             // Trader decision thread polling interval in seconds
     int thread_logging_poll_interval_sec;            // Logging thread polling interval in seconds
+    bool enable_event_driven_trader_cycle;           // Trader wakes on bar close; the trader poll interval becomes a heartbeat
+    bool trader_wake_on_snapshot_update;             // In event-driven mode also wake on every snapshot update, not only on a new bar
+    bool skip_unchanged_trading_cycles;              // Skip trader cycles whose market and account data generations are unchanged
+    int max_consecutive_unchanged_cycle_skips;       // Forced full evaluation after this many skips (keeps time-based checks running)
 
     // ========================================================================
     // HISTORICAL DATA CONFIGURATION
@@ -2,6 +2,7 @@
 #define TRADING_MODE_CONFIG_HPP
 
 #include <string>
+#include <vector>
 
 namespace AlpacaTrader {
 namespace Config {
@@ -14,6 +15,8 @@ enum class TradingMode {
 struct TradingModeConfig {
     TradingMode mode;
     std::string primary_symbol;
+    bool enable_symbol_universe;                 // Trade every symbol in symbol_universe as one portfolio
+    std::vector<std::string> symbol_universe;    // Symbols evaluated each portfolio cycle (primary_symbol is always included)
     
     static TradingMode parse_mode(const std::string& mode_str) {
         if (mode_str == "stocks" || mode_str == "STOCKS") {
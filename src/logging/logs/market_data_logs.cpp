@@ -2,6 +2,7 @@
 #include "logging/logger/async_logger.hpp"
 #include "logging/logger/logging_macros.hpp"
 #include "trader/data_structures/data_structures.hpp"
+#include "utils/time_utils.hpp"
 #include <iomanip>
 #include <sstream>
 #include <ctime>
@@ -245,17 +246,7 @@ void MarketDataLogs::log_all_bars_received(const std::string& symbol, const std:
     for (size_t i = 0; i < bars.size(); ++i) {
         const Core::Bar& barData = bars[i];
         
-        std::string timeStringValue = barData.timestamp;
-        try {
-            long long timestampMillisValue = std::stoll(barData.timestamp);
-            time_t timestampSecondsValue = timestampMillisValue / 1000;
-            struct tm* timeInfoPointer = localtime(&timestampSecondsValue);
-            char timeBufferString[32];
-            strftime(timeBufferString, sizeof(timeBufferString), "%Y-%m-%d %H:%M:%S", timeInfoPointer);
-            timeStringValue = std::string(timeBufferString);
-        } catch (const std::exception&) {
-            timeStringValue = barData.timestamp;
-        }
+        std::string timeStringValue = TimeUtils::format_epoch_nanoseconds_human_readable(barData.timestamp_ns);
         
         std::ostringstream barNumberStream;
         barNumberStream << "Bar #" << (i + 1);
@@ -309,7 +300,7 @@ void MarketDataLogs::log_all_bars_received(const std::string& symbol, const std:
         lowCloseRowLineValue += " │";
         log_message(lowCloseRowLineValue, log_file);
         
-        std::string volumeTimestampValue = "Volume: " + volumeStream.str() + " | Raw TS: " + barData.timestamp;
+        std::string volumeTimestampValue = "Volume: " + volumeStream.str() + " | Raw TS: " + TimeUtils::format_epoch_nanoseconds_raw(barData.timestamp_ns);
         std::string volumeTimestampRowLineValue = "│ Data              │ " + volumeTimestampValue.substr(0, 48);
         if (volumeTimestampValue.length() < 48) {
             volumeTimestampRowLineValue += std::string(48 - volumeTimestampValue.length(), ' ');
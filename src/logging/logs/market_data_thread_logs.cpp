@@ -91,7 +91,7 @@ void MarketDataThreadLogs::log_fresh_quote_data_to_csv(const QuoteData& quote_da
     auto csv_logger = get_logging_context()->csv_bars_logger;
     if (csv_logger) {
         csv_logger->log_market_data(
-            timestamp, processed_data.curr.timestamp, quote_data.bid_price, quote_data.ask_price, 
+            timestamp, TimeUtils::format_epoch_nanoseconds_human_readable(processed_data.curr.timestamp_ns), quote_data.bid_price, quote_data.ask_price, 
             quote_data.bid_price, quote_data.mid_price, quote_data.ask_size + quote_data.bid_size,
             processed_data.atr, processed_data.avg_atr, processed_data.avg_vol
         );
@@ -99,18 +99,18 @@ void MarketDataThreadLogs::log_fresh_quote_data_to_csv(const QuoteData& quote_da
     log_message("Logged FRESH real-time quote data to CSV (Price: $" + std::to_string(quote_data.mid_price) + ")", "trading_system.log");
 }
 
-void MarketDataThreadLogs::log_historical_bars_to_csv(const std::vector<Bar>& historical_bars, const ProcessedData& processed_data, const std::string& timestamp, const std::string& symbol) {
+void MarketDataThreadLogs::log_historical_bars_to_csv(const BarSeries& historical_bar_series, const ProcessedData& processed_data, const std::string& timestamp, const std::string& symbol) {
     auto csv_logger2 = get_logging_context()->csv_bars_logger;
     if (csv_logger2) {
         // Log ALL bars that were fetched, not just the last one
-        // Convert bar timestamps from milliseconds to human-readable format
-        for (const auto& bar : historical_bars) {
+        // Convert bar timestamps from epoch nanoseconds to human-readable format
+        for (size_t bar_index = 0; bar_index < historical_bar_series.size(); ++bar_index) {
+            const Bar bar = historical_bar_series.bar_at(bar_index);
             std::string bar_timestamp;
-            if (bar.timestamp.empty()) {
+            if (bar.timestamp_ns == 0) {
                 bar_timestamp = timestamp;
             } else {
-                // Convert milliseconds timestamp to human-readable format
-                bar_timestamp = TimeUtils::convert_milliseconds_to_human_readable(bar.timestamp);
+                bar_timestamp = TimeUtils::format_epoch_nanoseconds_human_readable(bar.timestamp_ns);
             }
             
             csv_logger2->log_bar(
@@ -118,14 +118,14 @@ void MarketDataThreadLogs::log_historical_bars_to_csv(const std::vector<Bar>& hi
             );
         }
     }
-    log_message("Successfully logged " + std::to_string(historical_bars.size()) + " bars to CSV", "trading_system.log");
+    log_message("Successfully logged " + std::to_string(historical_bar_series.size()) + " bars to CSV", "trading_system.log");
 }
 
 bool MarketDataThreadLogs::is_fetch_allowed(const std::atomic<bool>* allow_fetch_ptr) {
     return allow_fetch_ptr && allow_fetch_ptr->load();
 }
 
-void MarketDataThreadLogs::process_csv_logging_if_needed(const ProcessedData& computed_data, const std::vector<Bar>& historical_bars, MarketDataValidator& validator, const std::string& symbol, const TimingConfig& timing, ApiManager& api_manager, std::chrono::steady_clock::time_point& last_bar_log_time, Bar& previous_bar) {
+void MarketDataThreadLogs::process_csv_logging_if_needed(const ProcessedData& computed_data, const BarSeries& historical_bar_series, MarketDataValidator& validator, const std::string& symbol, const TimingConfig& timing, ApiManager& api_manager, std::chrono::steady_clock::time_point& last_bar_log_time, Bar& previous_bar) {
     (void)validator;  // Not used - we log bars directly without validating quotes
     (void)api_manager;  // Not used - we don't make API calls for CSV logging
     
@@ -152,14 +152,14 @@ void MarketDataThreadLogs::process_csv_logging_if_needed(const ProcessedData& co
         // Log bars directly without making API calls for quotes
         // Bars are already logged in market_data_coordinator, but this provides additional logging
         // with duplicate detection to avoid logging the same bar multiple times
-        if (!historical_bars.empty()) {
-            const auto& latest_bar = historical_bars.back();
-            if (previous_bar.timestamp.empty() || latest_bar.timestamp != previous_bar.timestamp) {
-                MarketDataThreadLogs::log_historical_bars_to_csv(historical_bars, computed_data, current_timestamp, symbol);
+        if (!historical_bar_series.empty()) {
+            const Bar latest_bar = historical_bar_series.latest_bar();
+            if (previous_bar.timestamp_ns == 0 || latest_bar.timestamp_ns != previous_bar.timestamp_ns) {
+                MarketDataThreadLogs::log_historical_bars_to_csv(historical_bar_series, computed_data, current_timestamp, symbol);
                 // Update previous_bar to track the latest bar we logged
                 previous_bar = latest_bar;
             } else {
-                MarketDataThreadLogs::log_duplicate_bar_skipped(symbol, latest_bar.timestamp);
+                MarketDataThreadLogs::log_duplicate_bar_skipped(symbol, TimeUtils::format_epoch_nanoseconds_human_readable(latest_bar.timestamp_ns));
             }
         } else {
             log_message("No historical bars available for CSV logging", "trading_system.log");
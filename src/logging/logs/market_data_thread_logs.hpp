@@ -3,6 +3,7 @@
 
 #include "configs/system_config.hpp"
 #include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/bar_series.hpp"
 #include "trader/market_data/market_data_validator.hpp"
 #include "api/general/api_manager.hpp"
 #include <string>
@@ -13,6 +14,7 @@ using AlpacaTrader::Config::SystemConfig;
 using AlpacaTrader::Core::QuoteData;
 using AlpacaTrader::Core::ProcessedData;
 using AlpacaTrader::Core::Bar;
+using AlpacaTrader::Core::BarSeries;
 using AlpacaTrader::Core::MarketDataValidator;
 using AlpacaTrader::API::ApiManager;
 
@@ -45,7 +47,7 @@ public:
     static void log_csv_bar_logging(const std::string& symbol, size_t bars_count);
     static void log_csv_logging_error(const std::string& symbol, const std::string& error_message);
     static void log_fresh_quote_data_to_csv(const QuoteData& quote_data, const ProcessedData& processed_data, const std::string& timestamp);
-    static void log_historical_bars_to_csv(const std::vector<Bar>& historical_bars, const ProcessedData& processed_data, const std::string& timestamp, const std::string& symbol);
+    static void log_historical_bars_to_csv(const BarSeries& historical_bar_series, const ProcessedData& processed_data, const std::string& timestamp, const std::string& symbol);
     
     // Data validation logging
     static void log_zero_atr_warning(const std::string& symbol);
@@ -53,7 +55,7 @@ public:
     
     // Utility functions
     static bool is_fetch_allowed(const std::atomic<bool>* allow_fetch_ptr);
-    static void process_csv_logging_if_needed(const ProcessedData& computed_data, const std::vector<Bar>& historical_bars, MarketDataValidator& validator, const std::string& symbol, const TimingConfig& timing, ApiManager& api_manager, std::chrono::steady_clock::time_point& last_bar_log_time, Bar& previous_bar);
+    static void process_csv_logging_if_needed(const ProcessedData& computed_data, const BarSeries& historical_bar_series, MarketDataValidator& validator, const std::string& symbol, const TimingConfig& timing, ApiManager& api_manager, std::chrono::steady_clock::time_point& last_bar_log_time, Bar& previous_bar);
 };
 
 } // namespace Logging
@@ -31,7 +31,7 @@ void SignalAnalysisLogs::log_signal_analysis_csv_data(const AlpacaTrader::Core::
         if (auto csv = AlpacaTrader::Logging::get_logging_context()->csv_trade_logger) {
             csv->log_signal(
                 timestamp, symbol, signal_decision.buy, signal_decision.sell,
-                signal_decision.signal_strength, signal_decision.signal_reason
+                signal_decision.signal_strength, TradingLogs::render_signal_reason(signal_decision)
             );
         }
 
@@ -39,8 +39,8 @@ void SignalAnalysisLogs::log_signal_analysis_csv_data(const AlpacaTrader::Core::
         if (auto csv = AlpacaTrader::Logging::get_logging_context()->csv_trade_logger) {
             csv->log_filters(
                 timestamp, symbol, filter_result.atr_pass, filter_result.atr_ratio,
-                config.strategy.use_absolute_atr_threshold ?
-                    config.strategy.atr_absolute_minimum_threshold :
+                (filter_result.filter_basis_flags & AlpacaTrader::Core::FILTER_BASIS_ATR_PERCENTILE) ? config.strategy.minimum_atr_percentile :
+                (filter_result.filter_basis_flags & AlpacaTrader::Core::FILTER_BASIS_ATR_ABSOLUTE) ? config.strategy.atr_absolute_minimum_threshold :
                     config.strategy.entry_signal_atr_multiplier,
                 filter_result.vol_pass, filter_result.vol_ratio,
                 filter_result.doji_pass
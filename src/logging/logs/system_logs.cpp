@@ -44,6 +44,11 @@ void SystemLogs::log_running_flag_warning() {
     log_message("WARNING: running flag is false at start", "system_logs");
 }
 
+void SystemLogs::log_trading_cycle_skip_counters(unsigned long evaluated_cycle_count, unsigned long skipped_cycle_count) {
+    log_message("INFO: Trading cycles evaluated: " + std::to_string(evaluated_cycle_count) +
+                ", skipped on unchanged data: " + std::to_string(skipped_cycle_count), "system_logs");
+}
+
 void SystemLogs::log_logging_context_error() {
     log_message("ERROR: Logging context not initialized - system must fail without context", "system_logs");
 }
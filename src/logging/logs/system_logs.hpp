@@ -23,6 +23,7 @@ public:
     static void log_health_check_error(const std::string& error_message);
     static void log_main_loop_error(const std::string& error_message);
     static void log_fatal_error(const std::string& error_message);
+    static void log_trading_cycle_skip_counters(unsigned long evaluated_cycle_count, unsigned long skipped_cycle_count);
     
     // System state errors
     static void log_running_flag_warning();
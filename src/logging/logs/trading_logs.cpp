@@ -240,18 +240,27 @@ void TradingLogs::log_candle_and_signals(const ProcessedData& data, const Signal
 }
 
 void TradingLogs::log_filters(const FilterResult& filters, const SystemConfig& config, const ProcessedData& data) {
-    // Use absolute ATR threshold if enabled, otherwise use relative threshold
-    double atr_threshold = config.strategy.use_absolute_atr_threshold ? 
-                          config.strategy.atr_absolute_minimum_threshold : 
-                          config.strategy.entry_signal_atr_multiplier;
+    // Show each filter against the basis it was actually judged on
+    double atr_threshold = config.strategy.entry_signal_atr_multiplier;
+    double atr_value = filters.atr_ratio;
+    if (filters.filter_basis_flags & Core::FILTER_BASIS_ATR_PERCENTILE) {
+        atr_threshold = config.strategy.minimum_atr_percentile;
+        atr_value = data.atr_percentile;
+    } else if (filters.filter_basis_flags & Core::FILTER_BASIS_ATR_ABSOLUTE) {
+        // For absolute threshold, pass the actual ATR value instead of ratio
+        atr_threshold = config.strategy.atr_absolute_minimum_threshold;
+        atr_value = data.atr;
+    }
     
-    // For absolute threshold, pass the actual ATR value instead of ratio
-    double atr_value = config.strategy.use_absolute_atr_threshold ? 
-                      data.atr : 
-                      filters.atr_ratio;
+    double volume_threshold = config.strategy.entry_signal_volume_multiplier;
+    double volume_value = filters.vol_ratio;
+    if (filters.filter_basis_flags & Core::FILTER_BASIS_VOLUME_PERCENTILE) {
+        volume_threshold = config.strategy.minimum_volume_percentile;
+        volume_value = data.volume_percentile;
+    }
     
     log_filters_table(filters.atr_pass, atr_value, atr_threshold, 
-                     filters.vol_pass, filters.vol_ratio, config.strategy.entry_signal_volume_multiplier, 
+                     filters.vol_pass, volume_value, volume_threshold, 
                      filters.doji_pass);
 }
 
@@ -1044,6 +1053,11 @@ void TradingLogs::log_inline_next_loop(int seconds) {
     log_inline_status(get_formatted_inline_message("   ⏳ Next loop in " + std::to_string(seconds) + "s   "));
 }
 
+void TradingLogs::log_inline_unchanged_data_skip(unsigned long skipped_cycle_count, unsigned long evaluated_cycle_count) {
+    log_inline_status(get_formatted_inline_message("   ⏸ Data unchanged - cycle skipped (" + std::to_string(skipped_cycle_count) +
+                                                   " skipped / " + std::to_string(evaluated_cycle_count) + " evaluated)   "));
+}
+
 void TradingLogs::end_inline_status() {
     AlpacaTrader::Logging::end_inline_status();
 }
@@ -1102,12 +1116,67 @@ void TradingLogs::log_signal_strength_breakdown(const SignalDecision& signals, c
     TABLE_HEADER_48("Signal Strength Analysis", "Decision Breakdown");
     
     std::string signal_status = signals.buy ? "BUY" : (signals.sell ? "SELL" : "NONE");
-    std::string strength_detail = "(" + std::to_string(signals.signal_strength).substr(0,4) + " >= " + std::to_string(config.strategy.minimum_signal_strength_threshold).substr(0,4) + ")";
+    std::string strength_detail = "(" + std::to_string(signals.signal_strength).substr(0,4) + " >= " + std::to_string(signals.signal_threshold).substr(0,4) + ")";
     TABLE_ROW_48("Signal Type", signal_status + " " + strength_detail);
     
     TABLE_ROW_48("Signal Strength", std::to_string(signals.signal_strength).substr(0,4) + "/1.0");
-    TABLE_ROW_48("Threshold", std::to_string(config.strategy.minimum_signal_strength_threshold).substr(0,4) + "/1.0");
-    TABLE_ROW_48("Reason", signals.signal_reason.empty() ? "No analysis" : signals.signal_reason);
+    TABLE_ROW_48("Threshold", std::to_string(signals.signal_threshold).substr(0,4) + "/1.0 (base " + std::to_string(config.strategy.minimum_signal_strength_threshold).substr(0,4) + ")");
+    TABLE_ROW_48("Reason", render_signal_reason(signals));
+    
+    TABLE_FOOTER_48();
+}
+
+std::string TradingLogs::render_signal_reason(const SignalDecision& signals) {
+    uint16_t reason_flags = signals.signal_reason_flags;
+    if (!(reason_flags & Core::SIGNAL_REASON_EVALUATED)) {
+        return "No analysis";
+    }
+    if (reason_flags & Core::SIGNAL_REASON_NO_COMBINED_DECISION) {
+        return "No combined strategy decision";
+    }
+    
+    std::string reason_text;
+    if (reason_flags & Core::SIGNAL_REASON_BASIC_PATTERN) {
+        reason_text += "Basic pattern OK; ";
+        reason_text += (reason_flags & Core::SIGNAL_REASON_MOMENTUM) ? "Momentum OK; " : "No momentum; ";
+        reason_text += (reason_flags & Core::SIGNAL_REASON_VOLUME) ? "Volume OK; " : "Low volume; ";
+        reason_text += (reason_flags & Core::SIGNAL_REASON_VOLATILITY) ? "Volatility OK; " : "Low volatility; ";
+    } else {
+        reason_text += "Basic pattern failed; ";
+    }
+    
+    if (reason_flags & Core::SIGNAL_REASON_MULTI_TIMEFRAME) {
+        reason_text += (reason_flags & Core::SIGNAL_REASON_SELL_RULES) ? "MTF sell " : "MTF buy ";
+        reason_text += std::to_string(signals.timeframe_confirmations) + "/" + std::to_string(signals.timeframes_with_data) + "; ";
+    }
+    if (reason_flags & Core::SIGNAL_REASON_OSCILLATORS) {
+        reason_text += "Oscillators " + std::to_string(signals.oscillator_confirmations) + "/4; ";
+    }
+    return reason_text;
+}
+
+void TradingLogs::log_portfolio_cycle_table(const std::vector<std::pair<std::string, std::string>>& symbol_decisions, size_t candidate_count, int orders_placed) {
+    TABLE_HEADER_48("Portfolio Symbol", "Decision");
+    
+    for (const auto& symbol_decision : symbol_decisions) {
+        TABLE_ROW_48(symbol_decision.first, symbol_decision.second);
+    }
+    TABLE_ROW_48("Candidates / Orders", std::to_string(candidate_count) + " / " + std::to_string(orders_placed));
+    
+    TABLE_FOOTER_48();
+}
+
+void TradingLogs::log_strategy_ensemble_table(const std::vector<AlpacaTrader::Core::StrategyDecision>& strategy_decisions, const std::string& winning_strategy_name) {
+    TABLE_HEADER_48("Strategy", "Decision");
+    
+    for (const auto& strategy_decision : strategy_decisions) {
+        const SignalDecision& signal_decision = strategy_decision.signal_decision;
+        std::string decision_string = signal_decision.buy ? "BUY" : (signal_decision.sell ? "SELL" : "NONE");
+        decision_string += " (" + std::to_string(signal_decision.signal_strength).substr(0, 4) + ")";
+        decision_string += strategy_decision.filter_result.all_pass ? " filters PASS" : " filters FAIL";
+        TABLE_ROW_48(strategy_decision.strategy_name, decision_string);
+    }
+    TABLE_ROW_48("Combined", winning_strategy_name.empty() ? std::string("No decision") : winning_strategy_name);
     
     TABLE_FOOTER_48();
 }
@@ -4,6 +4,7 @@
 #include "configs/system_config.hpp"
 #include "trader/data_structures/data_structures.hpp"
 #include "trader/strategy_analysis/strategy_logic.hpp"
+#include "trader/strategy_analysis/trading_strategy.hpp"
 #include "logging/logger/logging_macros.hpp"
 #include "logger_structures.hpp"
 #include <vector>
@@ -37,6 +38,8 @@ public:
     static void log_signal_analysis_detailed(const AlpacaTrader::Core::ProcessedData& data, const AlpacaTrader::Core::SignalDecision& signals, const SystemConfig& config);
     static void log_momentum_analysis(const AlpacaTrader::Core::ProcessedData& data, const SystemConfig& config);
     static void log_signal_strength_breakdown(const AlpacaTrader::Core::SignalDecision& signals, const SystemConfig& config);
+    // Renders the decision's reason flags; only log sinks call this, never the decision path
+    static std::string render_signal_reason(const AlpacaTrader::Core::SignalDecision& signals);
     static void log_signals_table_enhanced(const AlpacaTrader::Core::SignalDecision& signals);
     static void log_filters_not_met_preview(double risk_amount, int quantity);
     static void log_filters_not_met_table(double risk_amount, int quantity);
@@ -145,11 +148,18 @@ public:
     static void log_market_data_fetch_table();
     static void log_market_data_result_table(const std::string& description, bool success, size_t bar_count);
     
+    // Multi-symbol portfolio: one row per symbol (symbol, decision) plus the cycle totals
+    static void log_portfolio_cycle_table(const std::vector<std::pair<std::string, std::string>>& symbol_decisions, size_t candidate_count, int orders_placed);
+    
+    // Strategy ensemble: one row per strategy plus the combiner's pick
+    static void log_strategy_ensemble_table(const std::vector<AlpacaTrader::Core::StrategyDecision>& strategy_decisions, const std::string& winning_strategy_name);
+    
     // Performance metrics
     
     // Inline status and countdown logging
     static void log_inline_halt_status(int seconds);
     static void log_inline_next_loop(int seconds);
+    static void log_inline_unchanged_data_skip(unsigned long skipped_cycle_count, unsigned long evaluated_cycle_count);
     static void end_inline_status();
     
     // Order execution header
@@ -130,6 +130,16 @@ SystemModules create_trading_modules(SystemState& state, std::shared_ptr<AlpacaT
     modules.account_data_coordinator = std::make_unique<AlpacaTrader::Core::AccountDataCoordinator>(*modules.portfolio_manager);
     modules.market_gate_coordinator = std::make_unique<AlpacaTrader::Core::MarketGateCoordinator>(*modules.api_manager, state.connectivity_manager);
     
+    // Portfolio coordinator replaces the single-symbol trading cycle when a symbol universe is configured
+    if (state.config.trading_mode.enable_symbol_universe) {
+        modules.portfolio_coordinator = std::make_unique<AlpacaTrader::Core::PortfolioCoordinator>(
+            *modules.trading_logic,
+            *modules.portfolio_manager,
+            state.connectivity_manager,
+            state.config
+        );
+    }
+    
     // Create thread modules
     
     // Create MARKET_DATA thread
@@ -200,6 +210,18 @@ void configure_trading_modules(SystemThreads& handles, SystemModules& modules, S
     if (modules.trading_thread) {
         modules.trading_thread->set_allow_fetch_flag(state.allow_fetch);
     }
+    
+    // Market data publishes bar-close events that the trader thread waits on
+    if (modules.market_data_thread) {
+        modules.market_data_thread->set_trading_cycle_trigger(state.trading_cycle_trigger);
+    }
+    if (modules.trading_thread) {
+        modules.trading_thread->set_trading_cycle_trigger(state.trading_cycle_trigger);
+    }
+    
+    if (modules.trading_thread && modules.portfolio_coordinator) {
+        modules.trading_thread->set_portfolio_coordinator(*modules.portfolio_coordinator);
+    }
 }
 
 SystemThreads startup(SystemState& system_state, std::shared_ptr<AlpacaTrader::Logging::AsyncLogger> logger) {
@@ -292,6 +314,15 @@ SystemThreads startup(SystemState& system_state, std::shared_ptr<AlpacaTrader::L
         throw;
     }
     
+    // Portfolio evaluation workers run at their own configured priority
+    if (modules.portfolio_coordinator) {
+        bool workers_setup = Manager::setup_scheduler_worker_priorities(system_state.thread_manager_state, modules.portfolio_coordinator->get_task_scheduler(), "portfolio_worker", system_state.config);
+        if (!workers_setup) {
+            SystemLogs::log_thread_priority_error("Failed to setup portfolio worker priorities");
+            throw std::runtime_error("Portfolio worker priority setup failed");
+        }
+    }
+    
     // Store thread infos for monitoring
     system_state.thread_infos = std::move(thread_infos);
     
@@ -358,6 +389,11 @@ static void run_until_shutdown(SystemState& state) {
                     try {
                         ThreadLogs::log_thread_monitoring_stats(state.thread_infos, start_time);
                         
+                        if (state.trading_modules && state.trading_modules->trading_coordinator) {
+                            AlpacaTrader::Core::TradingCycleSkipCounters skip_counters = state.trading_modules->trading_coordinator->get_cycle_skip_counters();
+                            SystemLogs::log_trading_cycle_skip_counters(skip_counters.evaluated_cycles, skip_counters.skipped_unchanged_cycles);
+                        }
+                        
                         // Update system monitor with current thread health
                         int active_thread_count = static_cast<int>(state.thread_infos.size());
                         bool health_check_recorded = state.system_monitor.record_thread_health_check(active_thread_count);
@@ -424,6 +460,7 @@ void shutdown(SystemState& system_state, std::shared_ptr<AlpacaTrader::Logging::
         system_state.running.store(false);
         system_state.shutdown_requested.store(true);
     system_state.cv.notify_all();
+    system_state.trading_cycle_trigger.notify_shutdown();
 
     // Wait for all threads to complete
     bool threads_shutdown = Manager::shutdown_threads(system_state.thread_manager_state);
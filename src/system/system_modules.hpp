@@ -12,6 +12,7 @@
 #include "trader/coordinators/account_data_coordinator.hpp"
 #include "trader/coordinators/market_data_coordinator.hpp"
 #include "trader/coordinators/market_gate_coordinator.hpp"
+#include "trader/coordinators/portfolio_coordinator.hpp"
 #include "trader/coordinators/trading_coordinator.hpp"
 #include "trader/trading_logic/trading_logic.hpp"
 
@@ -31,6 +32,7 @@ struct SystemModules {
     std::unique_ptr<AlpacaTrader::Core::MarketDataCoordinator> market_data_coordinator; // Market data access coordinator
     std::unique_ptr<AlpacaTrader::Core::AccountDataCoordinator> account_data_coordinator; // Account data access coordinator
     std::unique_ptr<AlpacaTrader::Core::MarketGateCoordinator> market_gate_coordinator; // Market gate control coordinator
+    std::unique_ptr<AlpacaTrader::Core::PortfolioCoordinator> portfolio_coordinator; // Multi-symbol portfolio (only when the symbol universe is enabled)
     
     // =========================================================================
     // THREADING COMPONENTS
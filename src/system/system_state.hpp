@@ -14,6 +14,7 @@
 #include "logging/logs/thread_logs.hpp"
 #include "logging/logger/async_logger.hpp"
 #include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/data_sync_structures.hpp"
 #include "utils/connectivity_manager.hpp"
 
 /**
@@ -27,12 +28,13 @@ struct SystemState {
     // =========================================================================
     std::mutex mtx;                    // Primary mutex for thread synchronization
     std::condition_variable cv;        // Condition variable for thread coordination
+    AlpacaTrader::Core::TradingCycleTrigger trading_cycle_trigger;  // Wakes the trader on bar close in event-driven mode
     
     // =========================================================================
     // MARKET AND ACCOUNT DATA
     // =========================================================================
-    AlpacaTrader::Core::MarketSnapshot market;             // Current market data snapshot
-    AlpacaTrader::Core::AccountSnapshot account;           // Current account information snapshot
+    AlpacaTrader::Core::PublishedMarketSnapshot market;    // Current market data snapshot, seqlock-published by the market data thread
+    AlpacaTrader::Core::PublishedAccountSnapshot account;  // Current account snapshot, seqlock-published by the account data thread
     
     // =========================================================================
     // SYSTEM CONTROL FLAGS
@@ -19,7 +19,7 @@ struct AccountDataThread {
     AlpacaTrader::Core::AccountDataCoordinator& account_data_coordinator;
     std::mutex& state_mtx;
     std::condition_variable& data_cv;
-    AlpacaTrader::Core::AccountSnapshot& account_snapshot;
+    AlpacaTrader::Core::PublishedAccountSnapshot& account_snapshot;
     std::atomic<bool>& has_account;
     std::atomic<bool>& running;
     std::atomic<bool>* allow_fetch_ptr {nullptr};
@@ -29,7 +29,7 @@ struct AccountDataThread {
                     AlpacaTrader::Core::AccountDataCoordinator& coordinator_ref,
                     std::mutex& mtx,
                     std::condition_variable& cv,
-                    AlpacaTrader::Core::AccountSnapshot& snapshot,
+                    AlpacaTrader::Core::PublishedAccountSnapshot& snapshot,
                     std::atomic<bool>& has_account_flag,
                     std::atomic<bool>& running_flag)
         : timing(cfg.timing), account_data_coordinator(coordinator_ref), state_mtx(mtx),
@@ -61,7 +61,8 @@ void MarketDataThread::execute_market_data_collection_loop() {
                     data_cv,
                     has_market,
                     market_data_timestamp,
-                    market_data_fresh
+                    market_data_fresh,
+                    trading_cycle_trigger
                 };
                 
                 market_data_coordinator.process_market_data_iteration(strategy.symbol, snapshot_state, last_bar_log_time, previous_bar);
@@ -6,6 +6,7 @@
 #include "threads/thread_register.hpp"
 #include "trader/coordinators/market_data_coordinator.hpp"
 #include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/data_sync_structures.hpp"
 #include "logging/logger/async_logger.hpp"
 #include <atomic>
 #include <mutex>
@@ -25,7 +26,7 @@ struct MarketDataThread {
     AlpacaTrader::Core::MarketDataCoordinator& market_data_coordinator;
     std::mutex& state_mtx;
     std::condition_variable& data_cv;
-    MarketSnapshot& market_snapshot;
+    PublishedMarketSnapshot& market_snapshot;
     std::atomic<bool>& has_market;
     std::atomic<bool>& running;
     std::atomic<std::chrono::steady_clock::time_point>& market_data_timestamp;
@@ -35,12 +36,13 @@ struct MarketDataThread {
     std::chrono::steady_clock::time_point last_bar_log_time{};
     std::atomic<bool>* allow_fetch_ptr {nullptr};
     std::atomic<unsigned long>* iteration_counter {nullptr};
+    AlpacaTrader::Core::TradingCycleTrigger* trading_cycle_trigger {nullptr};
 
     MarketDataThread(const AlpacaTrader::Config::MarketDataThreadConfig& cfg,
                     AlpacaTrader::Core::MarketDataCoordinator& coordinator_ref,
                     std::mutex& mtx,
                     std::condition_variable& cv,
-                    MarketSnapshot& snapshot,
+                    PublishedMarketSnapshot& snapshot,
                    std::atomic<bool>& has_market_flag,
                    std::atomic<bool>& running_flag,
                    std::atomic<std::chrono::steady_clock::time_point>& timestamp,
@@ -55,6 +57,9 @@ struct MarketDataThread {
     // Set iteration counter for monitoring
     void set_iteration_counter(std::atomic<unsigned long>& counter) { iteration_counter = &counter; }
 
+    // Trigger notified whenever a new snapshot is published
+    void set_trading_cycle_trigger(AlpacaTrader::Core::TradingCycleTrigger& trigger) { trading_cycle_trigger = &trigger; }
+    
     // Thread entrypoint
     void operator()();
 
@@ -58,21 +58,25 @@ void TraderThread::execute_trading_decision_loop() {
 
 
                 // Process one trading cycle iteration
-                trading_coordinator.process_trading_cycle_iteration(
-                    market_snapshot,
-                    account_snapshot,
-                    state_mtx,
-                    data_cv,
-                    has_market,
-                    has_account,
-                    running,
-                    market_data_timestamp,
-                    market_data_fresh,
-                    last_order_timestamp,
-                    allow_fetch_ptr,
-                    initial_equity,
-                    loop_counter
-                );
+                if (portfolio_coordinator) {
+                    portfolio_coordinator->process_portfolio_cycle_iteration(running, initial_equity, loop_counter);
+                } else {
+                    trading_coordinator.process_trading_cycle_iteration(
+                        market_snapshot,
+                        account_snapshot,
+                        state_mtx,
+                        data_cv,
+                        has_market,
+                        has_account,
+                        running,
+                        market_data_timestamp,
+                        market_data_fresh,
+                        last_order_timestamp,
+                        allow_fetch_ptr,
+                        initial_equity,
+                        loop_counter
+                    );
+                }
 
 
                 // Increment iteration counter
@@ -82,7 +86,7 @@ void TraderThread::execute_trading_decision_loop() {
 
 
                 // Wait before next cycle
-                trading_coordinator.countdown_to_next_cycle(running, timing.thread_trader_poll_interval_sec, timing.countdown_display_refresh_interval_seconds);
+                wait_for_next_cycle();
 
 
             } catch (const std::exception& exception_error) {
@@ -101,3 +105,13 @@ void TraderThread::execute_trading_decision_loop() {
         TradingLogs::log_market_data_result_table("Critical unknown exception in trading loop (execute_trading_decision_loop outer)", false, 0);
     }
 }
+
+void TraderThread::wait_for_next_cycle() {
+    if (!timing.enable_event_driven_trader_cycle || !trading_cycle_trigger) {
+        trading_coordinator.countdown_to_next_cycle(running, timing.thread_trader_poll_interval_sec, timing.countdown_display_refresh_interval_seconds);
+        return;
+    }
+
+    // The poll interval only acts as a heartbeat here, so account and position checks still run without new bars
+    trading_cycle_trigger->wait_for_event(timing.trader_wake_on_snapshot_update, std::chrono::seconds(timing.thread_trader_poll_interval_sec));
+}
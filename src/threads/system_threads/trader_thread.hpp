@@ -3,6 +3,7 @@
 
 #include "configs/timing_config.hpp"
 #include "trader/coordinators/trading_coordinator.hpp"
+#include "trader/coordinators/portfolio_coordinator.hpp"
 #include "trader/data_structures/data_structures.hpp"
 #include "trader/data_structures/data_sync_structures.hpp"
 #include <atomic>
@@ -13,16 +14,16 @@
 namespace AlpacaTrader {
 namespace Threads {
 
-using AlpacaTrader::Core::MarketSnapshot;
-using AlpacaTrader::Core::AccountSnapshot;
+using AlpacaTrader::Core::PublishedMarketSnapshot;
+using AlpacaTrader::Core::PublishedAccountSnapshot;
 
 struct TraderThread {
     const TimingConfig& timing;
     AlpacaTrader::Core::TradingCoordinator& trading_coordinator;
     std::mutex& state_mtx;
     std::condition_variable& data_cv;
-    MarketSnapshot& market_snapshot;
-    AccountSnapshot& account_snapshot;
+    PublishedMarketSnapshot& market_snapshot;
+    PublishedAccountSnapshot& account_snapshot;
     std::atomic<bool>& has_market;
     std::atomic<bool>& has_account;
     std::atomic<bool>& running;
@@ -33,14 +34,16 @@ struct TraderThread {
     std::atomic<unsigned long> loop_counter{0};
     std::atomic<unsigned long>* iteration_counter{nullptr};
     std::atomic<bool>* allow_fetch_ptr{nullptr};
+    AlpacaTrader::Core::TradingCycleTrigger* trading_cycle_trigger{nullptr};
+    AlpacaTrader::Core::PortfolioCoordinator* portfolio_coordinator{nullptr};
     double initial_equity;
 
     TraderThread(const TimingConfig& timing_config,
                 AlpacaTrader::Core::TradingCoordinator& coordinator_ref,
                 std::mutex& mtx,
                 std::condition_variable& cv,
-                MarketSnapshot& market_snapshot_ref,
-                AccountSnapshot& account_snapshot_ref,
+                PublishedMarketSnapshot& market_snapshot_ref,
+                PublishedAccountSnapshot& account_snapshot_ref,
                 std::atomic<bool>& has_market_flag,
                 std::atomic<bool>& has_account_flag,
                 std::atomic<bool>& running_flag,
@@ -60,12 +63,19 @@ struct TraderThread {
     // Set iteration counter for monitoring
     void set_iteration_counter(std::atomic<unsigned long>& counter) { iteration_counter = &counter; }
 
+    // Event-driven mode: wait on this trigger instead of the fixed countdown
+    void set_trading_cycle_trigger(AlpacaTrader::Core::TradingCycleTrigger& trigger) { trading_cycle_trigger = &trigger; }
+
+    // Multi-symbol mode: run portfolio cycles instead of the single-symbol trading cycle
+    void set_portfolio_coordinator(AlpacaTrader::Core::PortfolioCoordinator& coordinator) { portfolio_coordinator = &coordinator; }
+    
     // Thread entrypoint
     void operator()();
 
 private:
     // Thread lifecycle management
     void execute_trading_decision_loop();
+    void wait_for_next_cycle();
 };
 
 } // namespace Threads
@@ -80,6 +80,45 @@ bool Manager::setup_thread_priorities(ThreadManagerState& manager_state, const s
     }
 }
 
+bool Manager::setup_scheduler_worker_priorities(ThreadManagerState& manager_state, WorkStealingScheduler& task_scheduler, const std::string& worker_settings_name, const AlpacaTrader::Config::SystemConfig& config) 
+{
+    try {
+        const AlpacaTrader::Config::ThreadSettings& worker_settings = config.thread_registry.get_thread_settings(worker_settings_name);
+        std::vector<AlpacaTrader::Config::ThreadStatusData> worker_status_data;
+        
+        bool all_workers_configured = true;
+        for (size_t worker_index = 0; worker_index < task_scheduler.get_worker_thread_count(); ++worker_index) {
+            AlpacaTrader::Config::ThreadSettings platform_config = worker_settings;
+            platform_config.name = worker_settings.name + "_" + std::to_string(worker_index);
+            platform_config.cpu_affinity = (worker_settings.use_cpu_affinity && worker_settings.cpu_affinity >= 0)
+                ? worker_settings.cpu_affinity + static_cast<int>(worker_index) : -1;
+            
+            AlpacaTrader::Config::Priority actual_priority = task_scheduler.apply_worker_thread_settings(worker_index, platform_config);
+            bool configuration_success = (actual_priority == platform_config.priority);
+            if (!configuration_success) {
+                all_workers_configured = false;
+            }
+            
+            std::string priority_string = AlpacaTrader::Config::ConfigProvider::priority_to_string(platform_config.priority);
+            std::string status_message = configuration_success ? "Configured" : "Failed";
+            worker_status_data.emplace_back(platform_config.name, priority_string, configuration_success, platform_config.cpu_affinity, status_message);
+        }
+        
+        for (const auto& status_data : worker_status_data) {
+            manager_state.add_thread_status(status_data);
+        }
+        ThreadLogs::log_thread_status_table(worker_status_data);
+        
+        return all_workers_configured;
+    } catch (const std::exception& exception_error) {
+        ThreadLogs::log_thread_config_error(worker_settings_name, std::string("Exception setting up scheduler worker priorities: ") + exception_error.what());
+        return false;
+    } catch (...) {
+        ThreadLogs::log_thread_config_error(worker_settings_name, "Unknown exception setting up scheduler worker priorities");
+        return false;
+    }
+}
+
 bool Manager::configure_single_thread(ThreadManagerState& manager_state, const AlpacaTrader::Core::ThreadSystem::ThreadDefinition& thread_def, AlpacaTrader::Core::ThreadRegistry::Type thread_type, const AlpacaTrader::Config::SystemConfig& config) 
 {    
     try {
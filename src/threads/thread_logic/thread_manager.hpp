@@ -5,6 +5,7 @@
 #include "configs/timing_config.hpp"
 #include "thread_definition.hpp"
 #include "thread_registry.hpp"
+#include "work_stealing_scheduler.hpp"
 #include "logging/logs/thread_logs.hpp"
 #include "system/system_threads.hpp"
 #include "system/system_modules.hpp"
@@ -58,6 +59,8 @@ public:
     
     // Thread priority management
     static bool setup_thread_priorities(ThreadManagerState& manager_state, const std::vector<AlpacaTrader::Core::ThreadSystem::ThreadDefinition>& thread_definitions, const AlpacaTrader::Config::SystemConfig& config);
+    // Workers share one settings entry; with affinity enabled worker N is pinned to cpu_affinity + N
+    static bool setup_scheduler_worker_priorities(ThreadManagerState& manager_state, WorkStealingScheduler& task_scheduler, const std::string& worker_settings_name, const AlpacaTrader::Config::SystemConfig& config);
     
     
     // Exception-safe thread execution
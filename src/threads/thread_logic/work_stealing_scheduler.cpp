@@ -0,0 +1,177 @@
+#include "work_stealing_scheduler.hpp"
+#include "platform/thread_control.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+using ThreadSystem::Platform::ThreadControl;
+
+namespace AlpacaTrader {
+namespace Core {
+
+namespace {
+
+// Which scheduler and deque the calling thread works for (null outside every pool)
+thread_local const WorkStealingScheduler* current_worker_scheduler = nullptr;
+thread_local size_t current_worker_queue_index = 0;
+
+} // anonymous namespace
+
+WorkStealingScheduler::WorkStealingScheduler(int worker_thread_count)
+    : queued_task_count(0), next_external_queue_index(0), stolen_task_count(0), stop_requested(false) {
+    // Without workers a single deque is kept, drained by whoever waits
+    size_t queue_count = static_cast<size_t>(std::max(worker_thread_count, 1));
+    for (size_t queue_index = 0; queue_index < queue_count; ++queue_index) {
+        worker_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (int worker_index = 0; worker_index < worker_thread_count; ++worker_index) {
+        worker_threads.emplace_back(&WorkStealingScheduler::worker_loop, this, static_cast<size_t>(worker_index));
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+    {
+        std::lock_guard<std::mutex> sleep_guard(sleep_mutex);
+        stop_requested.store(true);
+    }
+    work_available_condition.notify_all();
+    for (std::thread& worker_thread : worker_threads) {
+        if (worker_thread.joinable()) {
+            worker_thread.join();
+        }
+    }
+}
+
+void WorkStealingScheduler::submit(TaskGroup& task_group, std::function<void()> task_function) {
+    task_group.pending_task_count.fetch_add(1, std::memory_order_relaxed);
+    
+    size_t queue_index = is_current_worker() ? current_worker_queue_index
+                                             : next_external_queue_index.fetch_add(1, std::memory_order_relaxed) % worker_queues.size();
+    {
+        std::lock_guard<std::mutex> queue_guard(worker_queues[queue_index]->queue_mutex);
+        worker_queues[queue_index]->queued_tasks.push_back(ScheduledTask{&task_group, std::move(task_function)});
+    }
+    queued_task_count.fetch_add(1, std::memory_order_release);
+    
+    // Taking the mutex orders this wake-up after a worker's check of queued_task_count
+    {
+        std::lock_guard<std::mutex> sleep_guard(sleep_mutex);
+    }
+    work_available_condition.notify_one();
+}
+
+void WorkStealingScheduler::wait(TaskGroup& task_group) {
+    std::minstd_rand victim_generator(static_cast<unsigned int>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+    
+    ScheduledTask scheduled_task;
+    while (!task_group.is_complete() && find_task(victim_generator, scheduled_task)) {
+        run_task(scheduled_task);
+    }
+    
+    // Nothing left to steal: the group's last tasks are running on other workers
+    std::unique_lock<std::mutex> sleep_lock(sleep_mutex);
+    group_complete_condition.wait(sleep_lock, [&task_group]() { return task_group.is_complete(); });
+}
+
+void WorkStealingScheduler::run_batch(size_t task_count, const std::function<void(size_t)>& batch_task) {
+    TaskGroup batch_group;
+    for (size_t task_index = 0; task_index < task_count; ++task_index) {
+        submit(batch_group, [&batch_task, task_index]() { batch_task(task_index); });
+    }
+    wait(batch_group);
+}
+
+AlpacaTrader::Config::Priority WorkStealingScheduler::apply_worker_thread_settings(size_t worker_index, const AlpacaTrader::Config::ThreadSettings& worker_settings) {
+    if (worker_index >= worker_threads.size()) {
+        throw std::out_of_range("Scheduler worker index " + std::to_string(worker_index) + " out of range");
+    }
+    return ThreadControl::set_priority_with_fallback(worker_threads[worker_index], worker_settings);
+}
+
+void WorkStealingScheduler::worker_loop(size_t worker_index) {
+    current_worker_scheduler = this;
+    current_worker_queue_index = worker_index;
+    std::minstd_rand victim_generator(static_cast<unsigned int>(worker_index + 1));
+    
+    while (true) {
+        ScheduledTask scheduled_task;
+        if (find_task(victim_generator, scheduled_task)) {
+            run_task(scheduled_task);
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> sleep_lock(sleep_mutex);
+        work_available_condition.wait(sleep_lock, [this]() {
+            return stop_requested.load() || queued_task_count.load(std::memory_order_acquire) > 0;
+        });
+        if (stop_requested.load()) {
+            return;
+        }
+    }
+}
+
+bool WorkStealingScheduler::is_current_worker() const {
+    return current_worker_scheduler == this;
+}
+
+bool WorkStealingScheduler::pop_local_task(size_t queue_index, ScheduledTask& task_output) {
+    WorkerQueue& worker_queue = *worker_queues[queue_index];
+    std::lock_guard<std::mutex> queue_guard(worker_queue.queue_mutex);
+    if (worker_queue.queued_tasks.empty()) {
+        return false;
+    }
+    task_output = std::move(worker_queue.queued_tasks.back());
+    worker_queue.queued_tasks.pop_back();
+    queued_task_count.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool WorkStealingScheduler::steal_task(size_t thief_queue_index, std::minstd_rand& victim_generator, ScheduledTask& task_output) {
+    size_t queue_count = worker_queues.size();
+    size_t first_victim_index = victim_generator() % queue_count;
+    
+    // Random starting victim, then every other deque once, so a queued task is never missed
+    for (size_t victim_offset = 0; victim_offset < queue_count; ++victim_offset) {
+        size_t victim_index = (first_victim_index + victim_offset) % queue_count;
+        if (victim_index == thief_queue_index) {
+            continue;
+        }
+        WorkerQueue& victim_queue = *worker_queues[victim_index];
+        std::lock_guard<std::mutex> queue_guard(victim_queue.queue_mutex);
+        if (!victim_queue.queued_tasks.empty()) {
+            task_output = std::move(victim_queue.queued_tasks.front());
+            victim_queue.queued_tasks.pop_front();
+            queued_task_count.fetch_sub(1, std::memory_order_relaxed);
+            stolen_task_count.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingScheduler::find_task(std::minstd_rand& victim_generator, ScheduledTask& task_output) {
+    if (is_current_worker()) {
+        return pop_local_task(current_worker_queue_index, task_output) ||
+               steal_task(current_worker_queue_index, victim_generator, task_output);
+    }
+    // Threads outside the pool own no deque and may take from any of them
+    return steal_task(worker_queues.size(), victim_generator, task_output);
+}
+
+void WorkStealingScheduler::run_task(ScheduledTask& scheduled_task) {
+    try {
+        scheduled_task.task_function();
+    } catch (...) {
+        // A throwing task must not take its worker thread down with it
+    }
+    // The group may be destroyed by its waiter as soon as the count reaches zero, so it is not touched again
+    if (scheduled_task.task_group->pending_task_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        {
+            std::lock_guard<std::mutex> sleep_guard(sleep_mutex);
+        }
+        group_complete_condition.notify_all();
+    }
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
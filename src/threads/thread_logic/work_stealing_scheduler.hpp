@@ -0,0 +1,91 @@
+#ifndef WORK_STEALING_SCHEDULER_HPP
+#define WORK_STEALING_SCHEDULER_HPP
+
+#include "threads/thread_logic/thread_types.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Task scheduler with one deque per worker. A worker runs its own newest task first and, when its
+// deque is empty, steals the oldest task of a randomly chosen other deque, so a burst of heavy tasks
+// queued on one worker spreads across the pool. Tasks submitted from outside the pool are dealt
+// round-robin over the deques, and a thread waiting on a group runs queued tasks before it blocks.
+class WorkStealingScheduler {
+public:
+    // Completion counter for tasks that are waited on together
+    class TaskGroup {
+    public:
+        TaskGroup() : pending_task_count(0) {}
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator=(const TaskGroup&) = delete;
+        
+        bool is_complete() const { return pending_task_count.load(std::memory_order_acquire) == 0; }
+        
+    private:
+        friend class WorkStealingScheduler;
+        std::atomic<size_t> pending_task_count;
+    };
+    
+    explicit WorkStealingScheduler(int worker_thread_count);
+    ~WorkStealingScheduler();
+    
+    WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+    
+    // Tasks report their own errors; anything thrown is dropped so a worker never dies
+    void submit(TaskGroup& task_group, std::function<void()> task_function);
+    // Runs queued tasks on the calling thread, then sleeps until the group's last running tasks finish
+    void wait(TaskGroup& task_group);
+    // Submits batch_task(index) for every index in [0, task_count) and waits for all of them
+    void run_batch(size_t task_count, const std::function<void(size_t)>& batch_task);
+    
+    // Priority and affinity through ThreadControl; returns the priority actually applied
+    AlpacaTrader::Config::Priority apply_worker_thread_settings(size_t worker_index, const AlpacaTrader::Config::ThreadSettings& worker_settings);
+    size_t get_worker_thread_count() const { return worker_threads.size(); }
+    uint64_t get_stolen_task_count() const { return stolen_task_count.load(std::memory_order_relaxed); }
+
+private:
+    struct ScheduledTask {
+        TaskGroup* task_group;
+        std::function<void()> task_function;
+    };
+    
+    // The owner pushes and pops at the back, thieves take from the front
+    struct WorkerQueue {
+        std::mutex queue_mutex;
+        std::deque<ScheduledTask> queued_tasks;
+    };
+    
+    // Declared before worker_threads: workers use the queues until they are joined
+    std::vector<std::unique_ptr<WorkerQueue>> worker_queues;
+    std::atomic<size_t> queued_task_count;
+    std::atomic<size_t> next_external_queue_index;
+    std::atomic<uint64_t> stolen_task_count;
+    std::atomic<bool> stop_requested;
+    std::mutex sleep_mutex;
+    std::condition_variable work_available_condition;
+    std::condition_variable group_complete_condition;
+    std::vector<std::thread> worker_threads;
+    
+    void worker_loop(size_t worker_index);
+    bool is_current_worker() const;
+    bool pop_local_task(size_t queue_index, ScheduledTask& task_output);
+    bool steal_task(size_t thief_queue_index, std::minstd_rand& victim_generator, ScheduledTask& task_output);
+    bool find_task(std::minstd_rand& victim_generator, ScheduledTask& task_output);
+    void run_task(ScheduledTask& scheduled_task);
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // WORK_STEALING_SCHEDULER_HPP
@@ -10,6 +10,45 @@ using json = nlohmann::json;
 namespace AlpacaTrader {
 namespace Core {
 
+namespace {
+
+PositionDetails parse_position_details(const json& position) {
+    PositionDetails details;
+    details.position_quantity = 0;
+    details.current_value = 0.0;
+    details.unrealized_pl = 0.0;
+    
+    if (position.contains("qty")) {
+        details.position_quantity = position["qty"].is_string() ? 
+            std::stoi(position["qty"].get<std::string>()) : 
+            position["qty"].get<int>();
+    }
+    
+    if (position.contains("market_value")) {
+        details.current_value = position["market_value"].is_string() ? 
+            std::stod(position["market_value"].get<std::string>()) : 
+            position["market_value"].get<double>();
+    }
+    
+    if (position.contains("unrealized_pl")) {
+        details.unrealized_pl = position["unrealized_pl"].is_string() ? 
+            std::stod(position["unrealized_pl"].get<std::string>()) : 
+            position["unrealized_pl"].get<double>();
+    }
+    
+    return details;
+}
+
+bool is_open_order_status(const json& order) {
+    if (!order.contains("status")) {
+        return false;
+    }
+    std::string status = order["status"].get<std::string>();
+    return status == "new" || status == "partially_filled" || status == "pending_new";
+}
+
+} // anonymous namespace
+
 AccountManager::AccountManager(const AccountDataThreadConfig& account_data_thread_config, API::ApiManager& api_mgr)
     : strategy(account_data_thread_config.strategy), api_manager(api_mgr),
       last_cache_time(std::chrono::steady_clock::now() - std::chrono::seconds(account_data_thread_config.timing.account_data_cache_duration_seconds + 1)) {}
@@ -88,27 +127,7 @@ PositionDetails AccountManager::fetch_position_details(const SymbolRequest& req_
         // Find position for the requested symbol
         for (const auto& position : positions_data) {
             if (position.contains("symbol") && position["symbol"].get<std::string>() == req_sym.symbol) {
-                PositionDetails details;
-                
-                if (position.contains("qty")) {
-                    details.position_quantity = position["qty"].is_string() ? 
-                        std::stoi(position["qty"].get<std::string>()) : 
-                        position["qty"].get<int>();
-                }
-                
-                if (position.contains("market_value")) {
-                    details.current_value = position["market_value"].is_string() ? 
-                        std::stod(position["market_value"].get<std::string>()) : 
-                        position["market_value"].get<double>();
-                }
-                
-                if (position.contains("unrealized_pl")) {
-                    details.unrealized_pl = position["unrealized_pl"].is_string() ? 
-                        std::stod(position["unrealized_pl"].get<std::string>()) : 
-                        position["unrealized_pl"].get<double>();
-                }
-                
-                return details;
+                return parse_position_details(position);
             }
         }
         
@@ -135,13 +154,8 @@ int AccountManager::fetch_open_orders_count(const SymbolRequest& req_sym) const
         int count = 0;
         
         for (const auto& order : orders_data) {
-            if (order.contains("symbol") && order["symbol"].get<std::string>() == req_sym.symbol) {
-                if (order.contains("status")) {
-                    std::string status = order["status"].get<std::string>();
-                    if (status == "new" || status == "partially_filled" || status == "pending_new") {
-                        count++;
-                    }
-                }
+            if (order.contains("symbol") && order["symbol"].get<std::string>() == req_sym.symbol && is_open_order_status(order)) {
+                count++;
             }
         }
         
@@ -152,6 +166,48 @@ int AccountManager::fetch_open_orders_count(const SymbolRequest& req_sym) const
     }
 }
 
+std::unordered_map<std::string, PositionDetails> AccountManager::fetch_all_position_details() const {
+    try {
+        std::unordered_map<std::string, PositionDetails> positions_by_symbol;
+        std::string positions_json = api_manager.get_positions();
+        if (positions_json.empty()) {
+            return positions_by_symbol; // No positions is valid
+        }
+        
+        json positions_data = json::parse(positions_json);
+        for (const auto& position : positions_data) {
+            if (position.contains("symbol")) {
+                positions_by_symbol[position["symbol"].get<std::string>()] = parse_position_details(position);
+            }
+        }
+        return positions_by_symbol;
+        
+    } catch (const std::exception& all_positions_exception_error) {
+        throw std::runtime_error("Failed to fetch all position details: " + std::string(all_positions_exception_error.what()));
+    }
+}
+
+std::unordered_map<std::string, int> AccountManager::fetch_all_open_orders_counts() const {
+    try {
+        std::unordered_map<std::string, int> open_orders_by_symbol;
+        std::string orders_json = api_manager.get_open_orders();
+        if (orders_json.empty()) {
+            return open_orders_by_symbol; // No orders is valid
+        }
+        
+        json orders_data = json::parse(orders_json);
+        for (const auto& order : orders_data) {
+            if (order.contains("symbol") && is_open_order_status(order)) {
+                open_orders_by_symbol[order["symbol"].get<std::string>()]++;
+            }
+        }
+        return open_orders_by_symbol;
+        
+    } catch (const std::exception& all_open_orders_exception_error) {
+        throw std::runtime_error("Failed to fetch all open orders counts: " + std::string(all_open_orders_exception_error.what()));
+    }
+}
+
 AccountSnapshot AccountManager::fetch_account_snapshot() const {
     AccountSnapshot snapshot;
     snapshot.equity = fetch_account_equity();
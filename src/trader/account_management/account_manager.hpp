@@ -6,6 +6,7 @@
 #include "trader/data_structures/data_structures.hpp"
 #include "api/general/api_manager.hpp"
 #include <string>
+#include <unordered_map>
 #include <chrono>
 #include <mutex>
 
@@ -46,6 +47,9 @@ public:
     double fetch_buying_power() const;
     PositionDetails fetch_position_details(const SymbolRequest& req_sym) const;
     int fetch_open_orders_count(const SymbolRequest& req_sym) const;
+    // Every open position / open order count keyed by symbol, from a single request each
+    std::unordered_map<std::string, PositionDetails> fetch_all_position_details() const;
+    std::unordered_map<std::string, int> fetch_all_open_orders_counts() const;
 
     AccountSnapshot fetch_account_snapshot() const;
     std::pair<AccountInfo, AccountSnapshot> fetch_account_data_bundled() const;
@@ -2,6 +2,7 @@
 #include "multi_api_config_loader.hpp"
 #include "configs/system_config.hpp"
 #include "configs/thread_config.hpp"
+#include "trader/data_structures/data_structures.hpp"
 #include "logging/logger/logging_macros.hpp"
 #include <fstream>
 #include <sstream>
@@ -24,6 +25,21 @@ namespace {
         return normalized_value == "1" || normalized_value == "true" || normalized_value == "yes";
     }
 
+    // Semicolon-separated list, e.g. 60;300
+    template <typename ValueType, typename ParseFunction>
+    std::vector<ValueType> parse_value_list(const std::string& input_value, ParseFunction parse_function) {
+        std::vector<ValueType> parsed_values;
+        std::stringstream values_stream(input_value);
+        std::string value_token;
+        while (std::getline(values_stream, value_token, ';')) {
+            value_token = trim(value_token);
+            if (!value_token.empty()) {
+                parsed_values.push_back(parse_function(value_token));
+            }
+        }
+        return parsed_values;
+    }
+
 }
 
 bool load_config_from_csv(AlpacaTrader::Config::SystemConfig& cfg, const std::string& csv_path) {
@@ -73,6 +89,12 @@ bool load_config_from_csv(AlpacaTrader::Config::SystemConfig& cfg, const std::st
                 // Map primary symbol to strategy symbol
                 cfg.strategy.symbol = config_value_string;
             }
+            else if (config_key_string == "trading_mode.enable_symbol_universe") {
+                cfg.trading_mode.enable_symbol_universe = (config_value_string == "true");
+            }
+            else if (config_key_string == "trading_mode.symbol_universe") {
+                cfg.trading_mode.symbol_universe = parse_value_list<std::string>(config_value_string, [](const std::string& token) { return token; });
+            }
         }
 
         // All API configuration handled by multi_api section
@@ -92,6 +114,10 @@ bool load_config_from_csv(AlpacaTrader::Config::SystemConfig& cfg, const std::st
         else if (config_key_string == "strategy.daily_bars_timeframe") cfg.strategy.daily_bars_timeframe = config_value_string;
         else if (config_key_string == "strategy.daily_bars_count") cfg.strategy.daily_bars_count = std::stoi(config_value_string);
         else if (config_key_string == "strategy.minimum_data_accumulation_seconds_before_trading") cfg.strategy.minimum_data_accumulation_seconds_before_trading = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.donchian_channel_bars") cfg.strategy.donchian_channel_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.stochastic_k_bars") cfg.strategy.stochastic_k_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.stochastic_d_bars") cfg.strategy.stochastic_d_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.swing_lookback_bars") cfg.strategy.swing_lookback_bars = std::stoi(config_value_string);
         else if (config_key_string == "strategy.entry_signal_atr_multiplier") cfg.strategy.entry_signal_atr_multiplier = std::stod(config_value_string);
         else if (config_key_string == "strategy.entry_signal_volume_multiplier") cfg.strategy.entry_signal_volume_multiplier = std::stod(config_value_string);
         else if (config_key_string == "strategy.crypto_volume_multiplier") cfg.strategy.crypto_volume_multiplier = std::stod(config_value_string);
@@ -102,6 +128,42 @@ bool load_config_from_csv(AlpacaTrader::Config::SystemConfig& cfg, const std::st
         else if (config_key_string == "strategy.average_atr_comparison_multiplier") cfg.strategy.average_atr_comparison_multiplier = std::stoi(config_value_string);
         else if (config_key_string == "strategy.atr_absolute_minimum_threshold") cfg.strategy.atr_absolute_minimum_threshold = std::stod(config_value_string);
         else if (config_key_string == "strategy.use_absolute_atr_threshold_instead_of_relative") cfg.strategy.use_absolute_atr_threshold = (config_value_string == "true");
+        else if (config_key_string == "strategy.use_rolling_percentile_filters") cfg.strategy.use_rolling_percentile_filters = (config_value_string == "true");
+        else if (config_key_string == "strategy.percentile_window_bars") cfg.strategy.percentile_window_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.minimum_percentile_samples") cfg.strategy.minimum_percentile_samples = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.minimum_atr_percentile") cfg.strategy.minimum_atr_percentile = std::stod(config_value_string);
+        else if (config_key_string == "strategy.minimum_volume_percentile") cfg.strategy.minimum_volume_percentile = std::stod(config_value_string);
+        else if (config_key_string == "strategy.ewma_volatility_decay") cfg.strategy.ewma_volatility_decay = std::stod(config_value_string);
+        else if (config_key_string == "strategy.garch_refit_window_bars") cfg.strategy.garch_refit_window_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.garch_refit_interval_bars") cfg.strategy.garch_refit_interval_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.high_volatility_regime_ratio") cfg.strategy.high_volatility_regime_ratio = std::stod(config_value_string);
+        else if (config_key_string == "strategy.low_volatility_regime_ratio") cfg.strategy.low_volatility_regime_ratio = std::stod(config_value_string);
+        else if (config_key_string == "strategy.volatility_regime_hysteresis") cfg.strategy.volatility_regime_hysteresis = std::stod(config_value_string);
+        else if (config_key_string == "strategy.enable_volatility_regime_adaptation") cfg.strategy.enable_volatility_regime_adaptation = (config_value_string == "true");
+        else if (config_key_string == "strategy.high_volatility_signal_threshold_multiplier") cfg.strategy.high_volatility_signal_threshold_multiplier = std::stod(config_value_string);
+        else if (config_key_string == "strategy.low_volatility_signal_threshold_multiplier") cfg.strategy.low_volatility_signal_threshold_multiplier = std::stod(config_value_string);
+        else if (config_key_string == "strategy.high_volatility_position_size_multiplier") cfg.strategy.high_volatility_position_size_multiplier = std::stod(config_value_string);
+        else if (config_key_string == "strategy.low_volatility_position_size_multiplier") cfg.strategy.low_volatility_position_size_multiplier = std::stod(config_value_string);
+        else if (config_key_string == "strategy.enable_multi_timeframe_confirmation") cfg.strategy.enable_multi_timeframe_confirmation = (config_value_string == "true");
+        else if (config_key_string == "strategy.confirmation_timeframes_seconds") cfg.strategy.confirmation_timeframes_seconds = parse_value_list<int>(config_value_string, [](const std::string& token) { return std::stoi(token); });
+        else if (config_key_string == "strategy.confirmation_timeframe_weights") cfg.strategy.confirmation_timeframe_weights = parse_value_list<double>(config_value_string, [](const std::string& token) { return std::stod(token); });
+        else if (config_key_string == "strategy.base_timeframe_signal_weight") cfg.strategy.base_timeframe_signal_weight = std::stod(config_value_string);
+        else if (config_key_string == "strategy.enable_oscillator_signals") cfg.strategy.enable_oscillator_signals = (config_value_string == "true");
+        else if (config_key_string == "strategy.rsi_period_bars") cfg.strategy.rsi_period_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.rsi_oversold_level") cfg.strategy.rsi_oversold_level = std::stod(config_value_string);
+        else if (config_key_string == "strategy.rsi_overbought_level") cfg.strategy.rsi_overbought_level = std::stod(config_value_string);
+        else if (config_key_string == "strategy.macd_fast_period_bars") cfg.strategy.macd_fast_period_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.macd_slow_period_bars") cfg.strategy.macd_slow_period_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.macd_signal_period_bars") cfg.strategy.macd_signal_period_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.bollinger_period_bars") cfg.strategy.bollinger_period_bars = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.bollinger_standard_deviations") cfg.strategy.bollinger_standard_deviations = std::stod(config_value_string);
+        else if (config_key_string == "strategy.oscillator_signal_weight") cfg.strategy.oscillator_signal_weight = std::stod(config_value_string);
+        else if (config_key_string == "strategy.portfolio_worker_threads") cfg.strategy.portfolio_worker_threads = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.max_portfolio_orders_per_cycle") cfg.strategy.max_portfolio_orders_per_cycle = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.max_portfolio_open_positions") cfg.strategy.max_portfolio_open_positions = std::stoi(config_value_string);
+        else if (config_key_string == "strategy.enable_strategy_ensemble") cfg.strategy.enable_strategy_ensemble = (config_value_string == "true");
+        else if (config_key_string == "strategy.strategy_variants") cfg.strategy.strategy_variant_names = parse_value_list<std::string>(config_value_string, [](const std::string& token) { return token; });
+        else if (config_key_string == "strategy.strategy_combiner_mode") cfg.strategy.strategy_combiner_mode = config_value_string;
         
         // Momentum signal configuration
                 else if (config_key_string == "strategy.minimum_price_change_percentage_for_momentum") {
@@ -213,6 +275,10 @@ bool load_config_from_csv(AlpacaTrader::Config::SystemConfig& cfg, const std::st
         else if (config_key_string == "timing.market_gate_thread_polling_interval_seconds") cfg.timing.thread_market_gate_poll_interval_sec = std::stoi(config_value_string);
         else if (config_key_string == "timing.trader_decision_thread_polling_interval_seconds") cfg.timing.thread_trader_poll_interval_sec = std::stoi(config_value_string);
         else if (config_key_string == "timing.logging_thread_polling_interval_seconds") cfg.timing.thread_logging_poll_interval_sec = std::stoi(config_value_string);
+        else if (config_key_string == "timing.enable_event_driven_trader_cycle") cfg.timing.enable_event_driven_trader_cycle = (config_value_string == "true");
+        else if (config_key_string == "timing.trader_wake_on_snapshot_update") cfg.timing.trader_wake_on_snapshot_update = (config_value_string == "true");
+        else if (config_key_string == "timing.skip_unchanged_trading_cycles") cfg.timing.skip_unchanged_trading_cycles = (config_value_string == "true");
+        else if (config_key_string == "timing.max_consecutive_unchanged_cycle_skips") cfg.timing.max_consecutive_unchanged_cycle_skips = std::stoi(config_value_string);
 
         // Market Session Buffer Times
         else if (config_key_string == "timing.pre_market_open_buffer_minutes") cfg.timing.pre_market_open_buffer_minutes = std::stoi(config_value_string);
@@ -366,6 +432,25 @@ bool load_thread_configs(AlpacaTrader::Config::SystemConfig& cfg, const std::str
     return true;
 }
 
+bool load_strategy_variants(AlpacaTrader::Config::SystemConfig& cfg) {
+    cfg.strategy_variants.clear();
+    if (!cfg.strategy.enable_strategy_ensemble) {
+        return true;
+    }
+
+    for (const std::string& variant_name : cfg.strategy.strategy_variant_names) {
+        // A variant file only lists the strategy keys it overrides
+        AlpacaTrader::Config::SystemConfig variant_config = cfg;
+        std::string variant_path = "config/strategy_variants/" + variant_name + ".csv";
+        if (!load_config_from_csv(variant_config, variant_path)) {
+            log_message("ERROR: Failed to load strategy variant from " + variant_path, "");
+            return false;
+        }
+        cfg.strategy_variants.push_back(StrategyVariantConfig{variant_name, variant_config.strategy});
+    }
+    return true;
+}
+
 int load_system_config(AlpacaTrader::Config::SystemConfig& config) {
     // Load configuration from separate logical files
     std::vector<std::string> config_files = {
@@ -384,6 +469,11 @@ int load_system_config(AlpacaTrader::Config::SystemConfig& config) {
         }
     }
 
+    // Load strategy ensemble variants on top of the primary strategy parameters
+    if (!load_strategy_variants(config)) {
+        return 1;
+    }
+
     // Load thread configurations
     std::string thread_config_path = std::string("config/thread_config.csv");
     if (!load_thread_configs(config, thread_config_path)) {
@@ -506,6 +596,160 @@ bool validate_config(const AlpacaTrader::Config::SystemConfig& config, std::stri
         error_message = "strategy.minimum_data_accumulation_seconds_before_trading must be >= 0";
         return false;
     }
+    
+    if (config.strategy.donchian_channel_bars < 1) {
+        error_message = "strategy.donchian_channel_bars must be >= 1";
+        return false;
+    }
+    
+    if (config.strategy.stochastic_k_bars < 1 || config.strategy.stochastic_d_bars < 1) {
+        error_message = "strategy.stochastic_k_bars and strategy.stochastic_d_bars must be >= 1";
+        return false;
+    }
+    
+    if (config.strategy.swing_lookback_bars < 1) {
+        error_message = "strategy.swing_lookback_bars must be >= 1";
+        return false;
+    }
+    
+    if (config.strategy.percentile_window_bars < 1) {
+        error_message = "strategy.percentile_window_bars must be >= 1";
+        return false;
+    }
+    
+    if (config.strategy.minimum_percentile_samples < 1 || config.strategy.minimum_percentile_samples > config.strategy.percentile_window_bars) {
+        error_message = "strategy.minimum_percentile_samples must be between 1 and strategy.percentile_window_bars";
+        return false;
+    }
+    
+    if (config.strategy.minimum_atr_percentile < 0.0 || config.strategy.minimum_atr_percentile > 1.0 ||
+        config.strategy.minimum_volume_percentile < 0.0 || config.strategy.minimum_volume_percentile > 1.0) {
+        error_message = "strategy.minimum_atr_percentile and strategy.minimum_volume_percentile must be between 0.0 and 1.0";
+        return false;
+    }
+    
+    if (config.strategy.ewma_volatility_decay <= 0.0 || config.strategy.ewma_volatility_decay >= 1.0) {
+        error_message = "strategy.ewma_volatility_decay must be between 0.0 and 1.0 (exclusive)";
+        return false;
+    }
+    
+    if (config.strategy.garch_refit_window_bars < 50 || config.strategy.garch_refit_interval_bars < 1) {
+        error_message = "strategy.garch_refit_window_bars must be >= 50 and strategy.garch_refit_interval_bars must be >= 1";
+        return false;
+    }
+    
+    if (config.strategy.low_volatility_regime_ratio <= 0.0 || config.strategy.high_volatility_regime_ratio <= config.strategy.low_volatility_regime_ratio) {
+        error_message = "strategy.low_volatility_regime_ratio must be > 0 and below strategy.high_volatility_regime_ratio";
+        return false;
+    }
+    
+    if (config.strategy.volatility_regime_hysteresis < 0.0) {
+        error_message = "strategy.volatility_regime_hysteresis must be >= 0";
+        return false;
+    }
+    
+    if (config.strategy.high_volatility_signal_threshold_multiplier <= 0.0 || config.strategy.low_volatility_signal_threshold_multiplier <= 0.0 ||
+        config.strategy.high_volatility_position_size_multiplier < 0.0 || config.strategy.low_volatility_position_size_multiplier < 0.0) {
+        error_message = "strategy volatility regime signal multipliers must be > 0 and position size multipliers must be >= 0";
+        return false;
+    }
+    
+    if (config.strategy.enable_multi_timeframe_confirmation) {
+        if (config.strategy.confirmation_timeframes_seconds.empty() ||
+            config.strategy.confirmation_timeframes_seconds.size() > static_cast<size_t>(AlpacaTrader::Core::MultiTimeframeInputs::MAXIMUM_TIMEFRAMES)) {
+            error_message = "strategy.confirmation_timeframes_seconds must list 1 to " + std::to_string(AlpacaTrader::Core::MultiTimeframeInputs::MAXIMUM_TIMEFRAMES) + " timeframes";
+            return false;
+        }
+        if (config.strategy.confirmation_timeframe_weights.size() != config.strategy.confirmation_timeframes_seconds.size()) {
+            error_message = "strategy.confirmation_timeframe_weights must have one weight per confirmation timeframe";
+            return false;
+        }
+        int previous_timeframe_seconds = 0;
+        for (int timeframe_seconds : config.strategy.confirmation_timeframes_seconds) {
+            if (timeframe_seconds <= previous_timeframe_seconds) {
+                error_message = "strategy.confirmation_timeframes_seconds must be positive and increasing";
+                return false;
+            }
+            previous_timeframe_seconds = timeframe_seconds;
+        }
+        double total_weight = config.strategy.base_timeframe_signal_weight;
+        for (double timeframe_weight : config.strategy.confirmation_timeframe_weights) {
+            if (timeframe_weight < 0.0) {
+                error_message = "strategy.confirmation_timeframe_weights must be >= 0";
+                return false;
+            }
+            total_weight += timeframe_weight;
+        }
+        if (config.strategy.base_timeframe_signal_weight < 0.0 || total_weight <= 0.0) {
+            error_message = "strategy.base_timeframe_signal_weight must be >= 0 and the weights must not all be 0";
+            return false;
+        }
+    }
+    
+    if (config.strategy.enable_oscillator_signals) {
+        if (config.strategy.rsi_period_bars < 1 || config.strategy.macd_fast_period_bars < 1 || config.strategy.macd_signal_period_bars < 1 ||
+            config.strategy.bollinger_period_bars < 1) {
+            error_message = "strategy oscillator periods must be >= 1";
+            return false;
+        }
+        if (config.strategy.macd_fast_period_bars >= config.strategy.macd_slow_period_bars) {
+            error_message = "strategy.macd_fast_period_bars must be less than strategy.macd_slow_period_bars";
+            return false;
+        }
+        if (config.strategy.rsi_oversold_level < 0.0 || config.strategy.rsi_oversold_level >= config.strategy.rsi_overbought_level ||
+            config.strategy.rsi_overbought_level > 100.0) {
+            error_message = "strategy.rsi_oversold_level and strategy.rsi_overbought_level must satisfy 0 <= oversold < overbought <= 100";
+            return false;
+        }
+        if (config.strategy.bollinger_standard_deviations <= 0.0 || config.strategy.oscillator_signal_weight < 0.0) {
+            error_message = "strategy.bollinger_standard_deviations must be > 0 and strategy.oscillator_signal_weight must be >= 0";
+            return false;
+        }
+        // The kernels run over the fetched bars only, so the slowest oscillator must fit inside them
+        int oscillator_warmup_bars = std::max({config.strategy.rsi_period_bars + 1,
+                                               config.strategy.macd_slow_period_bars + config.strategy.macd_signal_period_bars,
+                                               config.strategy.bollinger_period_bars,
+                                               config.strategy.stochastic_k_bars + config.strategy.stochastic_d_bars - 1});
+        if (config.strategy.bars_to_fetch_for_calculations < oscillator_warmup_bars) {
+            error_message = "strategy.bars_to_fetch_for_calculations must be >= " + std::to_string(oscillator_warmup_bars) + " when strategy.enable_oscillator_signals is true";
+            return false;
+        }
+    }
+
+    // Validate multi-symbol portfolio configuration
+    if (config.trading_mode.enable_symbol_universe) {
+        if (config.trading_mode.symbol_universe.empty()) {
+            error_message = "trading_mode.symbol_universe must list at least one symbol when trading_mode.enable_symbol_universe is true";
+            return false;
+        }
+        if (config.strategy.portfolio_worker_threads < 0) {
+            error_message = "strategy.portfolio_worker_threads must be >= 0";
+            return false;
+        }
+        if (config.strategy.max_portfolio_orders_per_cycle < 1 || config.strategy.max_portfolio_open_positions < 1) {
+            error_message = "strategy.max_portfolio_orders_per_cycle and strategy.max_portfolio_open_positions must be >= 1";
+            return false;
+        }
+    }
+
+    // Validate strategy ensemble configuration
+    if (config.strategy.enable_strategy_ensemble) {
+        if (config.strategy.strategy_variant_names.empty()) {
+            error_message = "strategy.strategy_variants must list at least one variant when strategy.enable_strategy_ensemble is true";
+            return false;
+        }
+        if (config.strategy.strategy_combiner_mode != "strongest" && config.strategy.strategy_combiner_mode != "majority" &&
+            config.strategy.strategy_combiner_mode != "unanimous") {
+            error_message = "strategy.strategy_combiner_mode must be strongest, majority or unanimous";
+            return false;
+        }
+        for (const StrategyVariantConfig& strategy_variant : config.strategy_variants) {
+            if (strategy_variant.strategy.minimum_signal_strength_threshold < 0.0 || strategy_variant.strategy.minimum_signal_strength_threshold > 1.0) {
+                error_message = "strategy.minimum_signal_strength_threshold of variant " + strategy_variant.variant_name + " must be between 0.0 and 1.0";
+                return false;
+            }
+        }
+    }
 
     // Validate daily bars timeframe
     if (config.strategy.daily_bars_timeframe.empty()) {
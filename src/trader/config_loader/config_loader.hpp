@@ -5,6 +5,7 @@
 #include "configs/system_config.hpp"
 
 bool load_config_from_csv(AlpacaTrader::Config::SystemConfig& cfg, const std::string& csv_path);
+bool load_strategy_variants(AlpacaTrader::Config::SystemConfig& cfg);
 bool load_thread_configs(AlpacaTrader::Config::SystemConfig& cfg, const std::string& thread_config_path);
 int load_system_config(AlpacaTrader::Config::SystemConfig& config);
 bool validate_config(const AlpacaTrader::Config::SystemConfig& config, std::string& errorMessage);
@@ -132,6 +132,17 @@ void MultiApiConfigLoader::parse_provider_config(const std::string& key, const s
         if (!value.empty()) {
             provider_config.websocket_second_level_accumulation_seconds = std::stoi(value);
         }
+    } else if (field == "websocket_higher_timeframes_seconds") {
+        // Semicolon-separated list, e.g. 60;300;900;3600
+        provider_config.websocket_higher_timeframes_seconds.clear();
+        std::stringstream timeframes_stream(value);
+        std::string timeframe_token;
+        while (std::getline(timeframes_stream, timeframe_token, ';')) {
+            timeframe_token = trim(timeframe_token);
+            if (!timeframe_token.empty()) {
+                provider_config.websocket_higher_timeframes_seconds.push_back(std::stoi(timeframe_token));
+            }
+        }
     } else if (field == "websocket_max_bar_history_size") {
         if (!value.empty()) {
             provider_config.websocket_max_bar_history_size = std::stoi(value);
@@ -287,6 +298,13 @@ void MultiApiConfigLoader::validate_provider_config(Config::ApiProvider provider
             if (config.websocket_second_level_accumulation_seconds % config.websocket_bar_accumulation_seconds != 0) {
                 throw std::runtime_error("websocket_second_level_accumulation_seconds must be a multiple of websocket_bar_accumulation_seconds for polygon_crypto provider");
             }
+            int previous_timeframe_seconds = config.websocket_second_level_accumulation_seconds;
+            for (int timeframe_seconds : config.websocket_higher_timeframes_seconds) {
+                if (timeframe_seconds <= previous_timeframe_seconds || timeframe_seconds % previous_timeframe_seconds != 0) {
+                    throw std::runtime_error("websocket_higher_timeframes_seconds must be increasing and each a multiple of the previous timeframe for polygon_crypto provider");
+                }
+                previous_timeframe_seconds = timeframe_seconds;
+            }
         }
     }
 }
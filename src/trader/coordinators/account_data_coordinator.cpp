@@ -9,6 +9,19 @@ namespace Core {
 using AlpacaTrader::Logging::AccountLogs;
 using AlpacaTrader::Logging::MarketDataLogs;
 
+namespace {
+
+bool same_account_values(const AccountSnapshot& previous_snapshot, const AccountSnapshot& current_snapshot) {
+    return previous_snapshot.equity == current_snapshot.equity &&
+           previous_snapshot.pos_details.position_quantity == current_snapshot.pos_details.position_quantity &&
+           previous_snapshot.pos_details.unrealized_pl == current_snapshot.pos_details.unrealized_pl &&
+           previous_snapshot.pos_details.current_value == current_snapshot.pos_details.current_value &&
+           previous_snapshot.open_orders == current_snapshot.open_orders &&
+           previous_snapshot.exposure_pct == current_snapshot.exposure_pct;
+}
+
+} // anonymous namespace
+
 AccountDataCoordinator::AccountDataCoordinator(AccountManager& account_manager_ref)
     : account_manager(account_manager_ref) {}
 
@@ -19,9 +32,14 @@ AccountSnapshot AccountDataCoordinator::fetch_current_account_snapshot() {
 void AccountDataCoordinator::update_shared_account_snapshot(AccountDataSnapshotState& snapshot_state) {
     AccountSnapshot current_snapshot = retrieve_account_data_from_manager();
     
+    // Only this thread publishes the account snapshot; readers copy it without the state mutex
+    AccountSnapshot previous_snapshot = snapshot_state.account_snapshot.load();
+    bool account_changed = !snapshot_state.has_account_flag.load() || !same_account_values(previous_snapshot, current_snapshot);
+    current_snapshot.data_generation = account_changed ? previous_snapshot.data_generation + 1 : previous_snapshot.data_generation;
+    snapshot_state.account_snapshot.publish(current_snapshot);
+    
     {
         std::lock_guard<std::mutex> state_lock(snapshot_state.state_mutex);
-        snapshot_state.account_snapshot = current_snapshot;
         snapshot_state.has_account_flag.store(true);
     }
     
@@ -52,7 +70,7 @@ AccountSnapshot AccountDataCoordinator::retrieve_account_data_from_manager() {
     }
 }
 
-void AccountDataCoordinator::fetch_and_update_account_data(AccountSnapshot& account_snapshot_ref,
+void AccountDataCoordinator::fetch_and_update_account_data(PublishedAccountSnapshot& account_snapshot_ref,
                                                            std::mutex& state_mutex_ref,
                                                            std::condition_variable& data_condition_variable_ref,
                                                            std::atomic<bool>& has_account_flag_ref) {
@@ -4,6 +4,7 @@
 #include "configs/system_config.hpp"
 #include "trader/account_management/account_manager.hpp"
 #include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/seqlock_snapshot.hpp"
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
@@ -14,7 +15,7 @@ namespace Core {
 class AccountDataCoordinator {
 public:
     struct AccountDataSnapshotState {
-        AccountSnapshot& account_snapshot;
+        PublishedAccountSnapshot& account_snapshot;
         std::mutex& state_mutex;
         std::condition_variable& data_condition_variable;
         std::atomic<bool>& has_account_flag;
@@ -24,7 +25,7 @@ public:
     
     AccountSnapshot fetch_current_account_snapshot();
     void update_shared_account_snapshot(AccountDataSnapshotState& snapshot_state);
-    void fetch_and_update_account_data(AccountSnapshot& account_snapshot_ref, 
+    void fetch_and_update_account_data(PublishedAccountSnapshot& account_snapshot_ref, 
                                        std::mutex& state_mutex_ref,
                                        std::condition_variable& data_condition_variable_ref,
                                        std::atomic<bool>& has_account_flag_ref);
@@ -16,135 +16,85 @@ using namespace AlpacaTrader::Logging;
 namespace AlpacaTrader {
 namespace Core {
 
+namespace {
+
+bool same_bar_values(const Bar& previous_bar, const Bar& current_bar) {
+    return previous_bar.timestamp_ns == current_bar.timestamp_ns && previous_bar.open_price == current_bar.open_price &&
+           previous_bar.high_price == current_bar.high_price && previous_bar.low_price == current_bar.low_price &&
+           previous_bar.close_price == current_bar.close_price && previous_bar.volume == current_bar.volume;
+}
+
+// Only consulted when a fetch fails, to tell a dead feed apart from one that is still warming up
+bool is_crypto_websocket_active(API::ApiManager& api_manager, const std::string& trading_symbol) {
+    try {
+        if (api_manager.is_crypto_symbol(trading_symbol)) {
+            API::PolygonCryptoClient* polygon_client = api_manager.get_polygon_crypto_client();
+            return polygon_client && polygon_client->is_websocket_active();
+        }
+    } catch (...) {
+        // Could not determine WebSocket status, default to false
+    }
+    return false;
+}
+
+} // anonymous namespace
+
 MarketDataCoordinator::MarketDataCoordinator(MarketDataManager& market_data_manager_ref)
     : market_data_manager(market_data_manager_ref) {}
 
-ProcessedData MarketDataCoordinator::fetch_and_process_market_data(const std::string& trading_symbol, std::vector<Bar>& historical_bars_output) {
+ProcessedDataResult MarketDataCoordinator::fetch_and_process_market_data(const std::string& trading_symbol, BarSeries& historical_bar_series_output) {
     // Validate symbol matches MarketDataManager's configured symbol
     const SystemConfig& manager_config = market_data_manager.get_config();
     if (!trading_symbol.empty() && trading_symbol != manager_config.strategy.symbol) {
         MarketDataThreadLogs::log_thread_loop_exception("Symbol mismatch: requested " + trading_symbol + " but manager configured for " + manager_config.strategy.symbol);
     }
     
-    try {
-        // Log market data fetch start
-        MarketDataLogs::log_market_data_fetch_table(trading_symbol, manager_config.logging.log_file);
-        
-        // MarketDataManager fetches bars internally and returns them to avoid duplicate fetching
-        auto fetch_result = market_data_manager.fetch_and_process_market_data();
-        
-        ProcessedData processed_data = fetch_result.first;
-        historical_bars_output = fetch_result.second;
-        
-        // Log position data and warnings
-        MarketDataLogs::log_position_data_and_warnings(
-            processed_data.pos_details.position_quantity,
-            processed_data.pos_details.current_value,
-            processed_data.pos_details.unrealized_pl,
-            processed_data.exposure_pct,
-            processed_data.open_orders,
-            manager_config.logging.log_file,
-            manager_config.strategy.position_long_string,
-            manager_config.strategy.position_short_string
-        );
-        
-        return processed_data;
-        
-    } catch (const std::runtime_error& runtime_error) {
-        // Try to extract bars count from error message if available
-        size_t bars_count = 0;
-        std::string error_msg = runtime_error.what();
-        size_t bars_pos = error_msg.find("Bars fetched: ");
-        if (bars_pos != std::string::npos) {
-            size_t num_start = bars_pos + 14;
-            size_t num_end = error_msg.find(".", num_start);
-            if (num_end != std::string::npos) {
-                try {
-                    bars_count = std::stoul(error_msg.substr(num_start, num_end - num_start));
-                } catch (...) {
-                    // Ignore parse errors
-                }
-            }
-        }
-        
-        bool isWebSocketActiveFlagValue = false;
-        try {
-            API::ApiManager& apiManagerReference = market_data_manager.get_api_manager();
-            if (apiManagerReference.is_crypto_symbol(trading_symbol)) {
-                API::PolygonCryptoClient* polygonClientPointer = apiManagerReference.get_polygon_crypto_client();
-                if (polygonClientPointer) {
-                    isWebSocketActiveFlagValue = polygonClientPointer->is_websocket_active();
-                }
-            }
-        } catch (...) {
-            // Could not determine WebSocket status, default to false
-        }
-        
-        MarketDataLogs::log_market_data_failure_table(
-            trading_symbol,
-            "Runtime Error",
-            error_msg,
-            bars_count,
-            isWebSocketActiveFlagValue,
-            manager_config.logging.log_file
-        );
-        return ProcessedData{};
-    } catch (const std::exception& exception_error) {
-        bool isWebSocketActiveFlagValue = false;
-        try {
-            API::ApiManager& apiManagerReference = market_data_manager.get_api_manager();
-            if (apiManagerReference.is_crypto_symbol(trading_symbol)) {
-                API::PolygonCryptoClient* polygonClientPointer = apiManagerReference.get_polygon_crypto_client();
-                if (polygonClientPointer) {
-                    isWebSocketActiveFlagValue = polygonClientPointer->is_websocket_active();
-                }
-            }
-        } catch (...) {
-            // Could not determine WebSocket status, default to false
-        }
-        
-        MarketDataLogs::log_market_data_failure_table(
-            trading_symbol,
-            "Exception",
-            std::string("Exception in fetch_and_process_market_data: ") + exception_error.what(),
-            0,
-            isWebSocketActiveFlagValue,
-            manager_config.logging.log_file
-        );
-        return ProcessedData{};
-    } catch (...) {
-        bool isWebSocketActiveFlagValue = false;
-        try {
-            API::ApiManager& apiManagerReference = market_data_manager.get_api_manager();
-            if (apiManagerReference.is_crypto_symbol(trading_symbol)) {
-                API::PolygonCryptoClient* polygonClientPointer = apiManagerReference.get_polygon_crypto_client();
-                if (polygonClientPointer) {
-                    isWebSocketActiveFlagValue = polygonClientPointer->is_websocket_active();
-                }
-            }
-        } catch (...) {
-            // Could not determine WebSocket status, default to false
-        }
-        
+    // Log market data fetch start
+    MarketDataLogs::log_market_data_fetch_table(trading_symbol, manager_config.logging.log_file);
+    
+    // MarketDataManager fetches bars internally and fills the series to avoid duplicate fetching
+    ProcessedDataResult processed_data_result = market_data_manager.fetch_and_process_market_data(historical_bar_series_output);
+    if (!processed_data_result) {
+        const MarketDataError& market_data_error = processed_data_result.error();
         MarketDataLogs::log_market_data_failure_table(
             trading_symbol,
-            "Unknown Error",
-            "Unknown exception in fetch_and_process_market_data",
-            0,
-            isWebSocketActiveFlagValue,
+            market_data_status_name(market_data_error.status),
+            market_data_error.message,
+            market_data_error.bars_available,
+            is_crypto_websocket_active(market_data_manager.get_api_manager(), trading_symbol),
             manager_config.logging.log_file
         );
-        return ProcessedData{};
+        return processed_data_result;
     }
+    
+    // Log position data and warnings
+    const ProcessedData& processed_data = processed_data_result.value();
+    MarketDataLogs::log_position_data_and_warnings(
+        processed_data.pos_details.position_quantity,
+        processed_data.pos_details.current_value,
+        processed_data.pos_details.unrealized_pl,
+        processed_data.exposure_pct,
+        processed_data.open_orders,
+        manager_config.logging.log_file,
+        manager_config.strategy.position_long_string,
+        manager_config.strategy.position_short_string
+    );
+    
+    return processed_data_result;
 }
 
 void MarketDataCoordinator::update_shared_market_snapshot(const ProcessedData& processed_data_result, MarketDataSnapshotState& snapshot_state) {
     if (processed_data_result.atr == 0.0) {
-        MarketDataThreadLogs::log_zero_atr_warning(processed_data_result.curr.timestamp.empty() ? "UNKNOWN" : processed_data_result.curr.timestamp);
+        MarketDataThreadLogs::log_zero_atr_warning(processed_data_result.curr.timestamp_ns == 0 ? "UNKNOWN" : TimeUtils::format_epoch_nanoseconds_human_readable(processed_data_result.curr.timestamp_ns));
         return;
     }
     
-    std::lock_guard<std::mutex> state_lock(snapshot_state.state_mutex);
+    // Only this thread publishes the market snapshot, so reading back the last publication never retries
+    MarketSnapshot published_snapshot = snapshot_state.market_snapshot.load();
+    
+    bool bar_closed = !snapshot_state.has_market_flag.load() || published_snapshot.curr.timestamp_ns != processed_data_result.curr.timestamp_ns;
+    bool bars_changed = bar_closed || !same_bar_values(published_snapshot.curr, processed_data_result.curr) ||
+                        !same_bar_values(published_snapshot.prev, processed_data_result.prev);
     
     if (processed_data_result.curr.open_price > 0.0 && (processed_data_result.curr.high_price == 0.0 || processed_data_result.curr.low_price == 0.0 || processed_data_result.curr.close_price == 0.0)) {
         MarketDataThreadLogs::log_thread_loop_exception("ProcessedData has incomplete bar data - O:" + 
@@ -152,32 +102,54 @@ void MarketDataCoordinator::update_shared_market_snapshot(const ProcessedData& p
             " L:" + std::to_string(processed_data_result.curr.low_price) + " C:" + std::to_string(processed_data_result.curr.close_price));
     }
     
-    snapshot_state.market_snapshot.atr = processed_data_result.atr;
-    snapshot_state.market_snapshot.avg_atr = processed_data_result.avg_atr;
-    snapshot_state.market_snapshot.avg_vol = processed_data_result.avg_vol;
-    
-    snapshot_state.market_snapshot.curr.open_price = processed_data_result.curr.open_price;
-    snapshot_state.market_snapshot.curr.high_price = processed_data_result.curr.high_price;
-    snapshot_state.market_snapshot.curr.low_price = processed_data_result.curr.low_price;
-    snapshot_state.market_snapshot.curr.close_price = processed_data_result.curr.close_price;
-    snapshot_state.market_snapshot.curr.volume = processed_data_result.curr.volume;
-    snapshot_state.market_snapshot.curr.timestamp = processed_data_result.curr.timestamp;
-    
-    snapshot_state.market_snapshot.prev.open_price = processed_data_result.prev.open_price;
-    snapshot_state.market_snapshot.prev.high_price = processed_data_result.prev.high_price;
-    snapshot_state.market_snapshot.prev.low_price = processed_data_result.prev.low_price;
-    snapshot_state.market_snapshot.prev.close_price = processed_data_result.prev.close_price;
-    snapshot_state.market_snapshot.prev.volume = processed_data_result.prev.volume;
-    snapshot_state.market_snapshot.prev.timestamp = processed_data_result.prev.timestamp;
-    
-    snapshot_state.market_snapshot.oldest_bar_timestamp = processed_data_result.oldest_bar_timestamp;
-    
-    if (snapshot_state.market_snapshot.curr.open_price > 0.0 && (snapshot_state.market_snapshot.curr.high_price == 0.0 || snapshot_state.market_snapshot.curr.low_price == 0.0 || snapshot_state.market_snapshot.curr.close_price == 0.0)) {
-        MarketDataThreadLogs::log_thread_loop_exception("Snapshot has incomplete bar data after copy - O:" + 
-            std::to_string(snapshot_state.market_snapshot.curr.open_price) + " H:" + std::to_string(snapshot_state.market_snapshot.curr.high_price) + 
-            " L:" + std::to_string(snapshot_state.market_snapshot.curr.low_price) + " C:" + std::to_string(snapshot_state.market_snapshot.curr.close_price));
+    published_snapshot.atr = processed_data_result.atr;
+    published_snapshot.avg_atr = processed_data_result.avg_atr;
+    published_snapshot.avg_vol = processed_data_result.avg_vol;
+    
+    published_snapshot.curr.open_price = processed_data_result.curr.open_price;
+    published_snapshot.curr.high_price = processed_data_result.curr.high_price;
+    published_snapshot.curr.low_price = processed_data_result.curr.low_price;
+    published_snapshot.curr.close_price = processed_data_result.curr.close_price;
+    published_snapshot.curr.volume = processed_data_result.curr.volume;
+    published_snapshot.curr.timestamp_ns = processed_data_result.curr.timestamp_ns;
+    
+    published_snapshot.prev.open_price = processed_data_result.prev.open_price;
+    published_snapshot.prev.high_price = processed_data_result.prev.high_price;
+    published_snapshot.prev.low_price = processed_data_result.prev.low_price;
+    published_snapshot.prev.close_price = processed_data_result.prev.close_price;
+    published_snapshot.prev.volume = processed_data_result.prev.volume;
+    published_snapshot.prev.timestamp_ns = processed_data_result.prev.timestamp_ns;
+    
+    published_snapshot.oldest_bar_timestamp_ns = processed_data_result.oldest_bar_timestamp_ns;
+    
+    published_snapshot.donchian_upper = processed_data_result.donchian_upper;
+    published_snapshot.donchian_lower = processed_data_result.donchian_lower;
+    published_snapshot.stochastic_k = processed_data_result.stochastic_k;
+    published_snapshot.stochastic_d = processed_data_result.stochastic_d;
+    published_snapshot.swing_high = processed_data_result.swing_high;
+    published_snapshot.swing_low = processed_data_result.swing_low;
+    published_snapshot.swing_is_upswing = processed_data_result.swing_is_upswing;
+    published_snapshot.atr_percentile = processed_data_result.atr_percentile;
+    published_snapshot.volume_percentile = processed_data_result.volume_percentile;
+    published_snapshot.spread_percentile = processed_data_result.spread_percentile;
+    published_snapshot.percentile_sample_count = processed_data_result.percentile_sample_count;
+    published_snapshot.ewma_volatility = processed_data_result.ewma_volatility;
+    published_snapshot.garch_volatility = processed_data_result.garch_volatility;
+    published_snapshot.volatility_ratio = processed_data_result.volatility_ratio;
+    published_snapshot.volatility_regime = processed_data_result.volatility_regime;
+    if (bars_changed) {
+        published_snapshot.data_generation++;
     }
     
+    // Readers copy the snapshot without the state mutex, so publishing never waits on the trader thread.
+    // Confirmation inputs go first: a reader that sees the new bars also finds their rolled-up timeframes.
+    if (market_data_manager.get_config().strategy.enable_multi_timeframe_confirmation) {
+        snapshot_state.market_snapshot.multi_timeframe_inputs.publish(processed_data_result.multi_timeframe_inputs);
+    }
+    snapshot_state.market_snapshot.publish(published_snapshot);
+    
+    // Flags and the wake-up stay under the mutex so condition variable waiters cannot miss them
+    std::unique_lock<std::mutex> state_lock(snapshot_state.state_mutex);
     snapshot_state.has_market_flag.store(true);
     
     auto current_timestamp = std::chrono::steady_clock::now();
@@ -185,13 +157,27 @@ void MarketDataCoordinator::update_shared_market_snapshot(const ProcessedData& p
     snapshot_state.market_data_fresh_flag.store(true);
     
     snapshot_state.data_condition_variable.notify_all();
+    state_lock.unlock();
+    
+    // A new latest bar means the previous one just closed, which is what the event-driven trader waits for
+    if (snapshot_state.trading_cycle_trigger) {
+        if (bar_closed) {
+            snapshot_state.trading_cycle_trigger->notify_bar_close();
+        } else {
+            snapshot_state.trading_cycle_trigger->notify_snapshot_update();
+        }
+    }
 }
 
 void MarketDataCoordinator::process_market_data_iteration(const std::string& symbol, MarketDataSnapshotState& snapshot_state, std::chrono::steady_clock::time_point& last_bar_log_time, Bar& previous_bar) {
     try {
 
-        std::vector<Bar> historical_bars_for_logging;
-        ProcessedData computed_data = fetch_and_process_market_data(symbol, historical_bars_for_logging);
+        ProcessedDataResult computed_data_result = fetch_and_process_market_data(symbol, historical_bar_series);
+        if (!computed_data_result) {
+            // Already logged with its status; warm-up simply waits for the next iteration
+            return;
+        }
+        const ProcessedData& computed_data = computed_data_result.value();
         
         if (computed_data.atr == 0.0) {
             MarketDataThreadLogs::log_zero_atr_warning(symbol);
@@ -204,12 +190,12 @@ void MarketDataCoordinator::process_market_data_iteration(const std::string& sym
         // This ensures we log the bars we're actually using for trading decisions
         try {
             auto* logging_context = AlpacaTrader::Logging::get_logging_context();
-            if (logging_context && logging_context->csv_bars_logger && !historical_bars_for_logging.empty()) {
+            if (logging_context && logging_context->csv_bars_logger && !historical_bar_series.empty()) {
                 std::string current_timestamp = TimeUtils::get_current_human_readable_time();
                 
                 // Log the latest bar (the one we're using for trading decisions)
-                const auto& latest_bar = historical_bars_for_logging.back();
-                std::string bar_timestamp = latest_bar.timestamp.empty() ? current_timestamp : latest_bar.timestamp;
+                const Bar latest_bar = historical_bar_series.latest_bar();
+                std::string bar_timestamp = latest_bar.timestamp_ns == 0 ? current_timestamp : TimeUtils::format_epoch_nanoseconds_human_readable(latest_bar.timestamp_ns);
                 
                 logging_context->csv_bars_logger->log_bar(
                     current_timestamp,  // System timestamp
@@ -229,7 +215,7 @@ void MarketDataCoordinator::process_market_data_iteration(const std::string& sym
         MarketDataValidator& validator = market_data_manager.get_market_data_validator();
         const SystemConfig& config = market_data_manager.get_config();
         API::ApiManager& api_manager = market_data_manager.get_api_manager();
-        MarketDataThreadLogs::process_csv_logging_if_needed(computed_data, historical_bars_for_logging, validator, symbol, config.timing, api_manager, last_bar_log_time, previous_bar);
+        MarketDataThreadLogs::process_csv_logging_if_needed(computed_data, historical_bar_series, validator, symbol, config.timing, api_manager, last_bar_log_time, previous_bar);
         
     } catch (const std::exception& exception_error) {
         MarketDataThreadLogs::log_thread_loop_exception("Error in process_market_data_iteration: " + std::string(exception_error.what()));
@@ -4,6 +4,9 @@
 #include "configs/system_config.hpp"
 #include "api/general/api_manager.hpp"
 #include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/data_sync_structures.hpp"
+#include "trader/data_structures/bar_series.hpp"
+#include "trader/data_structures/market_data_result.hpp"
 #include "trader/market_data/market_data_manager.hpp"
 #include <vector>
 #include <mutex>
@@ -19,17 +22,18 @@ using Config::SystemConfig;
 class MarketDataCoordinator {
 public:
     struct MarketDataSnapshotState {
-        MarketSnapshot& market_snapshot;
+        PublishedMarketSnapshot& market_snapshot;
         std::mutex& state_mutex;
         std::condition_variable& data_condition_variable;
         std::atomic<bool>& has_market_flag;
         std::atomic<std::chrono::steady_clock::time_point>& market_data_timestamp;
         std::atomic<bool>& market_data_fresh_flag;
+        TradingCycleTrigger* trading_cycle_trigger;
     };
 
     MarketDataCoordinator(MarketDataManager& market_data_manager_ref);
     
-    ProcessedData fetch_and_process_market_data(const std::string& trading_symbol, std::vector<Bar>& historical_bars_output);
+    ProcessedDataResult fetch_and_process_market_data(const std::string& trading_symbol, BarSeries& historical_bar_series_output);
     void update_shared_market_snapshot(const ProcessedData& processed_data_result, MarketDataSnapshotState& snapshot_state);
     
     // Process a complete market data iteration (fetch, process, update snapshot, CSV logging)
@@ -37,6 +41,9 @@ public:
 
 private:
     MarketDataManager& market_data_manager;
+    
+    // Reused every iteration so the bar columns stop reallocating once warmed up
+    BarSeries historical_bar_series;
 };
 
 } // namespace Core
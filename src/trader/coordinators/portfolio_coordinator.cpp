@@ -0,0 +1,323 @@
+#include "portfolio_coordinator.hpp"
+#include "logging/logs/trading_logs.hpp"
+#include "api/polygon/polygon_crypto_client.hpp"
+#include "utils/time_utils.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace AlpacaTrader {
+namespace Core {
+
+using AlpacaTrader::Logging::TradingLogs;
+
+namespace {
+
+// Primary symbol first, then the universe in configured order, without duplicates
+std::vector<std::string> build_symbol_universe(const SystemConfig& config) {
+    std::vector<std::string> universe_symbols;
+    universe_symbols.push_back(config.trading_mode.primary_symbol);
+    for (const std::string& universe_symbol : config.trading_mode.symbol_universe) {
+        if (std::find(universe_symbols.begin(), universe_symbols.end(), universe_symbol) == universe_symbols.end()) {
+            universe_symbols.push_back(universe_symbol);
+        }
+    }
+    return universe_symbols;
+}
+
+std::string format_signal_strength(double signal_strength) {
+    return std::to_string(signal_strength).substr(0, 4);
+}
+
+} // anonymous namespace
+
+PortfolioCoordinator::PortfolioCoordinator(TradingLogic& trading_logic_ref, AccountManager& account_manager_ref,
+                                           ConnectivityManager& connectivity_manager_ref, const SystemConfig& system_config_param)
+    : trading_logic(trading_logic_ref), market_data_manager(trading_logic_ref.get_market_data_manager_reference()),
+      account_manager(account_manager_ref), connectivity_manager(connectivity_manager_ref), config(system_config_param),
+      risk_manager(system_config_param), strategy_ensemble(system_config_param),
+      oscillator_parameters(indicator_kernel_parameters_from_config(system_config_param.strategy)),
+      symbol_slots(), task_scheduler(system_config_param.strategy.portfolio_worker_threads), realtime_feed_started(false) {
+    for (const std::string& universe_symbol : build_symbol_universe(config)) {
+        SymbolSlot symbol_slot;
+        symbol_slot.symbol = universe_symbol;
+        symbol_slot.has_bars = false;
+        symbol_slot.evaluation = PortfolioSymbolEvaluation{};
+        symbol_slots.push_back(std::move(symbol_slot));
+    }
+    
+    // Checked before the first cycle hands the kernels to the workers
+    if (config.strategy.enable_oscillator_signals) {
+        std::string kernel_mismatch_description;
+        if (!verify_indicator_kernel_backends(kernel_mismatch_description)) {
+            TradingLogs::log_market_status(false, "AVX2 indicator kernels disagree with the scalar kernels (" + kernel_mismatch_description +
+                                                  ") - using " + indicator_kernel_backend_name(get_indicator_kernel_backend()));
+        }
+    }
+}
+
+void PortfolioCoordinator::process_portfolio_cycle_iteration(std::atomic<bool>& running, double initial_equity, std::atomic<unsigned long>& loop_counter) {
+    unsigned long current_loop_counter = loop_counter.fetch_add(1) + 1;
+    if (!running.load()) {
+        return;
+    }
+    
+    if (connectivity_manager.is_connectivity_outage()) {
+        TradingLogs::log_market_status(false, "Connectivity outage - status: " + connectivity_manager.get_status_string());
+        try {
+            trading_logic.handle_trading_halt();
+        } catch (const std::exception& halt_exception_error) {
+            TradingLogs::log_market_status(false, "Error handling trading halt: " + std::string(halt_exception_error.what()));
+        } catch (...) {
+            TradingLogs::log_market_status(false, "Unknown error handling trading halt");
+        }
+        return;
+    }
+    
+    TradingLogs::log_loop_header(current_loop_counter, "PORTFOLIO (" + std::to_string(symbol_slots.size()) + " symbols)");
+    
+    // Every symbol of the universe trades in the primary symbol's session
+    try {
+        if (!market_data_manager.get_api_manager().is_within_trading_hours(config.trading_mode.primary_symbol)) {
+            TradingLogs::log_market_status(false, "Market is closed - outside trading hours - no portfolio decisions");
+            return;
+        }
+    } catch (const std::exception& trading_hours_exception_error) {
+        TradingLogs::log_market_status(false, "API error checking trading hours: " + std::string(trading_hours_exception_error.what()));
+        return;
+    }
+    
+    ensure_realtime_feed();
+    
+    PortfolioAccountView account_view;
+    if (!fetch_account_view(account_view)) {
+        return;
+    }
+    
+    fetch_symbol_bars();
+    
+    task_scheduler.run_batch(symbol_slots.size(), [this, &account_view](size_t slot_index) {
+        evaluate_symbol(symbol_slots[slot_index], account_view);
+        render_symbol_decision(symbol_slots[slot_index].evaluation);
+    });
+    
+    size_t candidate_count = 0;
+    int orders_placed = execute_ranked_orders(account_view, initial_equity, candidate_count);
+    
+    std::vector<std::pair<std::string, std::string>> symbol_decision_rows;
+    symbol_decision_rows.reserve(symbol_slots.size());
+    for (const SymbolSlot& symbol_slot : symbol_slots) {
+        symbol_decision_rows.emplace_back(symbol_slot.symbol, symbol_slot.evaluation.decision_summary);
+    }
+    TradingLogs::log_portfolio_cycle_table(symbol_decision_rows, candidate_count, orders_placed);
+}
+
+void PortfolioCoordinator::ensure_realtime_feed() {
+    if (realtime_feed_started || !config.trading_mode.is_crypto()) {
+        return;
+    }
+    
+    API::PolygonCryptoClient* polygon_client = market_data_manager.get_api_manager().get_polygon_crypto_client();
+    if (!polygon_client) {
+        return;
+    }
+    
+    // One subscription for the whole universe; bars for every symbol then come from the same socket
+    std::vector<std::string> feed_symbols;
+    for (const SymbolSlot& symbol_slot : symbol_slots) {
+        feed_symbols.push_back(symbol_slot.symbol);
+    }
+    try {
+        realtime_feed_started = polygon_client->start_realtime_feed(feed_symbols);
+    } catch (const std::exception& feed_exception_error) {
+        TradingLogs::log_market_status(false, "Failed to start realtime feed for portfolio symbols: " + std::string(feed_exception_error.what()));
+    }
+}
+
+bool PortfolioCoordinator::fetch_account_view(PortfolioAccountView& account_view_output) const {
+    try {
+        account_view_output.equity = account_manager.fetch_account_equity();
+        account_view_output.buying_power = account_manager.fetch_buying_power();
+        account_view_output.positions_by_symbol = account_manager.fetch_all_position_details();
+        account_view_output.open_orders_by_symbol = account_manager.fetch_all_open_orders_counts();
+    } catch (const std::exception& account_exception_error) {
+        TradingLogs::log_market_status(false, "Failed to fetch portfolio account data: " + std::string(account_exception_error.what()));
+        return false;
+    }
+    
+    if (account_view_output.equity <= 0.0 || !std::isfinite(account_view_output.equity)) {
+        TradingLogs::log_market_status(false, "Invalid equity for portfolio cycle: " + std::to_string(account_view_output.equity));
+        return false;
+    }
+    return true;
+}
+
+void PortfolioCoordinator::fetch_symbol_bars() {
+    MarketBarsManager& market_bars_manager = market_data_manager.get_market_bars_manager();
+    
+    for (SymbolSlot& symbol_slot : symbol_slots) {
+        symbol_slot.evaluation = PortfolioSymbolEvaluation{};
+        try {
+            symbol_slot.has_bars = market_bars_manager.fetch_and_validate_bars(symbol_slot.symbol, symbol_slot.bar_series);
+            if (!symbol_slot.has_bars) {
+                symbol_slot.evaluation.skip_reason = "Insufficient or invalid bars";
+            }
+        } catch (const std::exception& fetch_exception_error) {
+            symbol_slot.has_bars = false;
+            symbol_slot.evaluation.skip_reason = "Bar fetch failed: " + std::string(fetch_exception_error.what());
+        }
+    }
+}
+
+void PortfolioCoordinator::evaluate_symbol(SymbolSlot& symbol_slot, const PortfolioAccountView& account_view) const {
+    if (!symbol_slot.has_bars) {
+        return;
+    }
+    
+    PortfolioSymbolEvaluation& evaluation = symbol_slot.evaluation;
+    try {
+        ProcessedData& processed_data = evaluation.processed_data;
+        processed_data = market_data_manager.get_market_bars_manager().compute_processed_data_from_series(symbol_slot.symbol, symbol_slot.bar_series, 0);
+        
+        if (!std::isfinite(processed_data.curr.close_price) || processed_data.curr.close_price <= 0.0 || !std::isfinite(processed_data.atr)) {
+            evaluation.skip_reason = "Invalid price or ATR";
+            return;
+        }
+        
+        if (config.strategy.enable_oscillator_signals) {
+            compute_indicator_set(symbol_slot.bar_series, oscillator_parameters, symbol_slot.oscillator_columns);
+            processed_data.oscillators = latest_oscillator_readings(symbol_slot.oscillator_columns);
+        }
+        
+        if (processed_data.oldest_bar_timestamp_ns > 0) {
+            long long data_accumulation_seconds = (TimeUtils::get_current_epoch_nanoseconds() - processed_data.oldest_bar_timestamp_ns) / TimeUtils::NANOSECONDS_PER_SECOND;
+            if (data_accumulation_seconds < config.strategy.minimum_data_accumulation_seconds_before_trading) {
+                evaluation.skip_reason = "Accumulating data (" + std::to_string(data_accumulation_seconds) + "s)";
+                return;
+            }
+        }
+        
+        auto position_iterator = account_view.positions_by_symbol.find(symbol_slot.symbol);
+        if (position_iterator != account_view.positions_by_symbol.end()) {
+            processed_data.pos_details = position_iterator->second;
+        }
+        auto open_orders_iterator = account_view.open_orders_by_symbol.find(symbol_slot.symbol);
+        if (open_orders_iterator != account_view.open_orders_by_symbol.end()) {
+            processed_data.open_orders = open_orders_iterator->second;
+        }
+        processed_data.exposure_pct = (std::abs(processed_data.pos_details.current_value) / account_view.equity) * config.strategy.percentage_calculation_multiplier;
+        
+        StrategyEnsembleDecision ensemble_decision = strategy_ensemble.evaluate(StrategyEvaluationRequest(
+            processed_data, account_view.equity, processed_data.pos_details.position_quantity, account_view.buying_power
+        ));
+        evaluation.signal_decision = ensemble_decision.signal_decision;
+        evaluation.filter_result = ensemble_decision.filter_result;
+        evaluation.position_sizing = ensemble_decision.position_sizing;
+        evaluation.evaluated = true;
+    } catch (const std::exception& evaluation_exception_error) {
+        evaluation.skip_reason = "Evaluation failed: " + std::string(evaluation_exception_error.what());
+    }
+}
+
+void PortfolioCoordinator::render_symbol_decision(PortfolioSymbolEvaluation& evaluation) const {
+    const SignalDecision& signal_decision = evaluation.signal_decision;
+    evaluation.is_order_candidate = false;
+    
+    if (!evaluation.evaluated) {
+        evaluation.decision_summary = "Skipped - " + evaluation.skip_reason;
+    } else if (!evaluation.filter_result.all_pass) {
+        evaluation.decision_summary = "Filters not met";
+    } else if (!signal_decision.buy && !signal_decision.sell) {
+        evaluation.decision_summary = "No signal (" + format_signal_strength(signal_decision.signal_strength) + ")";
+    } else if (evaluation.position_sizing.quantity <= 0.0) {
+        evaluation.decision_summary = "Signal but zero position size";
+    } else {
+        std::string side_string = signal_decision.buy ? config.strategy.signal_buy_string : config.strategy.signal_sell_string;
+        evaluation.decision_summary = side_string + " (" + format_signal_strength(signal_decision.signal_strength) + ")";
+        evaluation.is_order_candidate = true;
+    }
+}
+
+int PortfolioCoordinator::execute_ranked_orders(const PortfolioAccountView& account_view, double initial_equity, size_t& candidate_count) {
+    std::vector<size_t> candidate_indices;
+    for (size_t slot_index = 0; slot_index < symbol_slots.size(); ++slot_index) {
+        if (symbol_slots[slot_index].evaluation.is_order_candidate) {
+            candidate_indices.push_back(slot_index);
+        }
+    }
+    
+    candidate_count = candidate_indices.size();
+    if (candidate_indices.empty()) {
+        return 0;
+    }
+    
+    // Account-wide risk gate on the aggregate exposure of every open position
+    double total_position_value = 0.0;
+    int open_position_count = 0;
+    for (const auto& symbol_position : account_view.positions_by_symbol) {
+        total_position_value += std::abs(symbol_position.second.current_value);
+        if (symbol_position.second.position_quantity != 0) {
+            open_position_count++;
+        }
+    }
+    ProcessedData portfolio_risk_data;
+    portfolio_risk_data.exposure_pct = (total_position_value / account_view.equity) * config.strategy.percentage_calculation_multiplier;
+    try {
+        if (!risk_manager.validate_trading_permissions(portfolio_risk_data, account_view.equity, initial_equity)) {
+            for (size_t slot_index : candidate_indices) {
+                symbol_slots[slot_index].evaluation.decision_summary += " - blocked by risk limits";
+            }
+            return 0;
+        }
+    } catch (const std::exception& risk_exception_error) {
+        TradingLogs::log_market_status(false, "Portfolio risk check failed: " + std::string(risk_exception_error.what()));
+        return 0;
+    }
+    
+    std::stable_sort(candidate_indices.begin(), candidate_indices.end(), [this](size_t left_index, size_t right_index) {
+        return symbol_slots[left_index].evaluation.signal_decision.signal_strength > symbol_slots[right_index].evaluation.signal_decision.signal_strength;
+    });
+    
+    // Orders go out one at a time: the broker connection is shared and each order changes buying power
+    OrderExecutionLogic& order_engine = trading_logic.get_order_engine();
+    double remaining_buying_power = account_view.buying_power;
+    int orders_placed = 0;
+    for (size_t slot_index : candidate_indices) {
+        SymbolSlot& symbol_slot = symbol_slots[slot_index];
+        const PortfolioSymbolEvaluation& evaluation = symbol_slot.evaluation;
+        std::string& symbol_decision = symbol_slot.evaluation.decision_summary;
+        
+        if (orders_placed >= config.strategy.max_portfolio_orders_per_cycle) {
+            symbol_decision += " - order limit reached";
+            continue;
+        }
+        
+        int current_position_quantity = evaluation.processed_data.pos_details.position_quantity;
+        bool opens_position = current_position_quantity == 0;
+        double order_value = evaluation.processed_data.curr.close_price * evaluation.position_sizing.quantity;
+        if (opens_position && open_position_count >= config.strategy.max_portfolio_open_positions) {
+            symbol_decision += " - position limit reached";
+            continue;
+        }
+        if (opens_position && order_value > remaining_buying_power) {
+            symbol_decision += " - buying power committed";
+            continue;
+        }
+        
+        try {
+            order_engine.execute_trade_for_symbol(symbol_slot.symbol, evaluation.processed_data, current_position_quantity,
+                                                  evaluation.position_sizing, evaluation.signal_decision);
+            orders_placed++;
+            if (opens_position) {
+                open_position_count++;
+                remaining_buying_power -= order_value;
+            }
+            symbol_decision += " - order placed";
+        } catch (const std::exception& order_exception_error) {
+            symbol_decision += " - order failed: " + std::string(order_exception_error.what());
+        }
+    }
+    return orders_placed;
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
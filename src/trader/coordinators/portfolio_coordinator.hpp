@@ -0,0 +1,92 @@
+#ifndef PORTFOLIO_COORDINATOR_HPP
+#define PORTFOLIO_COORDINATOR_HPP
+
+#include "configs/system_config.hpp"
+#include "trader/trading_logic/trading_logic.hpp"
+#include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/bar_series.hpp"
+#include "trader/market_data/market_data_manager.hpp"
+#include "trader/account_management/account_manager.hpp"
+#include "trader/strategy_analysis/risk_manager.hpp"
+#include "trader/strategy_analysis/strategy_ensemble.hpp"
+#include "trader/strategy_analysis/indicator_kernels.hpp"
+#include "threads/thread_logic/work_stealing_scheduler.hpp"
+#include "utils/connectivity_manager.hpp"
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// One symbol's result for the current portfolio cycle
+struct PortfolioSymbolEvaluation {
+    bool evaluated;
+    std::string skip_reason;
+    ProcessedData processed_data;
+    SignalDecision signal_decision;
+    FilterResult filter_result;
+    PositionSizing position_sizing;
+    bool is_order_candidate;
+    std::string decision_summary;
+};
+
+// Trades every symbol of trading_mode.symbol_universe as one portfolio. Bars are fetched on the
+// trader thread because the providers share one connection; indicator updates, the batch oscillator kernels,
+// signals, filters, sizing and the decision text then run as one task per symbol on a work-stealing
+// scheduler, so a symbol with a heavy burst of new bars doesn't hold up the rest. Orders are ranked by signal strength and placed one
+// at a time within the portfolio's order, position and buying power limits.
+class PortfolioCoordinator {
+public:
+    PortfolioCoordinator(TradingLogic& trading_logic_ref, AccountManager& account_manager_ref,
+                         ConnectivityManager& connectivity_manager_ref, const SystemConfig& system_config_param);
+    
+    void process_portfolio_cycle_iteration(std::atomic<bool>& running, double initial_equity, std::atomic<unsigned long>& loop_counter);
+    
+    // Worker threads get their priority and affinity from thread.portfolio_worker at startup
+    WorkStealingScheduler& get_task_scheduler() { return task_scheduler; }
+
+private:
+    struct SymbolSlot {
+        std::string symbol;
+        bool has_bars;
+        BarSeries bar_series;
+        IndicatorSeriesColumns oscillator_columns;      // Reused every cycle so the kernels don't reallocate
+        PortfolioSymbolEvaluation evaluation;
+    };
+    
+    // Account state read by every evaluation task, fetched once per cycle
+    struct PortfolioAccountView {
+        double equity;
+        double buying_power;
+        std::unordered_map<std::string, PositionDetails> positions_by_symbol;
+        std::unordered_map<std::string, int> open_orders_by_symbol;
+    };
+    
+    TradingLogic& trading_logic;
+    MarketDataManager& market_data_manager;
+    AccountManager& account_manager;
+    ConnectivityManager& connectivity_manager;
+    const SystemConfig& config;
+    RiskManager risk_manager;
+    StrategyEnsemble strategy_ensemble;
+    IndicatorKernelParameters oscillator_parameters;
+    
+    std::vector<SymbolSlot> symbol_slots;
+    WorkStealingScheduler task_scheduler;
+    bool realtime_feed_started;
+    
+    void ensure_realtime_feed();
+    bool fetch_account_view(PortfolioAccountView& account_view_output) const;
+    void fetch_symbol_bars();
+    void evaluate_symbol(SymbolSlot& symbol_slot, const PortfolioAccountView& account_view) const;
+    void render_symbol_decision(PortfolioSymbolEvaluation& evaluation) const;
+    // Returns the number of orders placed; order outcomes are appended to the decision summaries
+    int execute_ranked_orders(const PortfolioAccountView& account_view, double initial_equity, size_t& candidate_count);
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // PORTFOLIO_COORDINATOR_HPP
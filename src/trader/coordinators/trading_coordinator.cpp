@@ -24,7 +24,35 @@ TradingCoordinator::TradingCoordinator(TradingLogic& trading_logic_ref, MarketDa
                                        const SystemConfig& system_config_param)
     : trading_logic(trading_logic_ref), market_data_manager(market_data_manager_ref), 
       connectivity_manager(connectivity_manager_ref), account_manager(account_manager_ref),
-      config(system_config_param) {}
+      config(system_config_param), has_evaluated_generations(false), last_evaluated_market_generation(0),
+      last_evaluated_account_generation(0), consecutive_skipped_cycles(0), evaluated_cycle_count(0), skipped_unchanged_cycle_count(0) {}
+
+bool TradingCoordinator::should_skip_unchanged_cycle(uint64_t market_generation, uint64_t account_generation) {
+    bool generations_unchanged = has_evaluated_generations && market_generation == last_evaluated_market_generation &&
+                                 account_generation == last_evaluated_account_generation;
+    
+    // Periodic forced evaluations keep time-driven checks (market close, staleness) running on quiet data
+    if (config.timing.skip_unchanged_trading_cycles && generations_unchanged &&
+        consecutive_skipped_cycles < config.timing.max_consecutive_unchanged_cycle_skips) {
+        consecutive_skipped_cycles++;
+        skipped_unchanged_cycle_count.fetch_add(1);
+        return true;
+    }
+    
+    has_evaluated_generations = true;
+    last_evaluated_market_generation = market_generation;
+    last_evaluated_account_generation = account_generation;
+    consecutive_skipped_cycles = 0;
+    evaluated_cycle_count.fetch_add(1);
+    return false;
+}
+
+TradingCycleSkipCounters TradingCoordinator::get_cycle_skip_counters() const {
+    TradingCycleSkipCounters skip_counters;
+    skip_counters.evaluated_cycles = evaluated_cycle_count.load();
+    skip_counters.skipped_unchanged_cycles = skipped_unchanged_cycle_count.load();
+    return skip_counters;
+}
 
 void TradingCoordinator::execute_trading_cycle_iteration(TradingSnapshotState& snapshot_state,
                                                           MarketDataSyncState& market_data_sync_state,
@@ -95,51 +123,18 @@ void TradingCoordinator::execute_trading_cycle_iteration(TradingSnapshotState& s
     }
 
 
-    // Lock and read snapshots atomically
-    MarketSnapshot current_market_snapshot;
-    AccountSnapshot current_account_snapshot;
-    
+    // Seqlock reads: consistent copies without taking the state mutex or blocking the publishers
+    MarketSnapshot current_market_snapshot = snapshot_state.market_snapshot.load();
+    AccountSnapshot current_account_snapshot = snapshot_state.account_snapshot.load();
+    MultiTimeframeInputs current_multi_timeframe_inputs;
+    if (config.strategy.enable_multi_timeframe_confirmation) {
+        current_multi_timeframe_inputs = snapshot_state.market_snapshot.multi_timeframe_inputs.load();
+    }
     
-    try {
-        std::lock_guard<std::mutex> state_lock(snapshot_state.state_mutex);
-        
-        
-        // CRITICAL: Explicitly copy all MarketSnapshot fields to avoid struct copy issues
-        current_market_snapshot.atr = snapshot_state.market_snapshot.atr;
-        current_market_snapshot.avg_atr = snapshot_state.market_snapshot.avg_atr;
-        current_market_snapshot.avg_vol = snapshot_state.market_snapshot.avg_vol;
-        
-        // Explicitly copy curr Bar fields
-        current_market_snapshot.curr.open_price = snapshot_state.market_snapshot.curr.open_price;
-        current_market_snapshot.curr.high_price = snapshot_state.market_snapshot.curr.high_price;
-        current_market_snapshot.curr.low_price = snapshot_state.market_snapshot.curr.low_price;
-        current_market_snapshot.curr.close_price = snapshot_state.market_snapshot.curr.close_price;
-        current_market_snapshot.curr.volume = snapshot_state.market_snapshot.curr.volume;
-        current_market_snapshot.curr.timestamp = snapshot_state.market_snapshot.curr.timestamp;
-        
-        // Explicitly copy prev Bar fields
-        current_market_snapshot.prev.open_price = snapshot_state.market_snapshot.prev.open_price;
-        current_market_snapshot.prev.high_price = snapshot_state.market_snapshot.prev.high_price;
-        current_market_snapshot.prev.low_price = snapshot_state.market_snapshot.prev.low_price;
-        current_market_snapshot.prev.close_price = snapshot_state.market_snapshot.prev.close_price;
-        current_market_snapshot.prev.volume = snapshot_state.market_snapshot.prev.volume;
-        current_market_snapshot.prev.timestamp = snapshot_state.market_snapshot.prev.timestamp;
-        
-        current_market_snapshot.oldest_bar_timestamp = snapshot_state.market_snapshot.oldest_bar_timestamp;
-        
-        current_account_snapshot = snapshot_state.account_snapshot;
-        
-        // DEBUG: Log bar data after copying from snapshot
-        if (current_market_snapshot.curr.open_price > 0.0 && (current_market_snapshot.curr.high_price == 0.0 || current_market_snapshot.curr.low_price == 0.0 || current_market_snapshot.curr.close_price == 0.0)) {
-            TradingLogs::log_market_status(false, "WARNING: TradingCoordinator - Snapshot has incomplete bar data - O:" + 
-                std::to_string(current_market_snapshot.curr.open_price) + " H:" + std::to_string(current_market_snapshot.curr.high_price) + 
-                " L:" + std::to_string(current_market_snapshot.curr.low_price) + " C:" + std::to_string(current_market_snapshot.curr.close_price));
-        }
-        
-    } catch (const std::exception& snapshot_copy_exception_error) {
-        std::abort();
-    } catch (...) {
-        std::abort();
+    if (current_market_snapshot.curr.open_price > 0.0 && (current_market_snapshot.curr.high_price == 0.0 || current_market_snapshot.curr.low_price == 0.0 || current_market_snapshot.curr.close_price == 0.0)) {
+        TradingLogs::log_market_status(false, "WARNING: TradingCoordinator - Snapshot has incomplete bar data - O:" + 
+            std::to_string(current_market_snapshot.curr.open_price) + " H:" + std::to_string(current_market_snapshot.curr.high_price) + 
+            " L:" + std::to_string(current_market_snapshot.curr.low_price) + " C:" + std::to_string(current_market_snapshot.curr.close_price));
     }
 
     
@@ -153,6 +148,12 @@ void TradingCoordinator::execute_trading_cycle_iteration(TradingSnapshotState& s
         return;
     }
     
+    // Nothing the decision depends on has changed since the last full evaluation
+    if (should_skip_unchanged_cycle(current_market_snapshot.data_generation, current_account_snapshot.data_generation)) {
+        TradingLogs::log_inline_unchanged_data_skip(skipped_unchanged_cycle_count.load(), evaluated_cycle_count.load());
+        return;
+    }
+    
 
     
     // Log loop header
@@ -288,7 +289,7 @@ void TradingCoordinator::execute_trading_cycle_iteration(TradingSnapshotState& s
     TradingDecisionResult decision_result;
     try {
         
-        decision_result = trading_logic.execute_trading_cycle(current_market_snapshot, current_account_snapshot, initial_equity);
+        decision_result = trading_logic.execute_trading_cycle(current_market_snapshot, current_account_snapshot, current_multi_timeframe_inputs, initial_equity);
         
     } catch (const std::exception& exception_error) {
         TradingLogs::log_market_status(false, "Error executing trading cycle: " + std::string(exception_error.what()));
@@ -333,6 +334,9 @@ void TradingCoordinator::execute_trading_cycle_iteration(TradingSnapshotState& s
     TradingLogs::log_candle_data_table(processed_data_for_logging.curr.open_price, processed_data_for_logging.curr.high_price, 
                                        processed_data_for_logging.curr.low_price, processed_data_for_logging.curr.close_price);
     TradingLogs::log_signals_table_enhanced(decision_result.signal_decision);
+    if (decision_result.strategy_decisions.size() > 1) {
+        TradingLogs::log_strategy_ensemble_table(decision_result.strategy_decisions, decision_result.winning_strategy_name);
+    }
     TradingLogs::log_signal_analysis_detailed(processed_data_for_logging, decision_result.signal_decision, config);
     TradingLogs::log_filters(decision_result.filter_result, config, processed_data_for_logging);
     TradingLogs::log_summary(processed_data_for_logging, decision_result.signal_decision, decision_result.filter_result, config.strategy.symbol);
@@ -372,8 +376,8 @@ MarketDataManager& TradingCoordinator::get_market_data_manager_reference() {
     return market_data_manager;
 }
 
-void TradingCoordinator::process_trading_cycle_iteration(MarketSnapshot& market_snapshot,
-                                                         AccountSnapshot& account_snapshot,
+void TradingCoordinator::process_trading_cycle_iteration(PublishedMarketSnapshot& market_snapshot,
+                                                         PublishedAccountSnapshot& account_snapshot,
                                                          std::mutex& state_mtx,
                                                          std::condition_variable& data_cv,
                                                          std::atomic<bool>& has_market,
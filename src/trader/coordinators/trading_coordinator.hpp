@@ -16,11 +16,17 @@
 namespace AlpacaTrader {
 namespace Core {
 
+// Trader cycles that ran the full pipeline versus those short-circuited because neither snapshot changed
+struct TradingCycleSkipCounters {
+    unsigned long evaluated_cycles;
+    unsigned long skipped_unchanged_cycles;
+};
+
 class TradingCoordinator {
 public:
     struct TradingSnapshotState {
-        MarketSnapshot& market_snapshot;
-        AccountSnapshot& account_snapshot;
+        PublishedMarketSnapshot& market_snapshot;
+        PublishedAccountSnapshot& account_snapshot;
         std::mutex& state_mutex;
         std::condition_variable& data_condition_variable;
         std::atomic<bool>& has_market_flag;
@@ -39,8 +45,8 @@ public:
                                          unsigned long loop_counter_value);
     
     // Process a complete trading cycle iteration (creates state structures and executes)
-    void process_trading_cycle_iteration(MarketSnapshot& market_snapshot,
-                                         AccountSnapshot& account_snapshot,
+    void process_trading_cycle_iteration(PublishedMarketSnapshot& market_snapshot,
+                                         PublishedAccountSnapshot& account_snapshot,
                                          std::mutex& state_mtx,
                                          std::condition_variable& data_cv,
                                          std::atomic<bool>& has_market,
@@ -58,6 +64,8 @@ public:
     
     MarketDataManager& get_market_data_manager_reference();
 
+    TradingCycleSkipCounters get_cycle_skip_counters() const;
+
 private:
     TradingLogic& trading_logic;
     MarketDataManager& market_data_manager;
@@ -65,6 +73,15 @@ private:
     AccountManager& account_manager;
     const SystemConfig& config;
     
+    // Snapshot generations seen by the last full evaluation
+    bool has_evaluated_generations;
+    uint64_t last_evaluated_market_generation;
+    uint64_t last_evaluated_account_generation;
+    int consecutive_skipped_cycles;
+    std::atomic<unsigned long> evaluated_cycle_count;
+    std::atomic<unsigned long> skipped_unchanged_cycle_count;
+    
+    bool should_skip_unchanged_cycle(uint64_t market_generation, uint64_t account_generation);
     void log_and_execute_trade_with_comprehensive_logging(const TradeExecutionRequest& trade_request, const TradingDecisionResult& decision_result);
     void log_trade_execution_error(const std::string& error_message, const TradeExecutionRequest& trade_request, double buying_power_amount);
 };
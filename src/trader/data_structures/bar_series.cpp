@@ -0,0 +1,110 @@
+#include "bar_series.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace AlpacaTrader {
+namespace Core {
+
+void BarSeries::assign_from_bars(const std::vector<Bar>& bars_data) {
+    const std::size_t bars_count = bars_data.size();
+    
+    // resize() on a cleared vector reuses its capacity, so steady-state reassignment does not allocate
+    open_prices.resize(bars_count);
+    high_prices.resize(bars_count);
+    low_prices.resize(bars_count);
+    close_prices.resize(bars_count);
+    volumes.resize(bars_count);
+    timestamps_ns.resize(bars_count);
+    forward_filled_flags.resize(bars_count);
+    
+    for (std::size_t bar_index = 0; bar_index < bars_count; ++bar_index) {
+        const Bar& bar_data = bars_data[bar_index];
+        open_prices[bar_index] = bar_data.open_price;
+        high_prices[bar_index] = bar_data.high_price;
+        low_prices[bar_index] = bar_data.low_price;
+        close_prices[bar_index] = bar_data.close_price;
+        volumes[bar_index] = bar_data.volume;
+        timestamps_ns[bar_index] = bar_data.timestamp_ns;
+        forward_filled_flags[bar_index] = bar_data.forward_filled ? 1 : 0;
+    }
+}
+
+void BarSeries::push_back(const Bar& bar_data) {
+    open_prices.push_back(bar_data.open_price);
+    high_prices.push_back(bar_data.high_price);
+    low_prices.push_back(bar_data.low_price);
+    close_prices.push_back(bar_data.close_price);
+    volumes.push_back(bar_data.volume);
+    timestamps_ns.push_back(bar_data.timestamp_ns);
+    forward_filled_flags.push_back(bar_data.forward_filled ? 1 : 0);
+}
+
+void BarSeries::reserve(std::size_t bars_capacity) {
+    open_prices.reserve(bars_capacity);
+    high_prices.reserve(bars_capacity);
+    low_prices.reserve(bars_capacity);
+    close_prices.reserve(bars_capacity);
+    volumes.reserve(bars_capacity);
+    timestamps_ns.reserve(bars_capacity);
+    forward_filled_flags.reserve(bars_capacity);
+}
+
+void BarSeries::clear() {
+    open_prices.clear();
+    high_prices.clear();
+    low_prices.clear();
+    close_prices.clear();
+    volumes.clear();
+    timestamps_ns.clear();
+    forward_filled_flags.clear();
+}
+
+Bar BarSeries::bar_at(std::size_t bar_index) const {
+    if (bar_index >= size()) {
+        throw std::out_of_range("BarSeries index " + std::to_string(bar_index) + " out of range (size " + std::to_string(size()) + ")");
+    }
+    
+    Bar bar_result;
+    bar_result.open_price = open_prices[bar_index];
+    bar_result.high_price = high_prices[bar_index];
+    bar_result.low_price = low_prices[bar_index];
+    bar_result.close_price = close_prices[bar_index];
+    bar_result.volume = volumes[bar_index];
+    bar_result.timestamp_ns = timestamps_ns[bar_index];
+    bar_result.forward_filled = forward_filled_flags[bar_index] != 0;
+    return bar_result;
+}
+
+Bar BarSeries::latest_bar() const {
+    if (empty()) {
+        throw std::out_of_range("BarSeries is empty");
+    }
+    return bar_at(size() - 1);
+}
+
+int64_t BarSeries::oldest_timestamp_ns() const {
+    return empty() ? 0 : timestamps_ns.front();
+}
+
+bool BarSeries::has_valid_prices() const {
+    const std::size_t bars_count = size();
+    const double* open_values = open_prices.data();
+    const double* high_values = high_prices.data();
+    const double* low_values = low_prices.data();
+    const double* close_values = close_prices.data();
+    
+    // Branch-free accumulation keeps the scan vectorizable
+    bool all_prices_valid = true;
+    for (std::size_t bar_index = 0; bar_index < bars_count; ++bar_index) {
+        all_prices_valid &= open_values[bar_index] > 0.0;
+        all_prices_valid &= close_values[bar_index] > 0.0;
+        all_prices_valid &= low_values[bar_index] > 0.0;
+        all_prices_valid &= high_values[bar_index] >= low_values[bar_index];
+        all_prices_valid &= high_values[bar_index] >= close_values[bar_index];
+        all_prices_valid &= low_values[bar_index] <= close_values[bar_index];
+    }
+    return all_prices_valid;
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
@@ -0,0 +1,91 @@
+#ifndef BAR_SERIES_HPP
+#define BAR_SERIES_HPP
+
+#include "trader/data_structures/data_structures.hpp"
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Cache-line aligned storage so column scans start on a vector-register boundary
+template <typename T, std::size_t Alignment>
+struct AlignedColumnAllocator {
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedColumnAllocator<U, Alignment>;
+    };
+
+    AlignedColumnAllocator() noexcept = default;
+    template <typename U>
+    AlignedColumnAllocator(const AlignedColumnAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(std::size_t element_count) {
+        return static_cast<T*>(::operator new(element_count * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* element_pointer, std::size_t) noexcept {
+        ::operator delete(element_pointer, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedColumnAllocator<U, Alignment>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const AlignedColumnAllocator<U, Alignment>&) const noexcept { return false; }
+};
+
+// Struct-of-arrays view of a time-ordered bar history (oldest first).
+// Built once per fetch by the data layer and handed by const reference to indicators, validators and loggers.
+// Clearing or reassigning keeps the column capacity, so a long-lived series stops allocating after warm-up.
+class BarSeries {
+public:
+    static constexpr std::size_t COLUMN_ALIGNMENT_BYTES = 64;
+
+    using PriceColumn = std::vector<double, AlignedColumnAllocator<double, COLUMN_ALIGNMENT_BYTES>>;
+    using TimestampColumn = std::vector<int64_t, AlignedColumnAllocator<int64_t, COLUMN_ALIGNMENT_BYTES>>;
+    using FlagColumn = std::vector<uint8_t, AlignedColumnAllocator<uint8_t, COLUMN_ALIGNMENT_BYTES>>;
+
+    BarSeries() = default;
+
+    void assign_from_bars(const std::vector<Bar>& bars_data);
+    void push_back(const Bar& bar_data);
+    void reserve(std::size_t bars_capacity);
+    void clear();
+
+    std::size_t size() const { return close_prices.size(); }
+    std::size_t capacity() const { return close_prices.capacity(); }
+    bool empty() const { return close_prices.empty(); }
+
+    // Reassembles one row; callers that need whole bars (snapshots, CSV rows) use this at the edge
+    Bar bar_at(std::size_t bar_index) const;
+    Bar latest_bar() const;
+    int64_t oldest_timestamp_ns() const;
+
+    const double* open_data() const { return open_prices.data(); }
+    const double* high_data() const { return high_prices.data(); }
+    const double* low_data() const { return low_prices.data(); }
+    const double* close_data() const { return close_prices.data(); }
+    const double* volume_data() const { return volumes.data(); }
+    const int64_t* timestamp_data() const { return timestamps_ns.data(); }
+
+    // True when every bar has positive prices and high/low bracket the close
+    bool has_valid_prices() const;
+
+private:
+    PriceColumn open_prices;
+    PriceColumn high_prices;
+    PriceColumn low_prices;
+    PriceColumn close_prices;
+    PriceColumn volumes;
+    TimestampColumn timestamps_ns;
+    FlagColumn forward_filled_flags;
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // BAR_SERIES_HPP
@@ -2,6 +2,8 @@
 #define DATA_STRUCTURES_HPP
 
 #include <string>
+#include <array>
+#include <cstdint>
 #include "configs/system_config.hpp"
 
 using AlpacaTrader::Config::TradingModeConfig;
@@ -15,7 +17,8 @@ struct Bar {
     double low_price;
     double close_price;
     double volume;
-    std::string timestamp;
+    int64_t timestamp_ns = 0;           // Bar start, epoch nanoseconds
+    bool forward_filled = false;        // Window had no trades; OHLC carried from the previous close
 };
 
 struct QuoteData {
@@ -23,10 +26,45 @@ struct QuoteData {
     double bid_price;
     double ask_size;
     double bid_size;
-    std::string timestamp;
+    int64_t timestamp_ns = 0;           // Quote time, epoch nanoseconds
     double mid_price;
 };
 
+// Volatility regime from the streaming GARCH(1,1) forecast relative to long-run volatility
+enum class VolatilityRegime {
+    LOW,
+    NORMAL,
+    HIGH
+};
+
+// Signal rule inputs for one confirmation timeframe, rolled up from the base bars
+struct TimeframeSignalInputs {
+    int timeframe_seconds = 0;
+    bool has_data = false;              // A closed bar exists, so curr/prev are both meaningful
+    Bar curr{};
+    Bar prev{};
+    double atr = 0.0;
+};
+
+// Fixed capacity so confirmation timeframes stay allocation-free to copy and can be seqlock-published
+struct MultiTimeframeInputs {
+    static constexpr int MAXIMUM_TIMEFRAMES = 4;
+    std::array<TimeframeSignalInputs, MAXIMUM_TIMEFRAMES> timeframes{};
+    int timeframe_count = 0;
+};
+
+// Latest batch oscillator values for one symbol, read off the indicator kernel columns
+struct OscillatorReadings {
+    bool has_data = false;              // Every oscillator has covered its lookback, so all values are meaningful
+    double rsi = 0.0;
+    double macd_histogram = 0.0;
+    double previous_macd_histogram = 0.0;
+    double bollinger_upper = 0.0;
+    double bollinger_lower = 0.0;
+    double stochastic_k = 0.0;
+    double stochastic_d = 0.0;
+};
+
 struct PositionDetails {
     int position_quantity;
     double unrealized_pl;
@@ -40,7 +78,23 @@ struct MarketSnapshot {
     double avg_vol;
     Bar curr;
     Bar prev;
-    std::string oldest_bar_timestamp;
+    int64_t oldest_bar_timestamp_ns = 0;
+    double donchian_upper = 0.0;
+    double donchian_lower = 0.0;
+    double stochastic_k = 0.0;
+    double stochastic_d = 0.0;
+    double swing_high = 0.0;
+    double swing_low = 0.0;
+    bool swing_is_upswing = false;
+    double atr_percentile = 0.0;
+    double volume_percentile = 0.0;
+    double spread_percentile = 0.0;
+    int percentile_sample_count = 0;
+    double ewma_volatility = 0.0;
+    double garch_volatility = 0.0;
+    double volatility_ratio = 1.0;
+    VolatilityRegime volatility_regime = VolatilityRegime::NORMAL;
+    uint64_t data_generation = 0;      // Bumped by the publisher only when the bars behind the snapshot change
 };
 
 struct AccountSnapshot {
@@ -48,6 +102,7 @@ struct AccountSnapshot {
     PositionDetails pos_details;
     int open_orders;
     double exposure_pct;
+    uint64_t data_generation = 0;      // Bumped by the publisher only when equity, position or orders change
 };
 
 struct ProcessedData {
@@ -60,30 +115,59 @@ struct ProcessedData {
     int open_orders;
     double exposure_pct;
     bool is_doji;
-    std::string oldest_bar_timestamp;
+    int64_t oldest_bar_timestamp_ns;
+    double donchian_upper;
+    double donchian_lower;
+    double stochastic_k;
+    double stochastic_d;
+    double swing_high;
+    double swing_low;
+    bool swing_is_upswing;
+    double atr_percentile;
+    double volume_percentile;
+    double spread_percentile;
+    int percentile_sample_count;
+    double ewma_volatility;
+    double garch_volatility;
+    double volatility_ratio;
+    VolatilityRegime volatility_regime;
+    MultiTimeframeInputs multi_timeframe_inputs;
+    OscillatorReadings oscillators;
     
     ProcessedData()
-        : atr(0.0), avg_atr(0.0), avg_vol(0.0), curr(), prev(), pos_details(), open_orders(0), exposure_pct(0.0), is_doji(false), oldest_bar_timestamp() {}
+        : atr(0.0), avg_atr(0.0), avg_vol(0.0), curr(), prev(), pos_details(), open_orders(0), exposure_pct(0.0), is_doji(false), oldest_bar_timestamp_ns(0),
+          donchian_upper(0.0), donchian_lower(0.0), stochastic_k(0.0), stochastic_d(0.0), swing_high(0.0), swing_low(0.0), swing_is_upswing(false),
+          atr_percentile(0.0), volume_percentile(0.0), spread_percentile(0.0), percentile_sample_count(0),
+          ewma_volatility(0.0), garch_volatility(0.0), volatility_ratio(1.0), volatility_regime(VolatilityRegime::NORMAL),
+          multi_timeframe_inputs(), oscillators() {}
     
     ProcessedData(const MarketSnapshot& market, const AccountSnapshot& account)
         : atr(market.atr), avg_atr(market.avg_atr), avg_vol(market.avg_vol),
           pos_details(account.pos_details),
           open_orders(account.open_orders), exposure_pct(account.exposure_pct), is_doji(false),
-          oldest_bar_timestamp(market.oldest_bar_timestamp) {
+          oldest_bar_timestamp_ns(market.oldest_bar_timestamp_ns),
+          donchian_upper(market.donchian_upper), donchian_lower(market.donchian_lower),
+          stochastic_k(market.stochastic_k), stochastic_d(market.stochastic_d),
+          swing_high(market.swing_high), swing_low(market.swing_low), swing_is_upswing(market.swing_is_upswing),
+          atr_percentile(market.atr_percentile), volume_percentile(market.volume_percentile),
+          spread_percentile(market.spread_percentile), percentile_sample_count(market.percentile_sample_count),
+          ewma_volatility(market.ewma_volatility), garch_volatility(market.garch_volatility),
+          volatility_ratio(market.volatility_ratio), volatility_regime(market.volatility_regime),
+          multi_timeframe_inputs(), oscillators() {
         // CRITICAL: Explicitly copy all Bar fields to avoid struct copy issues
         curr.open_price = market.curr.open_price;
         curr.high_price = market.curr.high_price;
         curr.low_price = market.curr.low_price;
         curr.close_price = market.curr.close_price;
         curr.volume = market.curr.volume;
-        curr.timestamp = market.curr.timestamp;
+        curr.timestamp_ns = market.curr.timestamp_ns;
         
         prev.open_price = market.prev.open_price;
         prev.high_price = market.prev.high_price;
         prev.low_price = market.prev.low_price;
         prev.close_price = market.prev.close_price;
         prev.volume = market.prev.volume;
-        prev.timestamp = market.prev.timestamp;
+        prev.timestamp_ns = market.prev.timestamp_ns;
     }
 };
 
@@ -97,6 +181,7 @@ struct BarRequest {
     std::string symbol;
     int limit;
     int minimum_bars_required;
+    int timeframe_seconds = 0;  // 0 = provider default bars; otherwise a configured accumulator timeframe
     BarRequest(const std::string& input_symbol, int bar_limit, int minimum_bars_required_param) 
         : symbol(input_symbol), limit(bar_limit), minimum_bars_required(minimum_bars_required_param) {}
 };
@@ -115,12 +200,36 @@ struct ClosePositionRequest {
     explicit ClosePositionRequest(int position_qty_param) : current_position_quantity(position_qty_param) {}
 };
 
+// Why the signal rules scored what they did. Kept as flags on the decision path; log sinks render the text.
+enum SignalReasonFlag : uint16_t {
+    SIGNAL_REASON_EVALUATED = 1u << 0,              // Rules ran; without it there is no analysis to render
+    SIGNAL_REASON_SELL_RULES = 1u << 1,             // Flags describe the sell rules (the stronger side)
+    SIGNAL_REASON_BASIC_PATTERN = 1u << 2,
+    SIGNAL_REASON_MOMENTUM = 1u << 3,
+    SIGNAL_REASON_VOLUME = 1u << 4,
+    SIGNAL_REASON_VOLATILITY = 1u << 5,
+    SIGNAL_REASON_MULTI_TIMEFRAME = 1u << 6,        // Confirmation counts below are set
+    SIGNAL_REASON_NO_COMBINED_DECISION = 1u << 7,   // The strategy ensemble found no winner
+    SIGNAL_REASON_OSCILLATORS = 1u << 8             // Oscillator confirmation count below is set
+};
+
+// Which threshold each filter was judged against
+enum FilterBasisFlag : uint8_t {
+    FILTER_BASIS_ATR_PERCENTILE = 1u << 0,
+    FILTER_BASIS_ATR_ABSOLUTE = 1u << 1,            // Neither ATR flag: relative to the average ATR
+    FILTER_BASIS_VOLUME_PERCENTILE = 1u << 2        // Otherwise relative to the average volume
+};
+
 // Strategy logic data structures
 struct SignalDecision {
     bool buy;
     bool sell;
     double signal_strength;
-    std::string signal_reason;
+    double signal_threshold = 0.0;      // Strength threshold after the volatility regime adjustment
+    uint16_t signal_reason_flags = 0;   // SignalReasonFlag bits
+    uint8_t timeframe_confirmations = 0;    // Confirming timeframes for the side the reason describes
+    uint8_t timeframes_with_data = 0;
+    uint8_t oscillator_confirmations = 0;   // Agreeing oscillators for the side the reason describes
 };
 
 struct FilterResult {
@@ -130,6 +239,7 @@ struct FilterResult {
     bool all_pass;
     double atr_ratio;
     double vol_ratio;
+    uint8_t filter_basis_flags = 0;     // FilterBasisFlag bits
 };
 
 struct PositionSizing {
@@ -172,19 +282,6 @@ struct ExitTargetsRequest {
           strategy_configuration(config) {}
 };
 
-struct PositionSizingProcessRequest {
-    const ProcessedData& processed_data;
-    double account_equity;
-    int current_position_quantity;
-    double available_buying_power;
-    const StrategyConfig& strategy_configuration;
-    const TradingModeConfig& trading_mode_configuration;
-    
-    PositionSizingProcessRequest(const ProcessedData& data, double equity, int current_position_qty, double buying_power, const StrategyConfig& strategy_config, const TradingModeConfig& trading_mode_config)
-        : processed_data(data), account_equity(equity), current_position_quantity(current_position_qty), 
-          available_buying_power(buying_power), strategy_configuration(strategy_config), trading_mode_configuration(trading_mode_config) {}
-};
-
 // Market data thread parameter structures
 struct MarketDataFetchRequest {
     std::string symbol;
@@ -2,20 +2,79 @@
 #define DATA_SYNC_STRUCTURES_HPP
 
 #include "data_structures.hpp"
+#include "seqlock_snapshot.hpp"
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 
 namespace AlpacaTrader {
 namespace Core {
 
+// Wakes the trader thread as soon as the market data layer publishes a closed bar (or any snapshot update),
+// so a decision no longer waits for the trader's poll timer. Events are counted rather than flagged:
+// one that lands while the trader is mid-cycle is seen by the next wait instead of being lost.
+class TradingCycleTrigger {
+public:
+    void notify_bar_close() {
+        {
+            std::lock_guard<std::mutex> trigger_guard(trigger_mutex);
+            bar_close_sequence++;
+            snapshot_update_sequence++;
+        }
+        trigger_condition.notify_all();
+    }
+
+    void notify_snapshot_update() {
+        {
+            std::lock_guard<std::mutex> trigger_guard(trigger_mutex);
+            snapshot_update_sequence++;
+        }
+        trigger_condition.notify_all();
+    }
+
+    void notify_shutdown() {
+        {
+            std::lock_guard<std::mutex> trigger_guard(trigger_mutex);
+            shutdown_requested = true;
+        }
+        trigger_condition.notify_all();
+    }
+
+    // Blocks until an unseen event, the heartbeat timeout or shutdown; true when woken by an event
+    bool wait_for_event(bool wake_on_snapshot_update, std::chrono::milliseconds heartbeat_interval) {
+        std::unique_lock<std::mutex> trigger_lock(trigger_mutex);
+        bool event_arrived = trigger_condition.wait_for(trigger_lock, heartbeat_interval, [&]() {
+            return shutdown_requested || has_unseen_event(wake_on_snapshot_update);
+        });
+        bool woken_by_event = event_arrived && has_unseen_event(wake_on_snapshot_update);
+        consumed_bar_close_sequence = bar_close_sequence;
+        consumed_snapshot_update_sequence = snapshot_update_sequence;
+        return woken_by_event;
+    }
+
+private:
+    std::mutex trigger_mutex;
+    std::condition_variable trigger_condition;
+    uint64_t bar_close_sequence = 0;
+    uint64_t snapshot_update_sequence = 0;
+    uint64_t consumed_bar_close_sequence = 0;
+    uint64_t consumed_snapshot_update_sequence = 0;
+    bool shutdown_requested = false;
+
+    bool has_unseen_event(bool wake_on_snapshot_update) const {
+        return wake_on_snapshot_update ? snapshot_update_sequence != consumed_snapshot_update_sequence
+                                       : bar_close_sequence != consumed_bar_close_sequence;
+    }
+};
+
 // Market and account data synchronization state
 struct MarketDataSyncState {
     std::mutex* mtx;
     std::condition_variable* cv;
-    MarketSnapshot* market;
-    AccountSnapshot* account;
+    PublishedMarketSnapshot* market;
+    PublishedAccountSnapshot* account;
     std::atomic<bool>* has_market;
     std::atomic<bool>* has_account;
     std::atomic<bool>* running;
@@ -28,7 +87,7 @@ struct MarketDataSyncState {
     MarketDataSyncState() = delete;
     
     // Member-wise constructor for manual initialization
-    MarketDataSyncState(std::mutex* mtx_ptr, std::condition_variable* cv_ptr, MarketSnapshot* market_ptr, AccountSnapshot* account_ptr,
+    MarketDataSyncState(std::mutex* mtx_ptr, std::condition_variable* cv_ptr, PublishedMarketSnapshot* market_ptr, PublishedAccountSnapshot* account_ptr,
                        std::atomic<bool>* has_market_ptr, std::atomic<bool>* has_account_ptr, std::atomic<bool>* running_ptr, std::atomic<bool>* allow_fetch_ptr,
                        std::atomic<std::chrono::steady_clock::time_point>* market_data_timestamp_ptr, std::atomic<bool>* market_data_fresh_ptr,
                        std::atomic<std::chrono::steady_clock::time_point>* last_order_timestamp_ptr)
@@ -43,8 +102,8 @@ struct MarketDataSyncState {
 struct DataSyncConfig {
     std::mutex& mtx;
     std::condition_variable& cv;
-    MarketSnapshot& market;
-    AccountSnapshot& account;
+    PublishedMarketSnapshot& market;
+    PublishedAccountSnapshot& account;
     std::atomic<bool>& has_market;
     std::atomic<bool>& has_account;
     std::atomic<bool>& running;
@@ -55,7 +114,7 @@ struct DataSyncConfig {
     
     // Constructor for easy initialization
     DataSyncConfig(std::mutex& mtx_ref, std::condition_variable& cv_ref, 
-                   MarketSnapshot& market_ref, AccountSnapshot& account_ref,
+                   PublishedMarketSnapshot& market_ref, PublishedAccountSnapshot& account_ref,
                    std::atomic<bool>& has_market_ref, std::atomic<bool>& has_account_ref,
                    std::atomic<bool>& running_ref, std::atomic<bool>& allow_fetch_ref,
                    std::atomic<std::chrono::steady_clock::time_point>& timestamp_ref,
@@ -70,8 +129,8 @@ struct DataSyncConfig {
 struct DataSyncReferences {
     std::mutex* mtx;
     std::condition_variable* cv;
-    MarketSnapshot* market;
-    AccountSnapshot* account;
+    PublishedMarketSnapshot* market;
+    PublishedAccountSnapshot* account;
     std::atomic<bool>* has_market;
     std::atomic<bool>* has_account;
     std::atomic<bool>* running;
@@ -0,0 +1,92 @@
+#ifndef MARKET_DATA_RESULT_HPP
+#define MARKET_DATA_RESULT_HPP
+
+#include "trader/data_structures/data_structures.hpp"
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Outcome of a step on the market data path. Warm-up and stale feeds are normal states, not exceptions.
+enum class MarketDataStatus {
+    OK,
+    NOT_CONNECTED,
+    INVALID_REQUEST,
+    WARMING_UP,                 // Feed is live but has not accumulated enough bars yet
+    STALE_DATA,                 // Newest real trade data is older than the allowed age
+    PROVIDER_ERROR,             // Transport, parsing or feed start-up failure
+    VALIDATION_FAILED,          // Bars arrived but did not produce usable price data
+    ACCOUNT_DATA_UNAVAILABLE
+};
+
+inline const char* market_data_status_name(MarketDataStatus status) {
+    switch (status) {
+        case MarketDataStatus::OK: return "OK";
+        case MarketDataStatus::NOT_CONNECTED: return "Not Connected";
+        case MarketDataStatus::INVALID_REQUEST: return "Invalid Request";
+        case MarketDataStatus::WARMING_UP: return "Warming Up";
+        case MarketDataStatus::STALE_DATA: return "Stale Data";
+        case MarketDataStatus::PROVIDER_ERROR: return "Provider Error";
+        case MarketDataStatus::VALIDATION_FAILED: return "Validation Failed";
+        case MarketDataStatus::ACCOUNT_DATA_UNAVAILABLE: return "Account Data Unavailable";
+    }
+    return "Unknown";
+}
+
+struct MarketDataError {
+    MarketDataStatus status;
+    std::string message;
+    size_t bars_available;      // Bars the source had when it gave up, for diagnostics
+};
+
+// Status plus payload, or status plus error details. The payload is only meaningful when has_value() is true.
+template <typename ValueType>
+class MarketDataResult {
+public:
+    static MarketDataResult success(ValueType result_value) {
+        MarketDataResult result;
+        result.payload = std::move(result_value);
+        return result;
+    }
+    
+    static MarketDataResult failure(MarketDataStatus failure_status, std::string failure_message, size_t bars_available) {
+        MarketDataResult result;
+        result.error_details.status = failure_status;
+        result.error_details.message = std::move(failure_message);
+        result.error_details.bars_available = bars_available;
+        return result;
+    }
+    
+    // Carries another step's failure up the chain unchanged
+    template <typename OtherValueType>
+    static MarketDataResult failure_from(const MarketDataResult<OtherValueType>& failed_result) {
+        MarketDataResult result;
+        result.error_details = failed_result.error();
+        return result;
+    }
+    
+    bool has_value() const { return error_details.status == MarketDataStatus::OK; }
+    explicit operator bool() const { return has_value(); }
+    MarketDataStatus status() const { return error_details.status; }
+    
+    ValueType& value() { return payload; }
+    const ValueType& value() const { return payload; }
+    const MarketDataError& error() const { return error_details; }
+
+private:
+    MarketDataResult() : payload(), error_details{MarketDataStatus::OK, std::string(), 0} {}
+    
+    ValueType payload;
+    MarketDataError error_details;
+};
+
+using BarsResult = MarketDataResult<std::vector<Bar>>;
+using ProcessedDataResult = MarketDataResult<ProcessedData>;
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // MARKET_DATA_RESULT_HPP
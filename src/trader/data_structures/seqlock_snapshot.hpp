@@ -0,0 +1,91 @@
+#ifndef SEQLOCK_SNAPSHOT_HPP
+#define SEQLOCK_SNAPSHOT_HPP
+
+#include "trader/data_structures/data_structures.hpp"
+#include <atomic>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Single-writer / multi-reader snapshot publication. The writer never waits on readers: it bumps the
+// sequence to odd, rewrites the payload and bumps it back to even. Readers copy the payload and retry
+// if the sequence moved underneath them. The payload is held as relaxed atomic words so the
+// concurrent copy is well defined, which is why the snapshot type must be trivially copyable.
+template <typename SnapshotType>
+class SeqlockSnapshot {
+    static_assert(std::is_trivially_copyable<SnapshotType>::value, "SeqlockSnapshot requires a trivially copyable snapshot type");
+
+public:
+    SeqlockSnapshot() : sequence_counter(0) {
+        store_payload(SnapshotType{});
+    }
+
+    SeqlockSnapshot(const SeqlockSnapshot&) = delete;
+    SeqlockSnapshot& operator=(const SeqlockSnapshot&) = delete;
+
+    // Only one thread may publish to a given snapshot
+    void publish(const SnapshotType& snapshot_value) {
+        uint64_t current_sequence = sequence_counter.load(std::memory_order_relaxed);
+        sequence_counter.store(current_sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        store_payload(snapshot_value);
+        sequence_counter.store(current_sequence + 2, std::memory_order_release);
+    }
+
+    SnapshotType load() const {
+        uint64_t payload_copy[PAYLOAD_WORD_COUNT];
+        while (true) {
+            uint64_t begin_sequence = sequence_counter.load(std::memory_order_acquire);
+            if ((begin_sequence & 1) != 0) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            for (size_t word_index = 0; word_index < PAYLOAD_WORD_COUNT; ++word_index) {
+                payload_copy[word_index] = payload_words[word_index].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (sequence_counter.load(std::memory_order_relaxed) == begin_sequence) {
+                SnapshotType snapshot_value;
+                std::memcpy(&snapshot_value, payload_copy, sizeof(SnapshotType));
+                return snapshot_value;
+            }
+        }
+    }
+
+    // Number of completed publications
+    uint64_t get_publication_count() const { return sequence_counter.load(std::memory_order_acquire) / 2; }
+
+private:
+    static constexpr size_t PAYLOAD_WORD_COUNT = (sizeof(SnapshotType) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    // Sequence and payload on separate cache lines so readers polling the sequence don't share a line with the first payload words
+    alignas(64) std::atomic<uint64_t> sequence_counter;
+    alignas(64) std::atomic<uint64_t> payload_words[PAYLOAD_WORD_COUNT];
+
+    void store_payload(const SnapshotType& snapshot_value) {
+        uint64_t payload_source[PAYLOAD_WORD_COUNT] = {};
+        std::memcpy(payload_source, &snapshot_value, sizeof(SnapshotType));
+        for (size_t word_index = 0; word_index < PAYLOAD_WORD_COUNT; ++word_index) {
+            payload_words[word_index].store(payload_source[word_index], std::memory_order_relaxed);
+        }
+    }
+};
+
+// The confirmation timeframe inputs are several times the size of the market snapshot and only read
+// when multi-timeframe confirmation is on, so they get their own seqlock instead of riding in every copy
+struct PublishedMarketSnapshot : SeqlockSnapshot<MarketSnapshot> {
+    SeqlockSnapshot<MultiTimeframeInputs> multi_timeframe_inputs;
+};
+using PublishedAccountSnapshot = SeqlockSnapshot<AccountSnapshot>;
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // SEQLOCK_SNAPSHOT_HPP
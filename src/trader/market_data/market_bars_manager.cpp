@@ -9,92 +9,78 @@ namespace Core {
 MarketBarsManager::MarketBarsManager(const SystemConfig& cfg, API::ApiManager& api_mgr)
     : config(cfg), api_manager(api_mgr) {}
 
-std::vector<Bar> MarketBarsManager::fetch_bars_data(const std::string& symbol) const {
+BarsResult MarketBarsManager::fetch_bars_data(const std::string& symbol) const {
     if (symbol.empty()) {
-        throw std::runtime_error("Cannot fetch bars data: symbol is empty");
+        return BarsResult::failure(MarketDataStatus::INVALID_REQUEST, "Cannot fetch bars data: symbol is empty", 0);
     }
     
     BarRequest bar_request(symbol, config.strategy.bars_to_fetch_for_calculations, config.strategy.minimum_bars_for_atr_calculation);
-    std::vector<Bar> fetched_bars_result = api_manager.get_recent_bars(bar_request);
-    
-    // DEBUG: Log what was actually fetched (will be logged via coordinator)
-    // Note: bars_to_fetch_for_calculations = 25, but accumulator may have more bars available
-    
-    return fetched_bars_result;
+    return api_manager.get_recent_bars(bar_request);
 }
 
-bool MarketBarsManager::fetch_and_validate_bars(const std::string& symbol, std::vector<Bar>& bars_data) const {
-    bars_data = fetch_bars_data(symbol);
+bool MarketBarsManager::fetch_and_validate_bars(const std::string& symbol, BarSeries& bar_series) const {
+    BarsResult bars_result = fetch_bars_data(symbol);
+    if (!bars_result) {
+        bar_series.clear();
+        return false;
+    }
+    bar_series.assign_from_bars(bars_result.value());
     
-    if (bars_data.empty()) {
+    if (bar_series.empty()) {
         return false;
     }
 
     // CRITICAL: Only require minimum bars (3) instead of full bars_to_fetch_for_calculations (25)
     // This allows processing to start with fewer bars while still fetching more when available
-    if (static_cast<int>(bars_data.size()) < config.strategy.minimum_bars_for_atr_calculation) {
+    if (static_cast<int>(bar_series.size()) < config.strategy.minimum_bars_for_atr_calculation) {
         return false;
     }
 
-    // Validate individual bars
-    for (const auto& bar : bars_data) {
-        if (bar.close_price <= 0.0 || bar.high_price <= 0.0 || bar.low_price <= 0.0 || bar.open_price <= 0.0) {
-            return false;
-        }
-        
-        if (bar.high_price < bar.low_price || bar.high_price < bar.close_price || bar.low_price > bar.close_price) {
-            return false;
-        }
-    }
+    // Validate individual bars with one pass over the price columns
+    return bar_series.has_valid_prices();
+}
 
-    return true;
+// MarketSnapshot and ProcessedData carry the same derived indicator fields
+template <typename IndicatorTarget>
+void MarketBarsManager::apply_indicator_readings(const IndicatorReadings& indicator_readings, IndicatorTarget& indicator_target) {
+    indicator_target.atr = indicator_readings.atr;
+    indicator_target.avg_atr = indicator_readings.avg_atr;
+    indicator_target.avg_vol = indicator_readings.avg_vol;
+    indicator_target.donchian_upper = indicator_readings.donchian.upper;
+    indicator_target.donchian_lower = indicator_readings.donchian.lower;
+    indicator_target.stochastic_k = indicator_readings.stochastic.percent_k;
+    indicator_target.stochastic_d = indicator_readings.stochastic.percent_d;
+    indicator_target.swing_high = indicator_readings.swing.swing_high;
+    indicator_target.swing_low = indicator_readings.swing.swing_low;
+    indicator_target.swing_is_upswing = indicator_readings.swing.is_upswing;
+    indicator_target.atr_percentile = indicator_readings.percentiles.atr_percentile;
+    indicator_target.volume_percentile = indicator_readings.percentiles.volume_percentile;
+    indicator_target.spread_percentile = indicator_readings.percentiles.spread_percentile;
+    indicator_target.percentile_sample_count = static_cast<int>(indicator_readings.percentiles.sample_count);
+    indicator_target.ewma_volatility = indicator_readings.volatility.ewma_volatility;
+    indicator_target.garch_volatility = indicator_readings.volatility.garch_volatility;
+    indicator_target.volatility_ratio = indicator_readings.volatility.volatility_ratio;
+    indicator_target.volatility_regime = indicator_readings.volatility.regime;
 }
 
-bool MarketBarsManager::compute_technical_indicators_from_bars(ProcessedData& processed_data, const std::vector<Bar>& bars_data) const {
-    if (bars_data.empty()) {
+bool MarketBarsManager::compute_technical_indicators_from_series(const std::string& symbol, ProcessedData& processed_data, const BarSeries& bar_series, int timeframe_seconds) const {
+    if (bar_series.empty()) {
         return false;
     }
 
     // Defensive: need at least 2 bars for prev/curr semantics downstream
-    if (bars_data.size() < 2) {
-        return false;
-    }
-
-    // CRITICAL: Validate before accessing back()
-    if (bars_data.empty()) {
+    if (bar_series.size() < 2) {
         return false;
     }
     
-    const Bar& current_bar = bars_data.back();
+    const Bar current_bar = bar_series.latest_bar();
     processed_data.curr = current_bar;
 
-    // Calculate maximum bars needed for all calculations
-    // avg_atr uses: atr_calculation_bars * average_atr_comparison_multiplier + 1 (for true range calculation)
-    const int atr_calculation_bars_value = config.strategy.atr_calculation_bars;
-    const int average_atr_period_bars_value = atr_calculation_bars_value * config.strategy.average_atr_comparison_multiplier;
-    const int max_bars_needed_for_calculations_value = average_atr_period_bars_value + 1;
+    IndicatorReadings indicator_readings = update_indicator_state(symbol, timeframe_seconds, bar_series);
     
-    // Extract only the last N bars needed for calculations (optimize buffer usage)
-    // This ensures we use only recent bars and avoid unnecessary processing of old data
-    std::vector<Bar> bars_for_calculation_data;
-    if (static_cast<int>(bars_data.size()) > max_bars_needed_for_calculations_value) {
-        size_t start_index_value = bars_data.size() - static_cast<size_t>(max_bars_needed_for_calculations_value);
-        bars_for_calculation_data = std::vector<Bar>(bars_data.begin() + start_index_value, bars_data.end());
-    } else {
-        bars_for_calculation_data = bars_data;
-    }
-    
-    // Extract price data for calculations (using only bars needed)
-    std::vector<double> highs = extract_highs_from_bars(bars_for_calculation_data);
-    std::vector<double> lows = extract_lows_from_bars(bars_for_calculation_data);
-    std::vector<double> closes = extract_closes_from_bars(bars_for_calculation_data);
-    std::vector<double> volumes = extract_volumes_from_bars(bars_for_calculation_data);
-
-    // Compute ATR - calculates continuously, can be 0.0 during initial accumulation
-    processed_data.atr = AlpacaTrader::Core::compute_atr(highs, lows, closes, atr_calculation_bars_value, config.strategy.minimum_bars_for_atr_calculation);
-
-    // Compute average volume
-    processed_data.avg_vol = AlpacaTrader::Core::compute_average_volume(volumes, atr_calculation_bars_value, config.strategy.minimum_volume_threshold);
+    // ATR calculates continuously, can be 0.0 during initial accumulation
+    apply_indicator_readings(indicator_readings, processed_data);
+    processed_data.multi_timeframe_inputs = indicator_readings.multi_timeframe;
 
     // Detect doji pattern
     processed_data.is_doji = AlpacaTrader::Core::detect_doji_pattern(current_bar.open_price, current_bar.high_price, current_bar.low_price, current_bar.close_price);
@@ -104,57 +90,32 @@ bool MarketBarsManager::compute_technical_indicators_from_bars(ProcessedData& pr
     return true;
 }
 
-MarketSnapshot MarketBarsManager::create_market_snapshot_from_bars(const std::vector<Bar>& bars_data) const {
+MarketSnapshot MarketBarsManager::create_market_snapshot_from_series(const std::string& symbol, const BarSeries& bar_series, int timeframe_seconds, MultiTimeframeInputs& multi_timeframe_inputs_output) const {
     // Top-level try-catch to prevent segfault
     MarketSnapshot market_snapshot;
     
     try {
-        if (bars_data.empty()) {
+        if (bar_series.empty()) {
             return market_snapshot;
         }
 
-    // Calculate maximum bars needed for all calculations
-    // avg_atr uses: atr_calculation_bars * average_atr_comparison_multiplier + 1 (for true range calculation)
-    const int atr_calculation_bars_value = config.strategy.atr_calculation_bars;
-    const int minimum_bars_for_atr_value = config.strategy.minimum_bars_for_atr_calculation;
-    const int average_atr_period_bars_value = atr_calculation_bars_value * config.strategy.average_atr_comparison_multiplier;
-    const int max_bars_needed_for_calculations_value = average_atr_period_bars_value + 1;
-    
-    // Extract only the last N bars needed for calculations (optimize buffer usage)
-    // This ensures we use only recent bars and avoid unnecessary processing of old data
-    std::vector<Bar> bars_for_calculation_data;
-    if (static_cast<int>(bars_data.size()) > max_bars_needed_for_calculations_value) {
-        size_t start_index_value = bars_data.size() - static_cast<size_t>(max_bars_needed_for_calculations_value);
-        bars_for_calculation_data = std::vector<Bar>(bars_data.begin() + start_index_value, bars_data.end());
-    } else {
-        bars_for_calculation_data = bars_data;
-    }
-    
-    // Extract inputs for technical indicators (using only bars needed)
-    std::vector<double> highs = extract_highs_from_bars(bars_for_calculation_data);
-    std::vector<double> lows = extract_lows_from_bars(bars_for_calculation_data);
-    std::vector<double> closes = extract_closes_from_bars(bars_for_calculation_data);
-    std::vector<double> volumes = extract_volumes_from_bars(bars_for_calculation_data);
-
-    // Use configurable ATR calculation bars, but ATR will adapt to available bars
-    market_snapshot.atr = AlpacaTrader::Core::compute_atr(highs, lows, closes, atr_calculation_bars_value, minimum_bars_for_atr_value);
-    
-    market_snapshot.avg_atr = AlpacaTrader::Core::compute_atr(highs, lows, closes, average_atr_period_bars_value, minimum_bars_for_atr_value);
-    
-    market_snapshot.avg_vol = AlpacaTrader::Core::compute_average_volume(volumes, atr_calculation_bars_value, config.strategy.minimum_volume_threshold);
+    // Indicators are read from the streaming state; only bars newer than the last call are folded in
+    IndicatorReadings indicator_readings = update_indicator_state(symbol, timeframe_seconds, bar_series);
+    apply_indicator_readings(indicator_readings, market_snapshot);
+    multi_timeframe_inputs_output = indicator_readings.multi_timeframe;
 
     // Set current and previous bars - CRITICAL: Add try-catch and validate bounds
     try {
-        if (bars_data.empty()) {
+        if (bar_series.empty()) {
             return market_snapshot;
         }
         
-        const Bar& latest_bar = bars_data.back();
+        const Bar latest_bar = bar_series.latest_bar();
         
         // CRITICAL: Validate bar data before assigning
         if (latest_bar.open_price > 0.0 && (latest_bar.high_price == 0.0 || latest_bar.low_price == 0.0 || latest_bar.close_price == 0.0)) {
             // Bar data is incomplete - this is a critical error that should not be silently ignored
-            std::string error_msg = "CRITICAL: create_market_snapshot_from_bars - Bar data incomplete - O:" + 
+            std::string error_msg = "CRITICAL: create_market_snapshot_from_series - Bar data incomplete - O:" + 
                 std::to_string(latest_bar.open_price) + " H:" + std::to_string(latest_bar.high_price) + 
                 " L:" + std::to_string(latest_bar.low_price) + " C:" + std::to_string(latest_bar.close_price);
             // Re-throw to be caught by coordinator exception handler
@@ -167,24 +128,24 @@ MarketSnapshot MarketBarsManager::create_market_snapshot_from_bars(const std::ve
         market_snapshot.curr.low_price = latest_bar.low_price;
         market_snapshot.curr.close_price = latest_bar.close_price;
         market_snapshot.curr.volume = latest_bar.volume;
-        market_snapshot.curr.timestamp = latest_bar.timestamp;
+        market_snapshot.curr.timestamp_ns = latest_bar.timestamp_ns;
         
-        if (bars_data.size() > 1) {
-            size_t prev_index = bars_data.size() - 2;
-            if (prev_index < bars_data.size()) {
-                const Bar& prev_bar = bars_data[prev_index];
+        if (bar_series.size() > 1) {
+            size_t prev_index = bar_series.size() - 2;
+            if (prev_index < bar_series.size()) {
+                const Bar prev_bar = bar_series.bar_at(prev_index);
                 market_snapshot.prev.open_price = prev_bar.open_price;
                 market_snapshot.prev.high_price = prev_bar.high_price;
                 market_snapshot.prev.low_price = prev_bar.low_price;
                 market_snapshot.prev.close_price = prev_bar.close_price;
                 market_snapshot.prev.volume = prev_bar.volume;
-                market_snapshot.prev.timestamp = prev_bar.timestamp;
+                market_snapshot.prev.timestamp_ns = prev_bar.timestamp_ns;
             }
         }
         
         // Store oldest bar timestamp for data accumulation time checking
-        if (!bars_data.empty()) {
-            market_snapshot.oldest_bar_timestamp = bars_data.front().timestamp;
+        if (!bar_series.empty()) {
+            market_snapshot.oldest_bar_timestamp_ns = bar_series.oldest_timestamp_ns();
         }
     } catch (const std::exception& bar_access_exception_error) {
         // Re-throw to be caught by coordinator - don't silently return partial data
@@ -204,146 +165,179 @@ MarketSnapshot MarketBarsManager::create_market_snapshot_from_bars(const std::ve
     return market_snapshot;
 }
 
-std::vector<Bar> MarketBarsManager::fetch_historical_market_data(const MarketDataFetchRequest& fetch_request) const {
+BarsResult MarketBarsManager::fetch_historical_market_data(const MarketDataFetchRequest& fetch_request) const {
     if (fetch_request.symbol.empty()) {
-        throw std::runtime_error("Cannot fetch historical market data: symbol is empty");
+        return BarsResult::failure(MarketDataStatus::INVALID_REQUEST, "Cannot fetch historical market data: symbol is empty", 0);
     }
     
     if (fetch_request.bars_to_fetch <= 0) {
-        throw std::runtime_error("Cannot fetch historical market data: bars_to_fetch must be greater than 0");
+        return BarsResult::failure(MarketDataStatus::INVALID_REQUEST, "Cannot fetch historical market data: bars_to_fetch must be greater than 0", 0);
     }
     
     BarRequest bar_request{fetch_request.symbol, fetch_request.bars_to_fetch, config.strategy.minimum_bars_for_atr_calculation};
     return api_manager.get_recent_bars(bar_request);
 }
 
-bool MarketBarsManager::has_sufficient_bars_for_calculations(const std::vector<Bar>& historical_bars, int required_bars) const {
+bool MarketBarsManager::has_sufficient_bars_for_calculations(const BarSeries& historical_bar_series, int required_bars) const {
     if (required_bars <= 0) {
         return false;
     }
     
     int minimum_required_bars = required_bars + 2;
     
-    if (static_cast<int>(historical_bars.size()) < minimum_required_bars) {
+    if (static_cast<int>(historical_bar_series.size()) < minimum_required_bars) {
         return false;
     }
     
     return true;
 }
 
-ProcessedData MarketBarsManager::compute_processed_data_from_bars(const std::vector<Bar>& bars_data) const {
+ProcessedData MarketBarsManager::compute_processed_data_from_series(const std::string& symbol, const BarSeries& bar_series, int timeframe_seconds) const {
     // Top-level try-catch to prevent segfault
     ProcessedData processed_data_result;
     
     try {
-        if (bars_data.empty()) {
+        if (bar_series.empty()) {
             return processed_data_result;
         }
 
-    // Calculate maximum bars needed for all calculations
-    // avg_atr uses: atr_calculation_bars * average_atr_comparison_multiplier + 1 (for true range calculation)
-    const int atr_calculation_bars_value = config.strategy.atr_calculation_bars;
-    const int minimum_bars_for_atr_value = config.strategy.minimum_bars_for_atr_calculation;
-    const int average_atr_period_bars_value = atr_calculation_bars_value * config.strategy.average_atr_comparison_multiplier;
-    const int max_bars_needed_for_calculations_value = average_atr_period_bars_value + 1;
-    
-    // Extract only the last N bars needed for calculations (optimize buffer usage)
-    // This ensures we use only recent bars and avoid unnecessary processing of old data
-    std::vector<Bar> bars_for_calculation_data;
-    if (static_cast<int>(bars_data.size()) > max_bars_needed_for_calculations_value) {
-        size_t start_index_value = bars_data.size() - static_cast<size_t>(max_bars_needed_for_calculations_value);
-        bars_for_calculation_data = std::vector<Bar>(bars_data.begin() + start_index_value, bars_data.end());
-    } else {
-        bars_for_calculation_data = bars_data;
-    }
-    
-    // Extract price data for calculations (using only bars needed)
-    std::vector<double> highs = extract_highs_from_bars(bars_for_calculation_data);
-    std::vector<double> lows = extract_lows_from_bars(bars_for_calculation_data);
-    std::vector<double> closes = extract_closes_from_bars(bars_for_calculation_data);
-    std::vector<double> volumes = extract_volumes_from_bars(bars_for_calculation_data);
-    
     // Compute technical indicators - ATR calculates continuously, can be 0.0 during initial accumulation
-    processed_data_result.atr = AlpacaTrader::Core::compute_atr(highs, lows, closes, atr_calculation_bars_value, minimum_bars_for_atr_value);
-    
-    processed_data_result.avg_atr = AlpacaTrader::Core::compute_atr(highs, lows, closes, average_atr_period_bars_value, minimum_bars_for_atr_value);
-    processed_data_result.avg_vol = AlpacaTrader::Core::compute_average_volume(volumes, atr_calculation_bars_value, config.strategy.minimum_volume_threshold);
+    IndicatorReadings indicator_readings = update_indicator_state(symbol, timeframe_seconds, bar_series);
+    apply_indicator_readings(indicator_readings, processed_data_result);
+    processed_data_result.multi_timeframe_inputs = indicator_readings.multi_timeframe;
     
     // Defensive checks before accessing tail elements - CRITICAL: Add comprehensive bounds checking
     try {
-        if (bars_data.size() < 2) {
+        if (bar_series.size() < 2) {
             throw std::runtime_error("Insufficient bars for processed data tail access");
         }
         
         // Validate indices before accessing
-        size_t bars_size_value = bars_data.size();
+        size_t bars_size_value = bar_series.size();
         if (bars_size_value == 0) {
-            throw std::runtime_error("Empty bars_data vector");
+            throw std::runtime_error("Empty bar series");
         }
         
         // Access current bar (last element)
-        processed_data_result.curr = bars_data.back();
+        processed_data_result.curr = bar_series.latest_bar();
         
         // Access previous bar (second to last) - CRITICAL: Validate index
         size_t prev_index_value = bars_size_value - 2;
         if (prev_index_value >= bars_size_value) {
             throw std::runtime_error("Invalid previous bar index: " + std::to_string(prev_index_value) + " >= " + std::to_string(bars_size_value));
         }
-        processed_data_result.prev = bars_data[prev_index_value];
+        processed_data_result.prev = bar_series.bar_at(prev_index_value);
         
         // Store oldest bar timestamp for data accumulation time checking
-        if (!bars_data.empty()) {
-            processed_data_result.oldest_bar_timestamp = bars_data.front().timestamp;
+        if (!bar_series.empty()) {
+            processed_data_result.oldest_bar_timestamp_ns = bar_series.oldest_timestamp_ns();
         }
     } catch (const std::exception& bar_access_exception_error) {
         // Log error and re-throw to ensure system fails hard on invalid data
-        throw std::runtime_error("Exception accessing bars_data elements: " + std::string(bar_access_exception_error.what()));
+        throw std::runtime_error("Exception accessing bar series elements: " + std::string(bar_access_exception_error.what()));
     } catch (...) {
-        throw std::runtime_error("Unknown exception accessing bars_data elements");
+        throw std::runtime_error("Unknown exception accessing bar series elements");
     }
     } catch (const std::exception& top_level_exception_error) {
-        throw std::runtime_error("CRITICAL: Top-level exception in compute_processed_data_from_bars: " + std::string(top_level_exception_error.what()));
+        throw std::runtime_error("CRITICAL: Top-level exception in compute_processed_data_from_series: " + std::string(top_level_exception_error.what()));
     } catch (...) {
-        throw std::runtime_error("CRITICAL: Unknown top-level exception in compute_processed_data_from_bars - segfault prevented");
+        throw std::runtime_error("CRITICAL: Unknown top-level exception in compute_processed_data_from_series - segfault prevented");
     }
     
     return processed_data_result;
 }
 
-std::vector<double> MarketBarsManager::extract_highs_from_bars(const std::vector<Bar>& bars_data) const {
-    std::vector<double> highs;
-    highs.reserve(bars_data.size());
-    for (const auto& bar : bars_data) {
-        highs.push_back(bar.high_price);
-    }
-    return highs;
+IncrementalIndicatorParameters MarketBarsManager::make_indicator_parameters() const {
+    IncrementalIndicatorParameters indicator_parameters;
+    indicator_parameters.atr_period = config.strategy.atr_calculation_bars;
+    indicator_parameters.average_atr_period = config.strategy.atr_calculation_bars * config.strategy.average_atr_comparison_multiplier;
+    indicator_parameters.volume_period = config.strategy.atr_calculation_bars;
+    indicator_parameters.minimum_bars_required = config.strategy.minimum_bars_for_atr_calculation;
+    indicator_parameters.minimum_volume_threshold = config.strategy.minimum_volume_threshold;
+    indicator_parameters.donchian_period = config.strategy.donchian_channel_bars;
+    indicator_parameters.stochastic_k_period = config.strategy.stochastic_k_bars;
+    indicator_parameters.stochastic_d_period = config.strategy.stochastic_d_bars;
+    indicator_parameters.swing_lookback_period = config.strategy.swing_lookback_bars;
+    indicator_parameters.percentile_window_length = config.strategy.percentile_window_bars;
+    indicator_parameters.volatility_regime_settings.ewma_decay = config.strategy.ewma_volatility_decay;
+    indicator_parameters.volatility_regime_settings.refit_window_length = config.strategy.garch_refit_window_bars;
+    indicator_parameters.volatility_regime_settings.refit_interval_bars = config.strategy.garch_refit_interval_bars;
+    indicator_parameters.volatility_regime_settings.high_regime_ratio = config.strategy.high_volatility_regime_ratio;
+    indicator_parameters.volatility_regime_settings.low_regime_ratio = config.strategy.low_volatility_regime_ratio;
+    indicator_parameters.volatility_regime_settings.hysteresis_band = config.strategy.volatility_regime_hysteresis;
+    indicator_parameters.garch_refit_slot = nullptr;
+    return indicator_parameters;
 }
 
-std::vector<double> MarketBarsManager::extract_lows_from_bars(const std::vector<Bar>& bars_data) const {
-    std::vector<double> lows;
-    lows.reserve(bars_data.size());
-    for (const auto& bar : bars_data) {
-        lows.push_back(bar.low_price);
+MarketBarsManager::SymbolIndicatorStates& MarketBarsManager::get_symbol_indicator_states(const std::string& symbol) const {
+    std::lock_guard<std::mutex> symbol_map_guard(symbol_indicator_states_mutex);
+    std::unique_ptr<SymbolIndicatorStates>& symbol_states = symbol_indicator_states[symbol];
+    if (!symbol_states) {
+        symbol_states = std::make_unique<SymbolIndicatorStates>();
     }
-    return lows;
+    return *symbol_states;
 }
 
-std::vector<double> MarketBarsManager::extract_closes_from_bars(const std::vector<Bar>& bars_data) const {
-    std::vector<double> closes;
-    closes.reserve(bars_data.size());
-    for (const auto& bar : bars_data) {
-        closes.push_back(bar.close_price);
+MarketBarsManager::IndicatorReadings MarketBarsManager::update_indicator_state(const std::string& symbol, int timeframe_seconds, const BarSeries& bar_series) const {
+    SymbolIndicatorStates& symbol_states = get_symbol_indicator_states(symbol);
+    
+    std::lock_guard<std::mutex> symbol_states_guard(symbol_states.symbol_states_mutex);
+    auto indicator_state_iterator = symbol_states.timeframe_states.find(timeframe_seconds);
+    if (indicator_state_iterator == symbol_states.timeframe_states.end()) {
+        IncrementalIndicatorParameters indicator_parameters = make_indicator_parameters();
+        indicator_parameters.garch_refit_slot = garch_refit_worker.create_slot(static_cast<size_t>(config.strategy.garch_refit_window_bars));
+        
+        indicator_state_iterator = symbol_states.timeframe_states.emplace(timeframe_seconds, IncrementalIndicatorState(indicator_parameters)).first;
     }
-    return closes;
+    
+    IncrementalIndicatorState& indicator_state = indicator_state_iterator->second;
+    indicator_state.update_from_series(bar_series);
+    
+    IndicatorReadings indicator_readings;
+    indicator_readings.atr = indicator_state.get_atr();
+    indicator_readings.avg_atr = indicator_state.get_average_atr();
+    indicator_readings.avg_vol = indicator_state.get_average_volume();
+    indicator_readings.donchian = indicator_state.get_donchian_channel();
+    indicator_readings.stochastic = indicator_state.get_stochastic();
+    indicator_readings.swing = indicator_state.get_swing_points();
+    indicator_readings.percentiles = indicator_state.get_rolling_percentiles();
+    indicator_readings.volatility = indicator_state.get_volatility_regime();
+    
+    // Confirmation timeframes are rolled up from the provider's default bars only
+    if (timeframe_seconds == 0 && config.strategy.enable_multi_timeframe_confirmation) {
+        update_confirmation_timeframes(symbol_states, bar_series, indicator_readings.multi_timeframe);
+    }
+    return indicator_readings;
 }
 
-std::vector<double> MarketBarsManager::extract_volumes_from_bars(const std::vector<Bar>& bars_data) const {
-    std::vector<double> volumes;
-    volumes.reserve(bars_data.size());
-    for (const auto& bar : bars_data) {
-        volumes.push_back(bar.volume);
+void MarketBarsManager::update_confirmation_timeframes(SymbolIndicatorStates& symbol_states, const BarSeries& base_bar_series, MultiTimeframeInputs& multi_timeframe_inputs) const {
+    multi_timeframe_inputs.timeframe_count = 0;
+    
+    for (int confirmation_timeframe_seconds : config.strategy.confirmation_timeframes_seconds) {
+        if (multi_timeframe_inputs.timeframe_count >= MultiTimeframeInputs::MAXIMUM_TIMEFRAMES) {
+            break;
+        }
+        
+        auto confirmation_state_iterator = symbol_states.confirmation_states.find(confirmation_timeframe_seconds);
+        if (confirmation_state_iterator == symbol_states.confirmation_states.end()) {
+            ConfirmationTimeframeState confirmation_state{TimeframeBarBuilder(confirmation_timeframe_seconds), IncrementalIndicatorState(make_indicator_parameters())};
+            confirmation_state_iterator = symbol_states.confirmation_states.emplace(confirmation_timeframe_seconds, std::move(confirmation_state)).first;
+        }
+        
+        ConfirmationTimeframeState& confirmation_state = confirmation_state_iterator->second;
+        confirmation_state.bar_builder.update_from_series(base_bar_series);
+        confirmation_state.indicator_state.update_from_series(confirmation_state.bar_builder.get_new_bars());
+        
+        TimeframeSignalInputs& timeframe_inputs = multi_timeframe_inputs.timeframes[multi_timeframe_inputs.timeframe_count];
+        timeframe_inputs.timeframe_seconds = confirmation_timeframe_seconds;
+        timeframe_inputs.has_data = confirmation_state.bar_builder.has_current_bar() && confirmation_state.bar_builder.has_previous_bar();
+        if (timeframe_inputs.has_data) {
+            timeframe_inputs.curr = confirmation_state.bar_builder.get_current_bar();
+            timeframe_inputs.prev = confirmation_state.bar_builder.get_previous_bar();
+        }
+        timeframe_inputs.atr = confirmation_state.indicator_state.get_atr();
+        multi_timeframe_inputs.timeframe_count++;
     }
-    return volumes;
 }
 
 } // namespace Core
@@ -3,7 +3,15 @@
 
 #include "configs/system_config.hpp"
 #include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/bar_series.hpp"
+#include "trader/data_structures/market_data_result.hpp"
 #include "api/general/api_manager.hpp"
+#include "trader/strategy_analysis/incremental_indicators.hpp"
+#include "timeframe_bar_builder.hpp"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 using AlpacaTrader::Config::SystemConfig;
 
@@ -14,26 +22,63 @@ class MarketBarsManager {
 public:
     MarketBarsManager(const SystemConfig& config, API::ApiManager& api_manager);
 
-    // Bars data fetching methods
-    std::vector<Bar> fetch_bars_data(const std::string& symbol) const;
-    bool fetch_and_validate_bars(const std::string& symbol, std::vector<Bar>& bars_data) const;
-    std::vector<Bar> fetch_historical_market_data(const MarketDataFetchRequest& fetch_request) const;
-    bool has_sufficient_bars_for_calculations(const std::vector<Bar>& historical_bars, int required_bars) const;
+    // Bars data fetching methods; a warming-up or stale feed is a failed result, not an exception
+    BarsResult fetch_bars_data(const std::string& symbol) const;
+    bool fetch_and_validate_bars(const std::string& symbol, BarSeries& bar_series) const;
+    BarsResult fetch_historical_market_data(const MarketDataFetchRequest& fetch_request) const;
+    bool has_sufficient_bars_for_calculations(const BarSeries& historical_bar_series, int required_bars) const;
     
     // Bars data processing methods
-    bool compute_technical_indicators_from_bars(ProcessedData& processed_data, const std::vector<Bar>& bars_data) const;
-    ProcessedData compute_processed_data_from_bars(const std::vector<Bar>& bars_data) const;
-    MarketSnapshot create_market_snapshot_from_bars(const std::vector<Bar>& bars_data) const;
+    // Indicators come from per-symbol/timeframe streaming state; timeframe 0 is the provider's default bars
+    bool compute_technical_indicators_from_series(const std::string& symbol, ProcessedData& processed_data, const BarSeries& bar_series, int timeframe_seconds) const;
+    ProcessedData compute_processed_data_from_series(const std::string& symbol, const BarSeries& bar_series, int timeframe_seconds) const;
+    // Confirmation timeframe inputs are returned separately; MarketSnapshot stays small for seqlock copies
+    MarketSnapshot create_market_snapshot_from_series(const std::string& symbol, const BarSeries& bar_series, int timeframe_seconds, MultiTimeframeInputs& multi_timeframe_inputs_output) const;
 
 private:
     const SystemConfig& config;
     API::ApiManager& api_manager;
     
-    // Bars processing helper methods
-    std::vector<double> extract_highs_from_bars(const std::vector<Bar>& bars_data) const;
-    std::vector<double> extract_lows_from_bars(const std::vector<Bar>& bars_data) const;
-    std::vector<double> extract_closes_from_bars(const std::vector<Bar>& bars_data) const;
-    std::vector<double> extract_volumes_from_bars(const std::vector<Bar>& bars_data) const;
+    // Streaming indicator state, keyed by symbol and timeframe
+    struct IndicatorReadings {
+        double atr;
+        double avg_atr;
+        double avg_vol;
+        DonchianChannelReading donchian;
+        StochasticReading stochastic;
+        SwingPointReading swing;
+        RollingPercentileReading percentiles;
+        VolatilityRegimeReading volatility;
+        MultiTimeframeInputs multi_timeframe;
+    };
+    
+    // Confirmation timeframe rolled up from a symbol's base bars, with its own streaming indicators
+    struct ConfirmationTimeframeState {
+        TimeframeBarBuilder bar_builder;
+        IncrementalIndicatorState indicator_state;
+    };
+    
+    // All streaming state of one symbol, keyed by timeframe. Each symbol has its own mutex so
+    // different symbols can be updated from different threads at the same time.
+    struct SymbolIndicatorStates {
+        std::mutex symbol_states_mutex;
+        std::unordered_map<int, IncrementalIndicatorState> timeframe_states;
+        std::unordered_map<int, ConfirmationTimeframeState> confirmation_states;
+    };
+    
+    // Declared before symbol_indicator_states: slots hold a pointer back to the worker
+    mutable GarchRefitWorker garch_refit_worker;
+    // Guards only lookup and insertion; entries are never removed, so returned pointers stay valid
+    mutable std::mutex symbol_indicator_states_mutex;
+    mutable std::unordered_map<std::string, std::unique_ptr<SymbolIndicatorStates>> symbol_indicator_states;
+    
+    IncrementalIndicatorParameters make_indicator_parameters() const;
+    SymbolIndicatorStates& get_symbol_indicator_states(const std::string& symbol) const;
+    IndicatorReadings update_indicator_state(const std::string& symbol, int timeframe_seconds, const BarSeries& bar_series) const;
+    template <typename IndicatorTarget>
+    static void apply_indicator_readings(const IndicatorReadings& indicator_readings, IndicatorTarget& indicator_target);
+    // Caller holds the symbol's symbol_states_mutex
+    void update_confirmation_timeframes(SymbolIndicatorStates& symbol_states, const BarSeries& base_bar_series, MultiTimeframeInputs& multi_timeframe_inputs) const;
 };
 
 } // namespace Core
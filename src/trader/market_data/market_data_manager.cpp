@@ -1,6 +1,7 @@
 #include "market_data_manager.hpp"
 #include <stdexcept>
 #include <cmath>
+#include <utility>
 
 namespace AlpacaTrader {
 namespace Core {
@@ -11,27 +12,26 @@ MarketDataManager::MarketDataManager(const SystemConfig& cfg, API::ApiManager& a
       market_data_validator(cfg),
       market_bars_manager(cfg, api_mgr) {}
 
-std::pair<ProcessedData, std::vector<Bar>> MarketDataManager::fetch_and_process_market_data() {
-    std::vector<Bar> fetched_bars_data;
+ProcessedDataResult MarketDataManager::fetch_and_process_market_data(BarSeries& bar_series_output) {
+    bar_series_output.clear();
     
-    try {
-    // Fetch bars data once (will be used for snapshots and returned for CSV logging)
-        fetched_bars_data = market_bars_manager.fetch_bars_data(config.strategy.symbol);
+    // Fetch bars once and lay them out as columns (used for snapshots and returned for CSV logging)
+    BarsResult bars_result = market_bars_manager.fetch_bars_data(config.strategy.symbol);
+    if (!bars_result) {
+        return ProcessedDataResult::failure_from(bars_result);
+    }
+    bar_series_output.assign_from_bars(bars_result.value());
     
-    // Fetch current snapshots using the bars we just fetched (avoids duplicate fetch)
-    auto snapshots = fetch_current_snapshots_from_bars(fetched_bars_data);
-    MarketSnapshot market_snapshot = snapshots.first;
-    AccountSnapshot account_snapshot = snapshots.second;
-
-        // Validate market snapshot - ATR can be 0.0 during accumulation, allow if price data is valid
-        // If validation fails, check if we have minimal valid price data to proceed
-        bool validation_passed = market_data_validator.validate_market_snapshot(market_snapshot);
-        
-        // DEBUG: Log validation result and snapshot state
-        // Note: This debug info will be logged via coordinator's exception logging
+    // Account lookups go over HTTP and still report transport failures by throwing; this is the boundary for them
+    try {
+        // Fetch current snapshots using the bars we just fetched (avoids duplicate fetch)
+        MultiTimeframeInputs multi_timeframe_inputs;
+        auto snapshots = fetch_current_snapshots_from_series(bar_series_output, multi_timeframe_inputs);
+        MarketSnapshot market_snapshot = snapshots.first;
+        AccountSnapshot account_snapshot = snapshots.second;
         
-        if (!validation_passed) {
-            // Check if we have at least valid price data (even if ATR is 0 or other indicators are missing)
+        // ATR can be 0.0 during accumulation; only a snapshot without usable price data is rejected here
+        if (!market_data_validator.validate_market_snapshot(market_snapshot)) {
             bool has_minimal_price_data = market_snapshot.curr.close_price > 0.0 && 
                                            market_snapshot.curr.open_price > 0.0 &&
                                            market_snapshot.curr.high_price > 0.0 &&
@@ -41,58 +41,57 @@ std::pair<ProcessedData, std::vector<Bar>> MarketDataManager::fetch_and_process_
                                            market_snapshot.curr.low_price <= market_snapshot.curr.close_price;
             
             if (!has_minimal_price_data) {
-                // No valid price data but bars were fetched - return empty ProcessedData with bars
-                // Coordinator can use fallback logic to create snapshot from bars
                 std::string validation_error_message = "Market snapshot validation failed - no valid price data. ";
-                validation_error_message += "Bars fetched: " + std::to_string(fetched_bars_data.size()) + ". ";
                 validation_error_message += "ATR: " + std::to_string(market_snapshot.atr) + ", ";
                 validation_error_message += "Current price: " + std::to_string(market_snapshot.curr.close_price) + ". ";
                 validation_error_message += "This may indicate: insufficient bars, invalid price data, or missing technical indicators.";
-                // Return empty ProcessedData with bars so coordinator can use fallback
-                return {ProcessedData{}, fetched_bars_data};
+                return ProcessedDataResult::failure(MarketDataStatus::VALIDATION_FAILED, std::move(validation_error_message), bar_series_output.size());
             }
             // Have minimal price data but validation failed (likely ATR=0 or missing indicators)
             // Continue anyway - trading will be blocked by data accumulation time check
-    }
-
-    // Create processed data from snapshots
-    ProcessedData processed_data = ProcessedData(market_snapshot, account_snapshot);
-    
-    // DEBUG: Log bar data in ProcessedData after creation
-    if (processed_data.curr.open_price > 0.0 && (processed_data.curr.high_price == 0.0 || processed_data.curr.low_price == 0.0 || processed_data.curr.close_price == 0.0)) {
-        // Log warning - this will be caught by coordinator exception logging
-        throw std::runtime_error("WARNING: ProcessedData created with incomplete bar data - O:" + 
-            std::to_string(processed_data.curr.open_price) + " H:" + std::to_string(processed_data.curr.high_price) + 
-            " L:" + std::to_string(processed_data.curr.low_price) + " C:" + std::to_string(processed_data.curr.close_price));
-    }
-
-    // Process account and position data
-    if (!process_account_and_position_data(processed_data)) {
-        throw std::runtime_error("Failed to process account and position data");
-    }
-    
-    return {processed_data, fetched_bars_data};
+        }
+        
+        // Create processed data from snapshots
+        ProcessedData processed_data = ProcessedData(market_snapshot, account_snapshot);
+        processed_data.multi_timeframe_inputs = multi_timeframe_inputs;
+        
+        if (processed_data.curr.open_price > 0.0 && (processed_data.curr.high_price == 0.0 || processed_data.curr.low_price == 0.0 || processed_data.curr.close_price == 0.0)) {
+            return ProcessedDataResult::failure(MarketDataStatus::VALIDATION_FAILED, "ProcessedData created with incomplete bar data - O:" + 
+                std::to_string(processed_data.curr.open_price) + " H:" + std::to_string(processed_data.curr.high_price) + 
+                " L:" + std::to_string(processed_data.curr.low_price) + " C:" + std::to_string(processed_data.curr.close_price), bar_series_output.size());
+        }
+        
+        // Process account and position data
+        if (!process_account_and_position_data(processed_data)) {
+            return ProcessedDataResult::failure(MarketDataStatus::ACCOUNT_DATA_UNAVAILABLE, "Failed to process account and position data", bar_series_output.size());
+        }
+        
+        return ProcessedDataResult::success(std::move(processed_data));
     } catch (const std::exception& exception_error) {
-        // Return empty ProcessedData with bars if exception occurs
-        return {ProcessedData{}, fetched_bars_data};
+        // bar_series_output keeps whatever was fetched
+        return ProcessedDataResult::failure(MarketDataStatus::ACCOUNT_DATA_UNAVAILABLE, "Account snapshot failed: " + std::string(exception_error.what()), bar_series_output.size());
     } catch (...) {
-        // Return empty ProcessedData with bars if unknown exception occurs
-        return {ProcessedData{}, fetched_bars_data};
+        return ProcessedDataResult::failure(MarketDataStatus::ACCOUNT_DATA_UNAVAILABLE, "Unknown exception creating account snapshot", bar_series_output.size());
     }
 }
 
 std::pair<MarketSnapshot, AccountSnapshot> MarketDataManager::fetch_current_snapshots() {
     // Fetch bars and create snapshots from them
-    std::vector<Bar> bars_data = market_bars_manager.fetch_bars_data(config.strategy.symbol);
-    return fetch_current_snapshots_from_bars(bars_data);
+    BarSeries bar_series;
+    BarsResult bars_result = market_bars_manager.fetch_bars_data(config.strategy.symbol);
+    if (bars_result) {
+        bar_series.assign_from_bars(bars_result.value());
+    }
+    MultiTimeframeInputs multi_timeframe_inputs;
+    return fetch_current_snapshots_from_series(bar_series, multi_timeframe_inputs);
 }
 
-std::pair<MarketSnapshot, AccountSnapshot> MarketDataManager::fetch_current_snapshots_from_bars(const std::vector<Bar>& bars_data) {
+std::pair<MarketSnapshot, AccountSnapshot> MarketDataManager::fetch_current_snapshots_from_series(const BarSeries& bar_series, MultiTimeframeInputs& multi_timeframe_inputs_output) {
     MarketSnapshot market_snapshot;
     AccountSnapshot account_snapshot;
 
-    if (!bars_data.empty()) {
-        market_snapshot = market_bars_manager.create_market_snapshot_from_bars(bars_data);
+    if (!bar_series.empty()) {
+        market_snapshot = market_bars_manager.create_market_snapshot_from_series(config.strategy.symbol, bar_series, 0, multi_timeframe_inputs_output);
     }
 
     // Create account snapshot
@@ -4,6 +4,8 @@
 #include "configs/system_config.hpp"
 #include "trader/data_structures/data_structures.hpp"
 #include "trader/data_structures/data_sync_structures.hpp"
+#include "trader/data_structures/bar_series.hpp"
+#include "trader/data_structures/market_data_result.hpp"
 #include "trader/account_management/account_manager.hpp"
 #include "api/general/api_manager.hpp"
 #include "market_data_fetcher.hpp"
@@ -24,9 +26,11 @@ public:
     MarketDataManager(const SystemConfig& config, API::ApiManager& api_manager, AccountManager& account_manager);
 
     // Market data fetching methods
-    std::pair<ProcessedData, std::vector<Bar>> fetch_and_process_market_data();
+    // Fills bar_series_output (reusing its capacity) with the bars the returned data was computed from.
+    // Warm-up, stale feeds and unusable snapshots come back as a failed result carrying the bar count.
+    ProcessedDataResult fetch_and_process_market_data(BarSeries& bar_series_output);
     std::pair<MarketSnapshot, AccountSnapshot> fetch_current_snapshots();
-    std::pair<MarketSnapshot, AccountSnapshot> fetch_current_snapshots_from_bars(const std::vector<Bar>& bars_data);
+    std::pair<MarketSnapshot, AccountSnapshot> fetch_current_snapshots_from_series(const BarSeries& bar_series, MultiTimeframeInputs& multi_timeframe_inputs_output);
     QuoteData fetch_real_time_quote_data(const std::string& symbol) const;
     
     // Data synchronization methods (delegated to MarketDataFetcher)
@@ -1,7 +1,6 @@
 #include "market_data_validator.hpp"
+#include "utils/time_utils.hpp"
 #include <cmath>
-#include <sstream>
-#include <iomanip>
 
 namespace AlpacaTrader {
 namespace Core {
@@ -110,23 +109,13 @@ bool MarketDataValidator::validate_position_data(const PositionDetails& position
 }
 
 bool MarketDataValidator::is_quote_data_fresh_and_valid(const QuoteData& quote_data) const {
-    if (quote_data.mid_price <= 0.0 || quote_data.timestamp.empty()) {
+    if (quote_data.mid_price <= 0.0 || quote_data.timestamp_ns <= 0) {
         return false;
     }
     
     try {
-        // Parse timestamp to check freshness
-        std::tm timestamp_parsed = {};
-        std::istringstream timestamp_stream(quote_data.timestamp);
-        timestamp_stream >> std::get_time(&timestamp_parsed, "%Y-%m-%dT%H:%M:%S");
-        
-        if (timestamp_stream.fail()) {
-            return false;
-        }
-        
-        auto quote_timestamp = std::mktime(&timestamp_parsed);
-        auto current_timestamp = std::time(nullptr);
-        auto quote_age_seconds = current_timestamp - quote_timestamp;
+        int64_t current_timestamp_ns = TimeUtils::get_current_epoch_nanoseconds();
+        int64_t quote_age_seconds = (current_timestamp_ns - quote_data.timestamp_ns) / TimeUtils::NANOSECONDS_PER_SECOND;
         
         bool is_quote_fresh = (quote_age_seconds < config.timing.quote_data_freshness_threshold_seconds);
         
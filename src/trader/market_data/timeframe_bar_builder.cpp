@@ -0,0 +1,125 @@
+#include "timeframe_bar_builder.hpp"
+#include "utils/time_utils.hpp"
+#include <algorithm>
+
+namespace AlpacaTrader {
+namespace Core {
+
+namespace {
+
+Bar start_aggregate_bar(const Bar& base_bar, int64_t bucket_start_timestamp_ns) {
+    Bar aggregate_bar = base_bar;
+    aggregate_bar.timestamp_ns = bucket_start_timestamp_ns;
+    return aggregate_bar;
+}
+
+void merge_base_bar(Bar& aggregate_bar, const Bar& base_bar) {
+    aggregate_bar.high_price = std::max(aggregate_bar.high_price, base_bar.high_price);
+    aggregate_bar.low_price = std::min(aggregate_bar.low_price, base_bar.low_price);
+    aggregate_bar.close_price = base_bar.close_price;
+    aggregate_bar.volume += base_bar.volume;
+    aggregate_bar.forward_filled = aggregate_bar.forward_filled && base_bar.forward_filled;
+}
+
+} // anonymous namespace
+
+TimeframeBarBuilder::TimeframeBarBuilder(int timeframe_seconds)
+    : timeframe_seconds_value(timeframe_seconds),
+      timeframe_ns(static_cast<int64_t>(timeframe_seconds > 0 ? timeframe_seconds : 1) * TimeUtils::NANOSECONDS_PER_SECOND),
+      has_consumed_bars(false),
+      last_consumed_timestamp_ns(0),
+      has_open_bucket(false),
+      open_bucket_bar(),
+      has_closed_bar(false),
+      last_closed_bar(),
+      has_forming_bar(false),
+      forming_bar(),
+      new_aggregated_bars() {}
+
+void TimeframeBarBuilder::update_from_series(const BarSeries& base_bar_series) {
+    new_aggregated_bars.clear();
+    if (base_bar_series.empty()) {
+        return;
+    }
+    
+    const int64_t* timestamp_values = base_bar_series.timestamp_data();
+    const size_t newest_bar_index = base_bar_series.size() - 1;
+    
+    if (has_consumed_bars && timestamp_values[newest_bar_index] < last_consumed_timestamp_ns) {
+        reset();
+    }
+    
+    // Everything except the last base bar is closed and can be folded in for good
+    for (size_t bar_index = 0; bar_index < newest_bar_index; ++bar_index) {
+        if (!has_consumed_bars || timestamp_values[bar_index] > last_consumed_timestamp_ns) {
+            fold_closed_base_bar(base_bar_series.bar_at(bar_index));
+        }
+    }
+    
+    has_forming_bar = false;
+    if (!has_consumed_bars || timestamp_values[newest_bar_index] > last_consumed_timestamp_ns) {
+        const Bar forming_base_bar = base_bar_series.latest_bar();
+        int64_t forming_bucket_start = bucket_start_of(forming_base_bar.timestamp_ns);
+        
+        // A forming base bar in a later bucket means the open bucket can no longer change
+        if (has_open_bucket && open_bucket_bar.timestamp_ns != forming_bucket_start) {
+            close_open_bucket();
+        }
+        
+        if (has_open_bucket) {
+            forming_bar = open_bucket_bar;
+            merge_base_bar(forming_bar, forming_base_bar);
+        } else {
+            forming_bar = start_aggregate_bar(forming_base_bar, forming_bucket_start);
+        }
+        has_forming_bar = true;
+    } else if (has_open_bucket) {
+        forming_bar = open_bucket_bar;
+        has_forming_bar = true;
+    }
+    
+    if (has_forming_bar) {
+        new_aggregated_bars.push_back(forming_bar);
+    }
+}
+
+void TimeframeBarBuilder::reset() {
+    has_consumed_bars = false;
+    last_consumed_timestamp_ns = 0;
+    has_open_bucket = false;
+    has_closed_bar = false;
+    has_forming_bar = false;
+    new_aggregated_bars.clear();
+}
+
+int64_t TimeframeBarBuilder::bucket_start_of(int64_t timestamp_ns) const {
+    int64_t bucket_start = (timestamp_ns / timeframe_ns) * timeframe_ns;
+    return bucket_start > timestamp_ns ? bucket_start - timeframe_ns : bucket_start;
+}
+
+void TimeframeBarBuilder::close_open_bucket() {
+    last_closed_bar = open_bucket_bar;
+    has_closed_bar = true;
+    has_open_bucket = false;
+    new_aggregated_bars.push_back(last_closed_bar);
+}
+
+void TimeframeBarBuilder::fold_closed_base_bar(const Bar& base_bar) {
+    int64_t bucket_start = bucket_start_of(base_bar.timestamp_ns);
+    if (has_open_bucket && open_bucket_bar.timestamp_ns != bucket_start) {
+        close_open_bucket();
+    }
+    
+    if (has_open_bucket) {
+        merge_base_bar(open_bucket_bar, base_bar);
+    } else {
+        open_bucket_bar = start_aggregate_bar(base_bar, bucket_start);
+        has_open_bucket = true;
+    }
+    
+    has_consumed_bars = true;
+    last_consumed_timestamp_ns = base_bar.timestamp_ns;
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
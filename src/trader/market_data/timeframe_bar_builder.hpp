@@ -0,0 +1,55 @@
+#ifndef TIMEFRAME_BAR_BUILDER_HPP
+#define TIMEFRAME_BAR_BUILDER_HPP
+
+#include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/bar_series.hpp"
+#include <cstdint>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Rolls base bars up into epoch-aligned bars of a longer timeframe, so confirmation timeframes
+// come from bars already fetched for the base timeframe instead of another request per timeframe.
+// Only base bars newer than the previous update are folded in; the series' last bar is treated as forming.
+class TimeframeBarBuilder {
+public:
+    explicit TimeframeBarBuilder(int timeframe_seconds);
+    
+    void update_from_series(const BarSeries& base_bar_series);
+    void reset();
+    
+    // Aggregated bars closed since the previous update followed by the forming aggregated bar,
+    // ready for IncrementalIndicatorState::update_from_series
+    const BarSeries& get_new_bars() const { return new_aggregated_bars; }
+    
+    int get_timeframe_seconds() const { return timeframe_seconds_value; }
+    bool has_current_bar() const { return has_forming_bar; }
+    bool has_previous_bar() const { return has_closed_bar; }
+    const Bar& get_current_bar() const { return forming_bar; }
+    const Bar& get_previous_bar() const { return last_closed_bar; }
+
+private:
+    int timeframe_seconds_value;
+    int64_t timeframe_ns;
+    
+    bool has_consumed_bars;
+    int64_t last_consumed_timestamp_ns;
+    
+    bool has_open_bucket;
+    Bar open_bucket_bar;
+    bool has_closed_bar;
+    Bar last_closed_bar;
+    bool has_forming_bar;
+    Bar forming_bar;
+    
+    BarSeries new_aggregated_bars;
+    
+    int64_t bucket_start_of(int64_t timestamp_ns) const;
+    void close_open_bucket();
+    void fold_closed_base_bar(const Bar& base_bar);
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // TIMEFRAME_BAR_BUILDER_HPP
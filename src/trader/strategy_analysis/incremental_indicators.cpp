@@ -0,0 +1,396 @@
+#include "incremental_indicators.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace AlpacaTrader {
+namespace Core {
+
+RollingWindowSum::RollingWindowSum(size_t window_capacity)
+    : window_values(window_capacity > 0 ? window_capacity : 1, 0.0),
+      next_write_index(0),
+      stored_count(0),
+      pushes_since_resum(0),
+      running_sum(0.0) {}
+
+void RollingWindowSum::push(double value) {
+    if (stored_count == window_values.size()) {
+        running_sum -= window_values[next_write_index];
+    } else {
+        stored_count++;
+    }
+    window_values[next_write_index] = value;
+    running_sum += value;
+    next_write_index = (next_write_index + 1) % window_values.size();
+
+    if (++pushes_since_resum >= window_values.size()) {
+        running_sum = 0.0;
+        for (size_t value_index = 0; value_index < stored_count; ++value_index) {
+            running_sum += window_values[value_index];
+        }
+        pushes_since_resum = 0;
+    }
+}
+
+void RollingWindowSum::clear() {
+    next_write_index = 0;
+    stored_count = 0;
+    pushes_since_resum = 0;
+    running_sum = 0.0;
+}
+
+double RollingWindowSum::oldest() const {
+    if (stored_count == 0) {
+        return 0.0;
+    }
+    size_t oldest_index = (next_write_index + window_values.size() - stored_count) % window_values.size();
+    return window_values[oldest_index];
+}
+
+namespace {
+
+double true_range_of(const IndicatorBarInput& bar_input) {
+    return std::max({bar_input.high_price - bar_input.low_price,
+                     std::abs(bar_input.high_price - bar_input.previous_close_price),
+                     std::abs(bar_input.low_price - bar_input.previous_close_price)});
+}
+
+const double PERCENT_SCALE_VALUE = 100.0;
+const double NEUTRAL_OSCILLATOR_VALUE = 50.0;
+
+struct WindowExtrema {
+    double highest_value;
+    double lowest_value;
+    uint64_t highest_sequence;
+    uint64_t lowest_sequence;
+};
+
+// Highest high / lowest low over the newest period bars, where a forming bar counts as the newest one.
+// Committed bars carry sequence numbers 0..pushed-1 and the forming bar takes the next one.
+bool window_extrema_with_forming_bar(const RollingMaximum& rolling_highs, const RollingMinimum& rolling_lows, int period_value,
+                                     const IndicatorBarInput* forming_bar, WindowExtrema& window_extrema) {
+    const size_t committed_bars_needed = static_cast<size_t>(period_value) - (forming_bar ? 1 : 0);
+    bool has_highest_value = rolling_highs.extremum_over_newest(committed_bars_needed, window_extrema.highest_value, window_extrema.highest_sequence);
+    bool has_lowest_value = rolling_lows.extremum_over_newest(committed_bars_needed, window_extrema.lowest_value, window_extrema.lowest_sequence);
+
+    if (forming_bar) {
+        const uint64_t forming_sequence = rolling_highs.pushed_count();
+        if (!has_highest_value || forming_bar->high_price >= window_extrema.highest_value) {
+            window_extrema.highest_value = forming_bar->high_price;
+            window_extrema.highest_sequence = forming_sequence;
+        }
+        if (!has_lowest_value || forming_bar->low_price <= window_extrema.lowest_value) {
+            window_extrema.lowest_value = forming_bar->low_price;
+            window_extrema.lowest_sequence = forming_sequence;
+        }
+        return true;
+    }
+
+    return has_highest_value && has_lowest_value;
+}
+
+double bar_spread_of(const IndicatorBarInput& bar_input) {
+    return bar_input.close_price > 0.0 ? (bar_input.high_price - bar_input.low_price) / bar_input.close_price : std::nan("");
+}
+
+double percent_k_of(double close_price, double highest_value, double lowest_value) {
+    double range_value = highest_value - lowest_value;
+    return range_value > 0.0 ? PERCENT_SCALE_VALUE * (close_price - lowest_value) / range_value : NEUTRAL_OSCILLATOR_VALUE;
+}
+
+} // anonymous namespace
+
+AverageTrueRangeStage::AverageTrueRangeStage(int period, int minimum_bars_required)
+    : period_value(period),
+      minimum_bars_required_value(minimum_bars_required),
+      true_range_window(period > 0 ? static_cast<size_t>(period) : 1),
+      committed_true_range_count(0) {}
+
+void AverageTrueRangeStage::reset() {
+    true_range_window.clear();
+    committed_true_range_count = 0;
+}
+
+void AverageTrueRangeStage::commit(const IndicatorBarInput& closed_bar) {
+    // The first bar has no previous close, so it contributes no true range
+    if (closed_bar.has_previous_close) {
+        true_range_window.push(true_range_of(closed_bar));
+        committed_true_range_count++;
+    }
+}
+
+double AverageTrueRangeStage::read(const IndicatorReadContext& context) const {
+    if (static_cast<int>(context.bars_seen) < minimum_bars_required_value) {
+        return 0.0;
+    }
+
+    bool forming_true_range_available = context.forming_bar && context.forming_bar->has_previous_close;
+    size_t total_true_range_count = committed_true_range_count + (forming_true_range_available ? 1 : 0);
+    size_t period_to_use_value = std::min(static_cast<size_t>(period_value), total_true_range_count);
+    if (period_to_use_value == 0) {
+        return 0.0;
+    }
+
+    double true_range_sum = true_range_window.sum();
+    if (forming_true_range_available) {
+        // The forming bar takes the slot of the oldest committed true range once the window is full
+        if (true_range_window.count() == true_range_window.capacity()) {
+            true_range_sum -= true_range_window.oldest();
+        }
+        true_range_sum += true_range_of(*context.forming_bar);
+    }
+
+    return true_range_sum / static_cast<double>(period_to_use_value);
+}
+
+AverageVolumeStage::AverageVolumeStage(int period, double minimum_volume_threshold)
+    : period_value(period),
+      minimum_volume_threshold_value(minimum_volume_threshold),
+      volume_window(period > 0 ? static_cast<size_t>(period) : 1) {}
+
+void AverageVolumeStage::reset() {
+    volume_window.clear();
+}
+
+void AverageVolumeStage::commit(const IndicatorBarInput& closed_bar) {
+    volume_window.push(closed_bar.volume);
+}
+
+double AverageVolumeStage::read(const IndicatorReadContext& context) const {
+    if (static_cast<int>(context.bars_seen) < period_value) {
+        return 0.0;
+    }
+
+    double volume_sum = volume_window.sum();
+    if (context.forming_bar) {
+        if (volume_window.count() == volume_window.capacity()) {
+            volume_sum -= volume_window.oldest();
+        }
+        volume_sum += context.forming_bar->volume;
+    }
+
+    double average_volume_result = volume_sum / static_cast<double>(period_value);
+
+    // If average is 0, use the minimum threshold to avoid division by zero
+    if (average_volume_result == 0.0) {
+        return minimum_volume_threshold_value;
+    }
+
+    return average_volume_result;
+}
+
+DonchianChannelStage::DonchianChannelStage(int period)
+    : period_value(period > 0 ? period : 1),
+      rolling_highs(static_cast<size_t>(period_value)),
+      rolling_lows(static_cast<size_t>(period_value)) {}
+
+void DonchianChannelStage::reset() {
+    rolling_highs.clear();
+    rolling_lows.clear();
+}
+
+void DonchianChannelStage::commit(const IndicatorBarInput& closed_bar) {
+    rolling_highs.push(closed_bar.high_price);
+    rolling_lows.push(closed_bar.low_price);
+}
+
+DonchianChannelReading DonchianChannelStage::read(const IndicatorReadContext& context) const {
+    DonchianChannelReading channel_reading{0.0, 0.0, 0.0};
+    WindowExtrema window_extrema;
+    if (!window_extrema_with_forming_bar(rolling_highs, rolling_lows, period_value, context.forming_bar, window_extrema)) {
+        return channel_reading;
+    }
+
+    channel_reading.upper = window_extrema.highest_value;
+    channel_reading.lower = window_extrema.lowest_value;
+    channel_reading.middle = (window_extrema.highest_value + window_extrema.lowest_value) / 2.0;
+    return channel_reading;
+}
+
+StochasticOscillatorStage::StochasticOscillatorStage(int k_period, int d_period)
+    : k_period_value(k_period > 0 ? k_period : 1),
+      rolling_highs(static_cast<size_t>(k_period_value)),
+      rolling_lows(static_cast<size_t>(k_period_value)),
+      percent_k_window(d_period > 0 ? static_cast<size_t>(d_period) : 1),
+      last_committed_percent_k(NEUTRAL_OSCILLATOR_VALUE) {}
+
+void StochasticOscillatorStage::reset() {
+    rolling_highs.clear();
+    rolling_lows.clear();
+    percent_k_window.clear();
+    last_committed_percent_k = NEUTRAL_OSCILLATOR_VALUE;
+}
+
+void StochasticOscillatorStage::commit(const IndicatorBarInput& closed_bar) {
+    rolling_highs.push(closed_bar.high_price);
+    rolling_lows.push(closed_bar.low_price);
+
+    WindowExtrema window_extrema;
+    window_extrema_with_forming_bar(rolling_highs, rolling_lows, k_period_value, nullptr, window_extrema);
+    last_committed_percent_k = percent_k_of(closed_bar.close_price, window_extrema.highest_value, window_extrema.lowest_value);
+    percent_k_window.push(last_committed_percent_k);
+}
+
+StochasticReading StochasticOscillatorStage::read(const IndicatorReadContext& context) const {
+    StochasticReading stochastic_reading{0.0, 0.0};
+    WindowExtrema window_extrema;
+    if (!window_extrema_with_forming_bar(rolling_highs, rolling_lows, k_period_value, context.forming_bar, window_extrema)) {
+        return stochastic_reading;
+    }
+
+    if (!context.forming_bar) {
+        stochastic_reading.percent_k = last_committed_percent_k;
+        stochastic_reading.percent_d = percent_k_window.sum() / static_cast<double>(percent_k_window.count());
+        return stochastic_reading;
+    }
+
+    stochastic_reading.percent_k = percent_k_of(context.forming_bar->close_price, window_extrema.highest_value, window_extrema.lowest_value);
+
+    // %D averages the forming %K with up to d_period - 1 committed ones
+    double percent_k_sum = percent_k_window.sum();
+    size_t committed_percent_k_count = percent_k_window.count();
+    if (committed_percent_k_count == percent_k_window.capacity()) {
+        percent_k_sum -= percent_k_window.oldest();
+        committed_percent_k_count--;
+    }
+    stochastic_reading.percent_d = (percent_k_sum + stochastic_reading.percent_k) / static_cast<double>(committed_percent_k_count + 1);
+    return stochastic_reading;
+}
+
+SwingPointStage::SwingPointStage(int lookback_period)
+    : lookback_period_value(lookback_period > 0 ? lookback_period : 1),
+      rolling_highs(static_cast<size_t>(lookback_period_value)),
+      rolling_lows(static_cast<size_t>(lookback_period_value)) {}
+
+void SwingPointStage::reset() {
+    rolling_highs.clear();
+    rolling_lows.clear();
+}
+
+void SwingPointStage::commit(const IndicatorBarInput& closed_bar) {
+    rolling_highs.push(closed_bar.high_price);
+    rolling_lows.push(closed_bar.low_price);
+}
+
+SwingPointReading SwingPointStage::read(const IndicatorReadContext& context) const {
+    SwingPointReading swing_reading{0.0, 0.0, 0, 0, false};
+    WindowExtrema window_extrema;
+    if (!window_extrema_with_forming_bar(rolling_highs, rolling_lows, lookback_period_value, context.forming_bar, window_extrema)) {
+        return swing_reading;
+    }
+
+    const uint64_t newest_sequence = context.forming_bar ? rolling_highs.pushed_count() : rolling_highs.pushed_count() - 1;
+    swing_reading.swing_high = window_extrema.highest_value;
+    swing_reading.swing_low = window_extrema.lowest_value;
+    swing_reading.bars_since_swing_high = static_cast<size_t>(newest_sequence - window_extrema.highest_sequence);
+    swing_reading.bars_since_swing_low = static_cast<size_t>(newest_sequence - window_extrema.lowest_sequence);
+    swing_reading.is_upswing = window_extrema.highest_sequence > window_extrema.lowest_sequence;
+    return swing_reading;
+}
+
+RollingPercentileStage::RollingPercentileStage(int atr_period, int window_length)
+    : atr_tracker(atr_period, 1),
+      committed_bars_count(0),
+      last_committed_volume(0.0),
+      last_committed_spread(0.0),
+      atr_samples(window_length > 0 ? static_cast<size_t>(window_length) : 1),
+      volume_samples(window_length > 0 ? static_cast<size_t>(window_length) : 1),
+      spread_samples(window_length > 0 ? static_cast<size_t>(window_length) : 1) {}
+
+void RollingPercentileStage::reset() {
+    atr_tracker.reset();
+    committed_bars_count = 0;
+    last_committed_volume = 0.0;
+    last_committed_spread = 0.0;
+    atr_samples.clear();
+    volume_samples.clear();
+    spread_samples.clear();
+}
+
+void RollingPercentileStage::commit(const IndicatorBarInput& closed_bar) {
+    atr_tracker.commit(closed_bar);
+    committed_bars_count++;
+
+    // ATR as of this closed bar; the first bar has no true range yet
+    if (closed_bar.has_previous_close) {
+        IndicatorReadContext committed_context{nullptr, committed_bars_count};
+        atr_samples.push(atr_tracker.read(committed_context));
+    }
+
+    last_committed_volume = closed_bar.volume;
+    last_committed_spread = bar_spread_of(closed_bar);
+    volume_samples.push(last_committed_volume);
+    spread_samples.push(last_committed_spread);
+}
+
+RollingPercentileReading RollingPercentileStage::read(const IndicatorReadContext& context) const {
+    RollingPercentileReading percentile_reading;
+    percentile_reading.atr_percentile = atr_samples.percentile_rank(atr_tracker.read(context));
+    percentile_reading.volume_percentile = volume_samples.percentile_rank(context.forming_bar ? context.forming_bar->volume : last_committed_volume);
+    percentile_reading.spread_percentile = spread_samples.percentile_rank(context.forming_bar ? bar_spread_of(*context.forming_bar) : last_committed_spread);
+    percentile_reading.sample_count = atr_samples.size();
+    return percentile_reading;
+}
+
+IncrementalIndicatorState::IncrementalIndicatorState(const IncrementalIndicatorParameters& indicator_parameters)
+    : indicator_pipeline(AverageTrueRangeStage(indicator_parameters.atr_period, indicator_parameters.minimum_bars_required),
+                         AverageTrueRangeStage(indicator_parameters.average_atr_period, indicator_parameters.minimum_bars_required),
+                         AverageVolumeStage(indicator_parameters.volume_period, indicator_parameters.minimum_volume_threshold),
+                         DonchianChannelStage(indicator_parameters.donchian_period),
+                         StochasticOscillatorStage(indicator_parameters.stochastic_k_period, indicator_parameters.stochastic_d_period),
+                         SwingPointStage(indicator_parameters.swing_lookback_period),
+                         RollingPercentileStage(indicator_parameters.atr_period, indicator_parameters.percentile_window_length),
+                         VolatilityRegimeStage(indicator_parameters.volatility_regime_settings, indicator_parameters.garch_refit_slot)) {
+    if (indicator_parameters.atr_period <= 0 || indicator_parameters.average_atr_period <= 0 || indicator_parameters.volume_period <= 0 ||
+        indicator_parameters.donchian_period <= 0 || indicator_parameters.stochastic_k_period <= 0 ||
+        indicator_parameters.stochastic_d_period <= 0 || indicator_parameters.swing_lookback_period <= 0 ||
+        indicator_parameters.percentile_window_length <= 0 || indicator_parameters.volatility_regime_settings.refit_window_length <= 0) {
+        throw std::runtime_error("Indicator periods must be greater than 0");
+    }
+}
+void IncrementalIndicatorState::update_from_series(const BarSeries& bar_series) {
+    indicator_pipeline.update_from_series(bar_series);
+}
+
+void IncrementalIndicatorState::reset() {
+    indicator_pipeline.reset();
+}
+
+double IncrementalIndicatorState::get_atr() const {
+    return indicator_pipeline.read<ATR_STAGE_INDEX>();
+}
+
+double IncrementalIndicatorState::get_average_atr() const {
+    return indicator_pipeline.read<AVERAGE_ATR_STAGE_INDEX>();
+}
+
+double IncrementalIndicatorState::get_average_volume() const {
+    return indicator_pipeline.read<AVERAGE_VOLUME_STAGE_INDEX>();
+}
+
+DonchianChannelReading IncrementalIndicatorState::get_donchian_channel() const {
+    return indicator_pipeline.read<DONCHIAN_STAGE_INDEX>();
+}
+
+StochasticReading IncrementalIndicatorState::get_stochastic() const {
+    return indicator_pipeline.read<STOCHASTIC_STAGE_INDEX>();
+}
+
+SwingPointReading IncrementalIndicatorState::get_swing_points() const {
+    return indicator_pipeline.read<SWING_STAGE_INDEX>();
+}
+
+RollingPercentileReading IncrementalIndicatorState::get_rolling_percentiles() const {
+    return indicator_pipeline.read<PERCENTILE_STAGE_INDEX>();
+}
+
+VolatilityRegimeReading IncrementalIndicatorState::get_volatility_regime() const {
+    return indicator_pipeline.read<VOLATILITY_REGIME_STAGE_INDEX>();
+}
+
+size_t IncrementalIndicatorState::get_bars_seen() const {
+    return indicator_pipeline.get_bars_seen();
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
@@ -0,0 +1,230 @@
+#ifndef INCREMENTAL_INDICATORS_HPP
+#define INCREMENTAL_INDICATORS_HPP
+
+#include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/bar_series.hpp"
+#include "trader/strategy_analysis/indicator_pipeline.hpp"
+#include "trader/strategy_analysis/rolling_extrema.hpp"
+#include "trader/strategy_analysis/rolling_quantiles.hpp"
+#include "trader/strategy_analysis/volatility_model.hpp"
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Fixed-capacity window of the newest values with a running sum.
+// The sum is rebuilt from the stored values once per capacity pushes to bound floating-point drift.
+class RollingWindowSum {
+public:
+    explicit RollingWindowSum(size_t window_capacity);
+
+    void push(double value);
+    void clear();
+
+    double sum() const { return running_sum; }
+    double oldest() const;
+    size_t count() const { return stored_count; }
+    size_t capacity() const { return window_values.size(); }
+
+private:
+    std::vector<double> window_values;
+    size_t next_write_index;
+    size_t stored_count;
+    size_t pushes_since_resum;
+    double running_sum;
+};
+
+// Pipeline stage: mean true range over the newest period bars (ATR, or the longer average-ATR baseline)
+class AverageTrueRangeStage {
+public:
+    AverageTrueRangeStage(int period, int minimum_bars_required);
+
+    void reset();
+    void commit(const IndicatorBarInput& closed_bar);
+    double read(const IndicatorReadContext& context) const;
+
+private:
+    int period_value;
+    int minimum_bars_required_value;
+    RollingWindowSum true_range_window;
+    size_t committed_true_range_count;
+};
+
+// Pipeline stage: mean volume over the newest period bars, floored to a minimum when it averages to zero
+class AverageVolumeStage {
+public:
+    AverageVolumeStage(int period, double minimum_volume_threshold);
+
+    void reset();
+    void commit(const IndicatorBarInput& closed_bar);
+    double read(const IndicatorReadContext& context) const;
+
+private:
+    int period_value;
+    double minimum_volume_threshold_value;
+    RollingWindowSum volume_window;
+};
+
+struct DonchianChannelReading {
+    double upper;
+    double middle;
+    double lower;
+};
+
+struct StochasticReading {
+    double percent_k;
+    double percent_d;
+};
+
+// Highest high and lowest low over the swing lookback, with how long ago each printed.
+// An upswing means the low came first, so retracements are measured down from the high.
+struct SwingPointReading {
+    double swing_high;
+    double swing_low;
+    size_t bars_since_swing_high;
+    size_t bars_since_swing_low;
+    bool is_upswing;
+};
+
+// Pipeline stage: Donchian channel (highest high / lowest low over the newest period bars)
+class DonchianChannelStage {
+public:
+    explicit DonchianChannelStage(int period);
+
+    void reset();
+    void commit(const IndicatorBarInput& closed_bar);
+    DonchianChannelReading read(const IndicatorReadContext& context) const;
+
+private:
+    int period_value;
+    RollingMaximum rolling_highs;
+    RollingMinimum rolling_lows;
+};
+
+// Pipeline stage: stochastic oscillator %K over k_period bars and its d_period simple average %D
+class StochasticOscillatorStage {
+public:
+    StochasticOscillatorStage(int k_period, int d_period);
+
+    void reset();
+    void commit(const IndicatorBarInput& closed_bar);
+    StochasticReading read(const IndicatorReadContext& context) const;
+
+private:
+    int k_period_value;
+    RollingMaximum rolling_highs;
+    RollingMinimum rolling_lows;
+    RollingWindowSum percent_k_window;
+    double last_committed_percent_k;
+};
+
+// Pipeline stage: swing high/low over a long lookback for Fibonacci retracements.
+// The deques keep a 1,000+ bar lookback as cheap per bar as a short one.
+class SwingPointStage {
+public:
+    explicit SwingPointStage(int lookback_period);
+
+    void reset();
+    void commit(const IndicatorBarInput& closed_bar);
+    SwingPointReading read(const IndicatorReadContext& context) const;
+
+private:
+    int lookback_period_value;
+    RollingMaximum rolling_highs;
+    RollingMinimum rolling_lows;
+};
+
+// Where the current ATR, volume and bar spread ((high - low) / close) sit within their own
+// rolling distributions, as mid-rank percentiles in [0, 1]
+struct RollingPercentileReading {
+    double atr_percentile;
+    double volume_percentile;
+    double spread_percentile;
+    size_t sample_count;
+};
+
+// Pipeline stage: one ATR, volume and spread sample per closed bar into rolling quantile windows,
+// so filters can rank the current values without re-sorting history every cycle
+class RollingPercentileStage {
+public:
+    RollingPercentileStage(int atr_period, int window_length);
+
+    void reset();
+    void commit(const IndicatorBarInput& closed_bar);
+    RollingPercentileReading read(const IndicatorReadContext& context) const;
+
+private:
+    AverageTrueRangeStage atr_tracker;
+    size_t committed_bars_count;
+    double last_committed_volume;
+    double last_committed_spread;
+    RollingQuantileWindow atr_samples;
+    RollingQuantileWindow volume_samples;
+    RollingQuantileWindow spread_samples;
+};
+
+struct IncrementalIndicatorParameters {
+    int atr_period;
+    int average_atr_period;
+    int volume_period;
+    int minimum_bars_required;
+    double minimum_volume_threshold;
+    int donchian_period;
+    int stochastic_k_period;
+    int stochastic_d_period;
+    int swing_lookback_period;
+    int percentile_window_length;
+    VolatilityRegimeSettings volatility_regime_settings;
+    std::shared_ptr<GarchRefitSlot> garch_refit_slot;   // nullptr keeps the default GARCH parameters
+};
+
+// Streaming indicator state for one symbol and timeframe (ATR, average ATR, average volume,
+// Donchian channel, stochastic, swing points, rolling percentiles and volatility regime).
+// Closed bars are committed once in O(1); the newest (forming) bar only contributes at read time,
+// so repeated updates with the same history cost nothing beyond replacing that bar.
+// New indicators are added as another stage of the fused pipeline rather than another pass.
+class IncrementalIndicatorState {
+public:
+    explicit IncrementalIndicatorState(const IncrementalIndicatorParameters& indicator_parameters);
+
+    // Accepts a time-ordered bar series whose last element is the forming bar.
+    // Bars newer than the last committed one are folded in; a rewound series resets the state.
+    void update_from_series(const BarSeries& bar_series);
+    void reset();
+
+    double get_atr() const;
+    double get_average_atr() const;
+    double get_average_volume() const;
+    DonchianChannelReading get_donchian_channel() const;
+    StochasticReading get_stochastic() const;
+    SwingPointReading get_swing_points() const;
+    RollingPercentileReading get_rolling_percentiles() const;
+    VolatilityRegimeReading get_volatility_regime() const;
+    size_t get_bars_seen() const;
+
+private:
+    enum PipelineStageIndex : size_t {
+        ATR_STAGE_INDEX = 0,
+        AVERAGE_ATR_STAGE_INDEX = 1,
+        AVERAGE_VOLUME_STAGE_INDEX = 2,
+        DONCHIAN_STAGE_INDEX = 3,
+        STOCHASTIC_STAGE_INDEX = 4,
+        SWING_STAGE_INDEX = 5,
+        PERCENTILE_STAGE_INDEX = 6,
+        VOLATILITY_REGIME_STAGE_INDEX = 7
+    };
+
+    using CoreIndicatorPipeline = FusedIndicatorPipeline<AverageTrueRangeStage, AverageTrueRangeStage, AverageVolumeStage,
+                                                         DonchianChannelStage, StochasticOscillatorStage, SwingPointStage,
+                                                         RollingPercentileStage, VolatilityRegimeStage>;
+
+    CoreIndicatorPipeline indicator_pipeline;
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // INCREMENTAL_INDICATORS_HPP
@@ -0,0 +1,685 @@
+#include "indicator_kernels.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define INDICATOR_KERNELS_HAVE_AVX2 1
+#include <immintrin.h>
+#define INDICATOR_KERNELS_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define INDICATOR_KERNELS_HAVE_AVX2 0
+#endif
+
+namespace AlpacaTrader {
+namespace Core {
+
+namespace {
+
+const double NOT_AVAILABLE_VALUE = std::numeric_limits<double>::quiet_NaN();
+const double PERCENT_SCALE_VALUE = 100.0;
+const double NEUTRAL_OSCILLATOR_VALUE = 50.0;
+
+// Stages that benefit from SIMD; the recursive smoothing stays in the shared driver code
+struct IndicatorKernelTable {
+    IndicatorKernelBackend backend;
+    // gains/losses[i] from close[i] - close[i-1] for i in [1, count)
+    void (*split_gains_losses)(const double* close_values, size_t values_count, double* gain_output, double* loss_output);
+    // 100 * gain / (gain + loss), or neutral when both are zero
+    void (*rsi_from_averages)(const double* average_gain_values, const double* average_loss_values, size_t values_count, double* rsi_output);
+    void (*subtract_columns)(const double* minuend_values, const double* subtrahend_values, size_t values_count, double* difference_output);
+    // Windowed outputs are written for i in [period - 1, count)
+    void (*window_bands)(const double* input_values, size_t values_count, int period, double standard_deviations,
+                         double* middle_output, double* upper_output, double* lower_output);
+    void (*window_mean)(const double* input_values, size_t values_count, int period, double* mean_output);
+    void (*window_extrema)(const double* high_values, const double* low_values, size_t values_count, int period,
+                           double* highest_output, double* lowest_output);
+    void (*stochastic_from_extrema)(const double* close_values, const double* highest_values, const double* lowest_values,
+                                    size_t values_count, double* k_output);
+};
+
+// ---- Scalar fallback ----
+
+inline void window_band_at(const double* input_values, size_t value_index, int period, double standard_deviations,
+                           double* middle_output, double* upper_output, double* lower_output) {
+    double window_sum = 0.0;
+    for (int lag_index = 0; lag_index < period; ++lag_index) {
+        window_sum += input_values[value_index - lag_index];
+    }
+    double window_mean_value = window_sum / period;
+    
+    // Second pass over the window avoids the cancellation of a running sum of squares
+    double squared_deviation_sum = 0.0;
+    for (int lag_index = 0; lag_index < period; ++lag_index) {
+        double deviation_value = input_values[value_index - lag_index] - window_mean_value;
+        squared_deviation_sum += deviation_value * deviation_value;
+    }
+    double band_width_value = standard_deviations * std::sqrt(squared_deviation_sum / period);
+    
+    middle_output[value_index] = window_mean_value;
+    upper_output[value_index] = window_mean_value + band_width_value;
+    lower_output[value_index] = window_mean_value - band_width_value;
+}
+
+inline void window_mean_at(const double* input_values, size_t value_index, int period, double* mean_output) {
+    double window_sum = 0.0;
+    for (int lag_index = 0; lag_index < period; ++lag_index) {
+        window_sum += input_values[value_index - lag_index];
+    }
+    mean_output[value_index] = window_sum / period;
+}
+
+inline void window_extrema_at(const double* high_values, const double* low_values, size_t value_index, int period,
+                              double* highest_output, double* lowest_output) {
+    double highest_value = high_values[value_index];
+    double lowest_value = low_values[value_index];
+    for (int lag_index = 1; lag_index < period; ++lag_index) {
+        highest_value = std::max(highest_value, high_values[value_index - lag_index]);
+        lowest_value = std::min(lowest_value, low_values[value_index - lag_index]);
+    }
+    highest_output[value_index] = highest_value;
+    lowest_output[value_index] = lowest_value;
+}
+
+inline double rsi_from_average_pair(double average_gain_value, double average_loss_value) {
+    double movement_total_value = average_gain_value + average_loss_value;
+    return movement_total_value > 0.0 ? PERCENT_SCALE_VALUE * average_gain_value / movement_total_value : NEUTRAL_OSCILLATOR_VALUE;
+}
+
+inline double stochastic_from_extrema_at(double close_value, double highest_value, double lowest_value) {
+    double range_value = highest_value - lowest_value;
+    return range_value > 0.0 ? PERCENT_SCALE_VALUE * (close_value - lowest_value) / range_value : NEUTRAL_OSCILLATOR_VALUE;
+}
+
+void split_gains_losses_scalar(const double* close_values, size_t values_count, double* gain_output, double* loss_output) {
+    for (size_t value_index = 1; value_index < values_count; ++value_index) {
+        double change_value = close_values[value_index] - close_values[value_index - 1];
+        gain_output[value_index] = std::max(change_value, 0.0);
+        loss_output[value_index] = std::max(0.0 - change_value, 0.0);
+    }
+}
+
+void rsi_from_averages_scalar(const double* average_gain_values, const double* average_loss_values, size_t values_count, double* rsi_output) {
+    for (size_t value_index = 0; value_index < values_count; ++value_index) {
+        rsi_output[value_index] = rsi_from_average_pair(average_gain_values[value_index], average_loss_values[value_index]);
+    }
+}
+
+void subtract_columns_scalar(const double* minuend_values, const double* subtrahend_values, size_t values_count, double* difference_output) {
+    for (size_t value_index = 0; value_index < values_count; ++value_index) {
+        difference_output[value_index] = minuend_values[value_index] - subtrahend_values[value_index];
+    }
+}
+
+void window_bands_scalar(const double* input_values, size_t values_count, int period, double standard_deviations,
+                         double* middle_output, double* upper_output, double* lower_output) {
+    for (size_t value_index = static_cast<size_t>(period) - 1; value_index < values_count; ++value_index) {
+        window_band_at(input_values, value_index, period, standard_deviations, middle_output, upper_output, lower_output);
+    }
+}
+
+void window_mean_scalar(const double* input_values, size_t values_count, int period, double* mean_output) {
+    for (size_t value_index = static_cast<size_t>(period) - 1; value_index < values_count; ++value_index) {
+        window_mean_at(input_values, value_index, period, mean_output);
+    }
+}
+
+void window_extrema_scalar(const double* high_values, const double* low_values, size_t values_count, int period,
+                           double* highest_output, double* lowest_output) {
+    for (size_t value_index = static_cast<size_t>(period) - 1; value_index < values_count; ++value_index) {
+        window_extrema_at(high_values, low_values, value_index, period, highest_output, lowest_output);
+    }
+}
+
+void stochastic_from_extrema_scalar(const double* close_values, const double* highest_values, const double* lowest_values,
+                                    size_t values_count, double* k_output) {
+    for (size_t value_index = 0; value_index < values_count; ++value_index) {
+        k_output[value_index] = stochastic_from_extrema_at(close_values[value_index], highest_values[value_index], lowest_values[value_index]);
+    }
+}
+
+const IndicatorKernelTable scalarKernelTable = {
+    IndicatorKernelBackend::SCALAR,
+    split_gains_losses_scalar,
+    rsi_from_averages_scalar,
+    subtract_columns_scalar,
+    window_bands_scalar,
+    window_mean_scalar,
+    window_extrema_scalar,
+    stochastic_from_extrema_scalar
+};
+
+#if INDICATOR_KERNELS_HAVE_AVX2
+
+// ---- AVX2: four consecutive outputs per iteration, scalar helpers for the tail ----
+
+const size_t AVX2_DOUBLE_LANES = 4;
+
+INDICATOR_KERNELS_TARGET_AVX2
+void split_gains_losses_avx2(const double* close_values, size_t values_count, double* gain_output, double* loss_output) {
+    const __m256d zero_vector = _mm256_setzero_pd();
+    size_t value_index = 1;
+    for (; value_index + AVX2_DOUBLE_LANES <= values_count; value_index += AVX2_DOUBLE_LANES) {
+        __m256d change_vector = _mm256_sub_pd(_mm256_loadu_pd(close_values + value_index), _mm256_loadu_pd(close_values + value_index - 1));
+        _mm256_storeu_pd(gain_output + value_index, _mm256_max_pd(change_vector, zero_vector));
+        _mm256_storeu_pd(loss_output + value_index, _mm256_max_pd(_mm256_sub_pd(zero_vector, change_vector), zero_vector));
+    }
+    for (; value_index < values_count; ++value_index) {
+        double change_value = close_values[value_index] - close_values[value_index - 1];
+        gain_output[value_index] = std::max(change_value, 0.0);
+        loss_output[value_index] = std::max(0.0 - change_value, 0.0);
+    }
+}
+
+INDICATOR_KERNELS_TARGET_AVX2
+void rsi_from_averages_avx2(const double* average_gain_values, const double* average_loss_values, size_t values_count, double* rsi_output) {
+    const __m256d zero_vector = _mm256_setzero_pd();
+    const __m256d scale_vector = _mm256_set1_pd(PERCENT_SCALE_VALUE);
+    const __m256d neutral_vector = _mm256_set1_pd(NEUTRAL_OSCILLATOR_VALUE);
+    size_t value_index = 0;
+    for (; value_index + AVX2_DOUBLE_LANES <= values_count; value_index += AVX2_DOUBLE_LANES) {
+        __m256d gain_vector = _mm256_loadu_pd(average_gain_values + value_index);
+        __m256d total_vector = _mm256_add_pd(gain_vector, _mm256_loadu_pd(average_loss_values + value_index));
+        __m256d rsi_vector = _mm256_div_pd(_mm256_mul_pd(scale_vector, gain_vector), total_vector);
+        __m256d has_movement_mask = _mm256_cmp_pd(total_vector, zero_vector, _CMP_GT_OQ);
+        _mm256_storeu_pd(rsi_output + value_index, _mm256_blendv_pd(neutral_vector, rsi_vector, has_movement_mask));
+    }
+    for (; value_index < values_count; ++value_index) {
+        rsi_output[value_index] = rsi_from_average_pair(average_gain_values[value_index], average_loss_values[value_index]);
+    }
+}
+
+INDICATOR_KERNELS_TARGET_AVX2
+void subtract_columns_avx2(const double* minuend_values, const double* subtrahend_values, size_t values_count, double* difference_output) {
+    size_t value_index = 0;
+    for (; value_index + AVX2_DOUBLE_LANES <= values_count; value_index += AVX2_DOUBLE_LANES) {
+        _mm256_storeu_pd(difference_output + value_index,
+                         _mm256_sub_pd(_mm256_loadu_pd(minuend_values + value_index), _mm256_loadu_pd(subtrahend_values + value_index)));
+    }
+    for (; value_index < values_count; ++value_index) {
+        difference_output[value_index] = minuend_values[value_index] - subtrahend_values[value_index];
+    }
+}
+
+INDICATOR_KERNELS_TARGET_AVX2
+void window_bands_avx2(const double* input_values, size_t values_count, int period, double standard_deviations,
+                       double* middle_output, double* upper_output, double* lower_output) {
+    const __m256d period_vector = _mm256_set1_pd(static_cast<double>(period));
+    const __m256d multiplier_vector = _mm256_set1_pd(standard_deviations);
+    size_t value_index = static_cast<size_t>(period) - 1;
+    for (; value_index + AVX2_DOUBLE_LANES <= values_count; value_index += AVX2_DOUBLE_LANES) {
+        __m256d window_sum_vector = _mm256_setzero_pd();
+        for (int lag_index = 0; lag_index < period; ++lag_index) {
+            window_sum_vector = _mm256_add_pd(window_sum_vector, _mm256_loadu_pd(input_values + value_index - lag_index));
+        }
+        __m256d window_mean_vector = _mm256_div_pd(window_sum_vector, period_vector);
+        
+        __m256d squared_deviation_vector = _mm256_setzero_pd();
+        for (int lag_index = 0; lag_index < period; ++lag_index) {
+            __m256d deviation_vector = _mm256_sub_pd(_mm256_loadu_pd(input_values + value_index - lag_index), window_mean_vector);
+            squared_deviation_vector = _mm256_add_pd(squared_deviation_vector, _mm256_mul_pd(deviation_vector, deviation_vector));
+        }
+        __m256d band_width_vector = _mm256_mul_pd(multiplier_vector, _mm256_sqrt_pd(_mm256_div_pd(squared_deviation_vector, period_vector)));
+        
+        _mm256_storeu_pd(middle_output + value_index, window_mean_vector);
+        _mm256_storeu_pd(upper_output + value_index, _mm256_add_pd(window_mean_vector, band_width_vector));
+        _mm256_storeu_pd(lower_output + value_index, _mm256_sub_pd(window_mean_vector, band_width_vector));
+    }
+    for (; value_index < values_count; ++value_index) {
+        window_band_at(input_values, value_index, period, standard_deviations, middle_output, upper_output, lower_output);
+    }
+}
+
+INDICATOR_KERNELS_TARGET_AVX2
+void window_mean_avx2(const double* input_values, size_t values_count, int period, double* mean_output) {
+    const __m256d period_vector = _mm256_set1_pd(static_cast<double>(period));
+    size_t value_index = static_cast<size_t>(period) - 1;
+    for (; value_index + AVX2_DOUBLE_LANES <= values_count; value_index += AVX2_DOUBLE_LANES) {
+        __m256d window_sum_vector = _mm256_setzero_pd();
+        for (int lag_index = 0; lag_index < period; ++lag_index) {
+            window_sum_vector = _mm256_add_pd(window_sum_vector, _mm256_loadu_pd(input_values + value_index - lag_index));
+        }
+        _mm256_storeu_pd(mean_output + value_index, _mm256_div_pd(window_sum_vector, period_vector));
+    }
+    for (; value_index < values_count; ++value_index) {
+        window_mean_at(input_values, value_index, period, mean_output);
+    }
+}
+
+INDICATOR_KERNELS_TARGET_AVX2
+void window_extrema_avx2(const double* high_values, const double* low_values, size_t values_count, int period,
+                         double* highest_output, double* lowest_output) {
+    size_t value_index = static_cast<size_t>(period) - 1;
+    for (; value_index + AVX2_DOUBLE_LANES <= values_count; value_index += AVX2_DOUBLE_LANES) {
+        __m256d highest_vector = _mm256_loadu_pd(high_values + value_index);
+        __m256d lowest_vector = _mm256_loadu_pd(low_values + value_index);
+        for (int lag_index = 1; lag_index < period; ++lag_index) {
+            highest_vector = _mm256_max_pd(highest_vector, _mm256_loadu_pd(high_values + value_index - lag_index));
+            lowest_vector = _mm256_min_pd(lowest_vector, _mm256_loadu_pd(low_values + value_index - lag_index));
+        }
+        _mm256_storeu_pd(highest_output + value_index, highest_vector);
+        _mm256_storeu_pd(lowest_output + value_index, lowest_vector);
+    }
+    for (; value_index < values_count; ++value_index) {
+        window_extrema_at(high_values, low_values, value_index, period, highest_output, lowest_output);
+    }
+}
+
+INDICATOR_KERNELS_TARGET_AVX2
+void stochastic_from_extrema_avx2(const double* close_values, const double* highest_values, const double* lowest_values,
+                                  size_t values_count, double* k_output) {
+    const __m256d zero_vector = _mm256_setzero_pd();
+    const __m256d scale_vector = _mm256_set1_pd(PERCENT_SCALE_VALUE);
+    const __m256d neutral_vector = _mm256_set1_pd(NEUTRAL_OSCILLATOR_VALUE);
+    size_t value_index = 0;
+    for (; value_index + AVX2_DOUBLE_LANES <= values_count; value_index += AVX2_DOUBLE_LANES) {
+        __m256d lowest_vector = _mm256_loadu_pd(lowest_values + value_index);
+        __m256d range_vector = _mm256_sub_pd(_mm256_loadu_pd(highest_values + value_index), lowest_vector);
+        __m256d position_vector = _mm256_mul_pd(scale_vector, _mm256_sub_pd(_mm256_loadu_pd(close_values + value_index), lowest_vector));
+        __m256d k_vector = _mm256_div_pd(position_vector, range_vector);
+        __m256d has_range_mask = _mm256_cmp_pd(range_vector, zero_vector, _CMP_GT_OQ);
+        _mm256_storeu_pd(k_output + value_index, _mm256_blendv_pd(neutral_vector, k_vector, has_range_mask));
+    }
+    for (; value_index < values_count; ++value_index) {
+        k_output[value_index] = stochastic_from_extrema_at(close_values[value_index], highest_values[value_index], lowest_values[value_index]);
+    }
+}
+
+const IndicatorKernelTable avx2KernelTable = {
+    IndicatorKernelBackend::AVX2,
+    split_gains_losses_avx2,
+    rsi_from_averages_avx2,
+    subtract_columns_avx2,
+    window_bands_avx2,
+    window_mean_avx2,
+    window_extrema_avx2,
+    stochastic_from_extrema_avx2
+};
+
+#endif // INDICATOR_KERNELS_HAVE_AVX2
+
+bool cpu_supports_avx2() {
+#if INDICATOR_KERNELS_HAVE_AVX2
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+const IndicatorKernelTable* detect_best_kernel_table() {
+#if INDICATOR_KERNELS_HAVE_AVX2
+    if (cpu_supports_avx2()) {
+        return &avx2KernelTable;
+    }
+#endif
+    return &scalarKernelTable;
+}
+
+std::atomic<const IndicatorKernelTable*>& active_kernel_table() {
+    static std::atomic<const IndicatorKernelTable*> activeKernelTablePointer(detect_best_kernel_table());
+    return activeKernelTablePointer;
+}
+
+const IndicatorKernelTable& kernels() {
+    return *active_kernel_table().load(std::memory_order_relaxed);
+}
+
+void fill_not_available(double* output_values, size_t values_count) {
+    std::fill(output_values, output_values + values_count, NOT_AVAILABLE_VALUE);
+}
+
+void validate_period(int period_value, const char* period_name) {
+    if (period_value <= 0) {
+        throw std::runtime_error(std::string("Indicator kernel period must be greater than 0: ") + period_name);
+    }
+}
+
+// ---- Backend verification ----
+
+struct NamedIndicatorColumn {
+    const char* column_name;
+    BarSeries::PriceColumn IndicatorSeriesColumns::* column;
+};
+
+const NamedIndicatorColumn VERIFIED_COLUMNS[] = {
+    {"rsi", &IndicatorSeriesColumns::rsi},
+    {"rsi_average_gain", &IndicatorSeriesColumns::rsi_average_gain},
+    {"rsi_average_loss", &IndicatorSeriesColumns::rsi_average_loss},
+    {"macd_fast_ema", &IndicatorSeriesColumns::macd_fast_ema},
+    {"macd_slow_ema", &IndicatorSeriesColumns::macd_slow_ema},
+    {"macd_line", &IndicatorSeriesColumns::macd_line},
+    {"macd_signal", &IndicatorSeriesColumns::macd_signal},
+    {"macd_histogram", &IndicatorSeriesColumns::macd_histogram},
+    {"bollinger_middle", &IndicatorSeriesColumns::bollinger_middle},
+    {"bollinger_upper", &IndicatorSeriesColumns::bollinger_upper},
+    {"bollinger_lower", &IndicatorSeriesColumns::bollinger_lower},
+    {"highest_high", &IndicatorSeriesColumns::highest_high},
+    {"lowest_low", &IndicatorSeriesColumns::lowest_low},
+    {"stochastic_k", &IndicatorSeriesColumns::stochastic_k},
+    {"stochastic_d", &IndicatorSeriesColumns::stochastic_d}
+};
+
+// Trending oscillation with a flat stretch, so the zero-movement and zero-range branches run too.
+// The bar count is not a multiple of the vector width, so every kernel also runs its scalar tail.
+std::vector<Bar> build_verification_bars() {
+    const size_t verification_bars_count = 203;
+    const size_t flat_stretch_begin = 120;
+    const size_t flat_stretch_end = 140;
+    
+    std::vector<Bar> verification_bars(verification_bars_count);
+    for (size_t bar_index = 0; bar_index < verification_bars_count; ++bar_index) {
+        Bar& verification_bar = verification_bars[bar_index];
+        double bar_position = static_cast<double>(bar_index);
+        if (bar_index >= flat_stretch_begin && bar_index < flat_stretch_end) {
+            verification_bar = verification_bars[flat_stretch_begin - 1];
+            verification_bar.open_price = verification_bar.close_price;
+            verification_bar.high_price = verification_bar.close_price;
+            verification_bar.low_price = verification_bar.close_price;
+            continue;
+        }
+        verification_bar.close_price = 100.0 + 5.0 * std::sin(bar_position * 0.37) + 0.05 * bar_position;
+        verification_bar.open_price = verification_bar.close_price - 0.3 * std::cos(bar_position * 0.91);
+        verification_bar.high_price = std::max(verification_bar.open_price, verification_bar.close_price) + 0.5 + 0.25 * std::cos(bar_position);
+        verification_bar.low_price = std::min(verification_bar.open_price, verification_bar.close_price) - 0.5 - 0.25 * std::sin(bar_position);
+        verification_bar.volume = 1000.0 + bar_position;
+    }
+    return verification_bars;
+}
+
+bool values_match(double scalar_value, double avx2_value) {
+    return scalar_value == avx2_value || (std::isnan(scalar_value) && std::isnan(avx2_value));
+}
+
+// Empty description when every column matches
+std::string describe_first_mismatch(const IndicatorSeriesColumns& scalar_columns, const IndicatorSeriesColumns& avx2_columns) {
+    for (const NamedIndicatorColumn& verified_column : VERIFIED_COLUMNS) {
+        const BarSeries::PriceColumn& scalar_values = scalar_columns.*verified_column.column;
+        const BarSeries::PriceColumn& avx2_values = avx2_columns.*verified_column.column;
+        if (scalar_values.size() != avx2_values.size()) {
+            return std::string(verified_column.column_name) + " column sizes differ";
+        }
+        for (size_t value_index = 0; value_index < scalar_values.size(); ++value_index) {
+            if (!values_match(scalar_values[value_index], avx2_values[value_index])) {
+                // Full precision, since the two values may differ only in the last bits
+                std::ostringstream mismatch_stream;
+                mismatch_stream << std::setprecision(std::numeric_limits<double>::max_digits10)
+                                << verified_column.column_name << " differs at bar " << value_index
+                                << " (SCALAR " << scalar_values[value_index] << ", AVX2 " << avx2_values[value_index] << ")";
+                return mismatch_stream.str();
+            }
+        }
+    }
+    return std::string();
+}
+
+} // anonymous namespace
+
+void IndicatorSeriesColumns::resize(size_t bars_count) {
+    rsi.resize(bars_count);
+    rsi_average_gain.resize(bars_count);
+    rsi_average_loss.resize(bars_count);
+    macd_fast_ema.resize(bars_count);
+    macd_slow_ema.resize(bars_count);
+    macd_line.resize(bars_count);
+    macd_signal.resize(bars_count);
+    macd_histogram.resize(bars_count);
+    bollinger_middle.resize(bars_count);
+    bollinger_upper.resize(bars_count);
+    bollinger_lower.resize(bars_count);
+    highest_high.resize(bars_count);
+    lowest_low.resize(bars_count);
+    stochastic_k.resize(bars_count);
+    stochastic_d.resize(bars_count);
+}
+
+IndicatorKernelParameters indicator_kernel_parameters_from_config(const StrategyConfig& strategy_config) {
+    IndicatorKernelParameters kernel_parameters;
+    kernel_parameters.rsi_period = strategy_config.rsi_period_bars;
+    kernel_parameters.macd_fast_period = strategy_config.macd_fast_period_bars;
+    kernel_parameters.macd_slow_period = strategy_config.macd_slow_period_bars;
+    kernel_parameters.macd_signal_period = strategy_config.macd_signal_period_bars;
+    kernel_parameters.bollinger_period = strategy_config.bollinger_period_bars;
+    kernel_parameters.bollinger_standard_deviations = strategy_config.bollinger_standard_deviations;
+    kernel_parameters.stochastic_k_period = strategy_config.stochastic_k_bars;
+    kernel_parameters.stochastic_d_period = strategy_config.stochastic_d_bars;
+    return kernel_parameters;
+}
+
+IndicatorKernelBackend get_indicator_kernel_backend() {
+    return kernels().backend;
+}
+
+bool set_indicator_kernel_backend(IndicatorKernelBackend requested_backend) {
+    if (requested_backend == IndicatorKernelBackend::SCALAR) {
+        active_kernel_table().store(&scalarKernelTable);
+        return true;
+    }
+#if INDICATOR_KERNELS_HAVE_AVX2
+    if (cpu_supports_avx2()) {
+        active_kernel_table().store(&avx2KernelTable);
+        return true;
+    }
+#endif
+    return false;
+}
+
+const char* indicator_kernel_backend_name(IndicatorKernelBackend backend) {
+    switch (backend) {
+        case IndicatorKernelBackend::AVX2:
+            return "AVX2";
+        case IndicatorKernelBackend::SCALAR:
+        default:
+            return "SCALAR";
+    }
+}
+
+bool verify_indicator_kernel_backends(std::string& mismatch_description_output) {
+    mismatch_description_output.clear();
+    const IndicatorKernelBackend startup_backend = get_indicator_kernel_backend();
+    if (!set_indicator_kernel_backend(IndicatorKernelBackend::AVX2)) {
+        return true;
+    }
+    
+    BarSeries verification_series;
+    verification_series.assign_from_bars(build_verification_bars());
+    
+    // Default periods, then short odd ones so the windows start and end off the vector boundaries
+    IndicatorKernelParameters short_period_parameters;
+    short_period_parameters.rsi_period = 5;
+    short_period_parameters.macd_fast_period = 3;
+    short_period_parameters.macd_slow_period = 7;
+    short_period_parameters.macd_signal_period = 4;
+    short_period_parameters.bollinger_period = 6;
+    short_period_parameters.stochastic_k_period = 5;
+    short_period_parameters.stochastic_d_period = 2;
+    const IndicatorKernelParameters verification_parameter_sets[] = {IndicatorKernelParameters(), short_period_parameters};
+    
+    IndicatorSeriesColumns scalar_columns;
+    IndicatorSeriesColumns avx2_columns;
+    for (const IndicatorKernelParameters& verification_parameters : verification_parameter_sets) {
+        set_indicator_kernel_backend(IndicatorKernelBackend::AVX2);
+        compute_indicator_set(verification_series, verification_parameters, avx2_columns);
+        set_indicator_kernel_backend(IndicatorKernelBackend::SCALAR);
+        compute_indicator_set(verification_series, verification_parameters, scalar_columns);
+        
+        mismatch_description_output = describe_first_mismatch(scalar_columns, avx2_columns);
+        if (!mismatch_description_output.empty()) {
+            return false;
+        }
+    }
+    
+    set_indicator_kernel_backend(startup_backend);
+    return true;
+}
+
+void compute_rsi_column(const double* close_values, size_t bars_count, int period,
+                        double* average_gain_output, double* average_loss_output, double* rsi_output) {
+    validate_period(period, "rsi_period");
+    fill_not_available(rsi_output, bars_count);
+    const size_t period_size = static_cast<size_t>(period);
+    if (bars_count <= period_size) {
+        fill_not_available(average_gain_output, bars_count);
+        fill_not_available(average_loss_output, bars_count);
+        return;
+    }
+    
+    // Raw per-bar gains/losses are written in place, then smoothed in place (Wilder)
+    kernels().split_gains_losses(close_values, bars_count, average_gain_output, average_loss_output);
+    
+    double gain_sum = 0.0;
+    double loss_sum = 0.0;
+    for (size_t bar_index = 1; bar_index <= period_size; ++bar_index) {
+        gain_sum += average_gain_output[bar_index];
+        loss_sum += average_loss_output[bar_index];
+    }
+    fill_not_available(average_gain_output, period_size);
+    fill_not_available(average_loss_output, period_size);
+    average_gain_output[period_size] = gain_sum / period;
+    average_loss_output[period_size] = loss_sum / period;
+    
+    for (size_t bar_index = period_size + 1; bar_index < bars_count; ++bar_index) {
+        average_gain_output[bar_index] = (average_gain_output[bar_index - 1] * (period - 1) + average_gain_output[bar_index]) / period;
+        average_loss_output[bar_index] = (average_loss_output[bar_index - 1] * (period - 1) + average_loss_output[bar_index]) / period;
+    }
+    
+    kernels().rsi_from_averages(average_gain_output + period_size, average_loss_output + period_size,
+                                bars_count - period_size, rsi_output + period_size);
+}
+
+void compute_ema_column(const double* input_values, size_t values_count, int period, double* ema_output) {
+    validate_period(period, "ema_period");
+    fill_not_available(ema_output, values_count);
+    const size_t period_size = static_cast<size_t>(period);
+    if (values_count < period_size) {
+        return;
+    }
+    
+    // Seeded with the simple average of the first period values
+    double seed_sum = 0.0;
+    for (size_t value_index = 0; value_index < period_size; ++value_index) {
+        seed_sum += input_values[value_index];
+    }
+    double ema_value = seed_sum / period;
+    ema_output[period_size - 1] = ema_value;
+    
+    const double smoothing_factor = 2.0 / (period + 1.0);
+    for (size_t value_index = period_size; value_index < values_count; ++value_index) {
+        ema_value += smoothing_factor * (input_values[value_index] - ema_value);
+        ema_output[value_index] = ema_value;
+    }
+}
+
+void compute_bollinger_columns(const double* close_values, size_t bars_count, int period, double standard_deviations,
+                               double* middle_output, double* upper_output, double* lower_output) {
+    validate_period(period, "bollinger_period");
+    fill_not_available(middle_output, bars_count);
+    fill_not_available(upper_output, bars_count);
+    fill_not_available(lower_output, bars_count);
+    if (bars_count < static_cast<size_t>(period)) {
+        return;
+    }
+    kernels().window_bands(close_values, bars_count, period, standard_deviations, middle_output, upper_output, lower_output);
+}
+
+void compute_stochastic_columns(const double* high_values, const double* low_values, const double* close_values,
+                                size_t bars_count, int k_period, int d_period,
+                                double* highest_high_output, double* lowest_low_output,
+                                double* k_output, double* d_output) {
+    validate_period(k_period, "stochastic_k_period");
+    validate_period(d_period, "stochastic_d_period");
+    fill_not_available(highest_high_output, bars_count);
+    fill_not_available(lowest_low_output, bars_count);
+    fill_not_available(k_output, bars_count);
+    fill_not_available(d_output, bars_count);
+    const size_t k_first_index = static_cast<size_t>(k_period) - 1;
+    if (bars_count <= k_first_index) {
+        return;
+    }
+    
+    kernels().window_extrema(high_values, low_values, bars_count, k_period, highest_high_output, lowest_low_output);
+    kernels().stochastic_from_extrema(close_values + k_first_index, highest_high_output + k_first_index, lowest_low_output + k_first_index,
+                                      bars_count - k_first_index, k_output + k_first_index);
+    
+    // %D is the simple average of %K, starting where %K becomes available
+    if (bars_count - k_first_index >= static_cast<size_t>(d_period)) {
+        kernels().window_mean(k_output + k_first_index, bars_count - k_first_index, d_period, d_output + k_first_index);
+    }
+}
+
+void compute_indicator_set(const BarSeries& bar_series, const IndicatorKernelParameters& kernel_parameters,
+                           IndicatorSeriesColumns& indicator_columns) {
+    if (kernel_parameters.macd_fast_period >= kernel_parameters.macd_slow_period) {
+        throw std::runtime_error("MACD fast period must be shorter than the slow period");
+    }
+    validate_period(kernel_parameters.macd_fast_period, "macd_fast_period");
+    validate_period(kernel_parameters.macd_signal_period, "macd_signal_period");
+    
+    const size_t bars_count = bar_series.size();
+    indicator_columns.resize(bars_count);
+    const double* close_values = bar_series.close_data();
+    
+    compute_rsi_column(close_values, bars_count, kernel_parameters.rsi_period,
+                       indicator_columns.rsi_average_gain.data(), indicator_columns.rsi_average_loss.data(), indicator_columns.rsi.data());
+    
+    compute_ema_column(close_values, bars_count, kernel_parameters.macd_fast_period, indicator_columns.macd_fast_ema.data());
+    compute_ema_column(close_values, bars_count, kernel_parameters.macd_slow_period, indicator_columns.macd_slow_ema.data());
+    fill_not_available(indicator_columns.macd_line.data(), bars_count);
+    fill_not_available(indicator_columns.macd_signal.data(), bars_count);
+    fill_not_available(indicator_columns.macd_histogram.data(), bars_count);
+    const size_t macd_first_index = static_cast<size_t>(kernel_parameters.macd_slow_period) - 1;
+    if (bars_count > macd_first_index) {
+        const size_t macd_values_count = bars_count - macd_first_index;
+        kernels().subtract_columns(indicator_columns.macd_fast_ema.data() + macd_first_index, indicator_columns.macd_slow_ema.data() + macd_first_index,
+                                   macd_values_count, indicator_columns.macd_line.data() + macd_first_index);
+        compute_ema_column(indicator_columns.macd_line.data() + macd_first_index, macd_values_count,
+                           kernel_parameters.macd_signal_period, indicator_columns.macd_signal.data() + macd_first_index);
+        
+        const size_t histogram_first_index = macd_first_index + static_cast<size_t>(kernel_parameters.macd_signal_period) - 1;
+        if (bars_count > histogram_first_index) {
+            kernels().subtract_columns(indicator_columns.macd_line.data() + histogram_first_index, indicator_columns.macd_signal.data() + histogram_first_index,
+                                       bars_count - histogram_first_index, indicator_columns.macd_histogram.data() + histogram_first_index);
+        }
+    }
+    
+    compute_bollinger_columns(close_values, bars_count, kernel_parameters.bollinger_period, kernel_parameters.bollinger_standard_deviations,
+                              indicator_columns.bollinger_middle.data(), indicator_columns.bollinger_upper.data(), indicator_columns.bollinger_lower.data());
+    
+    compute_stochastic_columns(bar_series.high_data(), bar_series.low_data(), close_values, bars_count,
+                               kernel_parameters.stochastic_k_period, kernel_parameters.stochastic_d_period,
+                               indicator_columns.highest_high.data(), indicator_columns.lowest_low.data(),
+                               indicator_columns.stochastic_k.data(), indicator_columns.stochastic_d.data());
+}
+
+OscillatorReadings latest_oscillator_readings(const IndicatorSeriesColumns& indicator_columns) {
+    OscillatorReadings oscillator_readings;
+    const size_t bars_count = indicator_columns.rsi.size();
+    if (bars_count < 2) {
+        return oscillator_readings;
+    }
+    
+    const size_t last_index = bars_count - 1;
+    oscillator_readings.rsi = indicator_columns.rsi[last_index];
+    oscillator_readings.macd_histogram = indicator_columns.macd_histogram[last_index];
+    oscillator_readings.previous_macd_histogram = indicator_columns.macd_histogram[last_index - 1];
+    oscillator_readings.bollinger_upper = indicator_columns.bollinger_upper[last_index];
+    oscillator_readings.bollinger_lower = indicator_columns.bollinger_lower[last_index];
+    oscillator_readings.stochastic_k = indicator_columns.stochastic_k[last_index];
+    oscillator_readings.stochastic_d = indicator_columns.stochastic_d[last_index];
+    
+    // NaN marks a warm-up position, so one finite check per value covers every lookback
+    oscillator_readings.has_data = std::isfinite(oscillator_readings.rsi) && std::isfinite(oscillator_readings.previous_macd_histogram) &&
+                                   std::isfinite(oscillator_readings.macd_histogram) && std::isfinite(oscillator_readings.bollinger_upper) &&
+                                   std::isfinite(oscillator_readings.bollinger_lower) && std::isfinite(oscillator_readings.stochastic_k) &&
+                                   std::isfinite(oscillator_readings.stochastic_d);
+    return oscillator_readings;
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
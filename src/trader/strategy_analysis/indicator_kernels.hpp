@@ -0,0 +1,90 @@
+#ifndef INDICATOR_KERNELS_HPP
+#define INDICATOR_KERNELS_HPP
+
+#include "configs/strategy_config.hpp"
+#include "trader/data_structures/bar_series.hpp"
+#include "trader/data_structures/data_structures.hpp"
+#include <cstddef>
+#include <string>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Batch oscillator kernels over whole BarSeries columns (live history or a backtest).
+// Element-wise and windowed stages run on AVX2 when the CPU supports it and on a scalar
+// fallback otherwise; the recursive smoothing steps (Wilder, EMA) are inherently sequential.
+// Both backends sum in the same order, so they produce identical results; the startup check
+// verify_indicator_kernel_backends holds the AVX2 path to that.
+
+enum class IndicatorKernelBackend {
+    SCALAR,
+    AVX2
+};
+
+struct IndicatorKernelParameters {
+    int rsi_period = 14;
+    int macd_fast_period = 12;
+    int macd_slow_period = 26;
+    int macd_signal_period = 9;
+    int bollinger_period = 20;
+    double bollinger_standard_deviations = 2.0;
+    int stochastic_k_period = 14;
+    int stochastic_d_period = 3;
+};
+
+// One value per bar, aligned with the source series. Positions before an indicator has
+// enough history hold NaN. Reusing the same instance across calls reuses the column capacity.
+struct IndicatorSeriesColumns {
+    BarSeries::PriceColumn rsi;
+    BarSeries::PriceColumn rsi_average_gain;
+    BarSeries::PriceColumn rsi_average_loss;
+    BarSeries::PriceColumn macd_fast_ema;
+    BarSeries::PriceColumn macd_slow_ema;
+    BarSeries::PriceColumn macd_line;
+    BarSeries::PriceColumn macd_signal;
+    BarSeries::PriceColumn macd_histogram;
+    BarSeries::PriceColumn bollinger_middle;
+    BarSeries::PriceColumn bollinger_upper;
+    BarSeries::PriceColumn bollinger_lower;
+    BarSeries::PriceColumn highest_high;
+    BarSeries::PriceColumn lowest_low;
+    BarSeries::PriceColumn stochastic_k;
+    BarSeries::PriceColumn stochastic_d;
+
+    void resize(size_t bars_count);
+};
+
+IndicatorKernelParameters indicator_kernel_parameters_from_config(const StrategyConfig& strategy_config);
+
+// Backend chosen once at startup from CPUID; can be forced (e.g. to SCALAR for comparisons)
+IndicatorKernelBackend get_indicator_kernel_backend();
+bool set_indicator_kernel_backend(IndicatorKernelBackend requested_backend);
+const char* indicator_kernel_backend_name(IndicatorKernelBackend backend);
+
+// Runs every kernel on both backends over a fixed synthetic series and compares the columns value for
+// value. On a mismatch the description names the first differing column and SCALAR stays active.
+// Switches the process-wide backend, so call it before any kernel runs on another thread.
+bool verify_indicator_kernel_backends(std::string& mismatch_description_output);
+
+// Raw column kernels; output arrays must hold bars_count values
+void compute_rsi_column(const double* close_values, size_t bars_count, int period,
+                        double* average_gain_output, double* average_loss_output, double* rsi_output);
+void compute_ema_column(const double* input_values, size_t values_count, int period, double* ema_output);
+void compute_bollinger_columns(const double* close_values, size_t bars_count, int period, double standard_deviations,
+                               double* middle_output, double* upper_output, double* lower_output);
+void compute_stochastic_columns(const double* high_values, const double* low_values, const double* close_values,
+                                size_t bars_count, int k_period, int d_period,
+                                double* highest_high_output, double* lowest_low_output,
+                                double* k_output, double* d_output);
+
+// Full indicator set for one series
+void compute_indicator_set(const BarSeries& bar_series, const IndicatorKernelParameters& kernel_parameters,
+                           IndicatorSeriesColumns& indicator_columns);
+
+// Values at the last bar; has_data stays false until every oscillator is past its warm-up
+OscillatorReadings latest_oscillator_readings(const IndicatorSeriesColumns& indicator_columns);
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // INDICATOR_KERNELS_HPP
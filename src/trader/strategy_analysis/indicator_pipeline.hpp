@@ -0,0 +1,139 @@
+#ifndef INDICATOR_PIPELINE_HPP
+#define INDICATOR_PIPELINE_HPP
+
+#include "trader/data_structures/bar_series.hpp"
+#include <tuple>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// One bar as seen by pipeline stages; the columns are read once per bar for all stages
+struct IndicatorBarInput {
+    double open_price;
+    double high_price;
+    double low_price;
+    double close_price;
+    double volume;
+    double previous_close_price;
+    bool has_previous_close;
+};
+
+struct IndicatorReadContext {
+    const IndicatorBarInput* forming_bar;   // nullptr when the newest bar was already committed
+    size_t bars_seen;                       // committed bars plus the forming bar
+};
+
+// Streaming indicator pipeline whose stage set is fixed at compile time.
+// Every stage type provides:
+//   void reset();
+//   void commit(const IndicatorBarInput& closed_bar);        // O(1) per closed bar
+//   Reading read(const IndicatorReadContext& context) const; // folds in the forming bar at read time
+// update_from_series walks the new bars once and feeds each bar to all stages through a fold
+// expression, so adding a stage never adds another scan over history and nothing is virtual.
+template <typename... IndicatorStages>
+class FusedIndicatorPipeline {
+    static_assert(sizeof...(IndicatorStages) > 0, "FusedIndicatorPipeline needs at least one stage");
+
+public:
+    static constexpr size_t STAGE_COUNT = sizeof...(IndicatorStages);
+
+    explicit FusedIndicatorPipeline(IndicatorStages... stages)
+        : indicator_stages(std::move(stages)...),
+          committed_bars_count(0),
+          last_committed_timestamp_ns(0),
+          last_committed_close_price(0.0),
+          has_forming_bar(false),
+          forming_bar_input() {}
+
+    // Accepts a time-ordered series whose last element is the forming bar.
+    // Bars newer than the last committed one are folded in; a rewound series resets every stage.
+    void update_from_series(const BarSeries& bar_series) {
+        if (bar_series.empty()) {
+            return;
+        }
+
+        const int64_t* timestamp_values = bar_series.timestamp_data();
+        const size_t newest_bar_index = bar_series.size() - 1;
+
+        if (committed_bars_count > 0 && timestamp_values[newest_bar_index] < last_committed_timestamp_ns) {
+            reset();
+        }
+
+        // Everything except the last bar is closed
+        for (size_t bar_index = 0; bar_index < newest_bar_index; ++bar_index) {
+            if (committed_bars_count == 0 || timestamp_values[bar_index] > last_committed_timestamp_ns) {
+                IndicatorBarInput closed_bar_input = make_bar_input(bar_series, bar_index);
+                std::apply([&closed_bar_input](IndicatorStages&... stages) { (stages.commit(closed_bar_input), ...); }, indicator_stages);
+
+                committed_bars_count++;
+                last_committed_timestamp_ns = timestamp_values[bar_index];
+                last_committed_close_price = closed_bar_input.close_price;
+            }
+        }
+
+        has_forming_bar = committed_bars_count == 0 || timestamp_values[newest_bar_index] > last_committed_timestamp_ns;
+        if (has_forming_bar) {
+            forming_bar_input = make_bar_input(bar_series, newest_bar_index);
+        }
+    }
+
+    void reset() {
+        std::apply([](IndicatorStages&... stages) { (stages.reset(), ...); }, indicator_stages);
+        committed_bars_count = 0;
+        last_committed_timestamp_ns = 0;
+        last_committed_close_price = 0.0;
+        has_forming_bar = false;
+    }
+
+    // Returns whatever reading type the stage produces (a double, or a struct for multi-value indicators)
+    template <size_t StageIndex>
+    auto read() const {
+        return std::get<StageIndex>(indicator_stages).read(read_context());
+    }
+
+    template <size_t StageIndex>
+    const typename std::tuple_element<StageIndex, std::tuple<IndicatorStages...>>::type& stage() const {
+        return std::get<StageIndex>(indicator_stages);
+    }
+
+    size_t get_bars_seen() const {
+        return committed_bars_count + (has_forming_bar ? 1 : 0);
+    }
+
+private:
+    std::tuple<IndicatorStages...> indicator_stages;
+
+    size_t committed_bars_count;
+    int64_t last_committed_timestamp_ns;
+    double last_committed_close_price;
+
+    bool has_forming_bar;
+    IndicatorBarInput forming_bar_input;
+
+    IndicatorBarInput make_bar_input(const BarSeries& bar_series, size_t bar_index) const {
+        IndicatorBarInput bar_input;
+        bar_input.open_price = bar_series.open_data()[bar_index];
+        bar_input.high_price = bar_series.high_data()[bar_index];
+        bar_input.low_price = bar_series.low_data()[bar_index];
+        bar_input.close_price = bar_series.close_data()[bar_index];
+        bar_input.volume = bar_series.volume_data()[bar_index];
+        bar_input.previous_close_price = last_committed_close_price;
+        bar_input.has_previous_close = committed_bars_count > 0;
+        return bar_input;
+    }
+
+    IndicatorReadContext read_context() const {
+        IndicatorReadContext context;
+        context.forming_bar = has_forming_bar ? &forming_bar_input : nullptr;
+        context.bars_seen = get_bars_seen();
+        return context;
+    }
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // INDICATOR_PIPELINE_HPP
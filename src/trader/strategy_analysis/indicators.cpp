@@ -5,74 +5,42 @@
 namespace AlpacaTrader {
 namespace Core {
 
-double compute_atr(const std::vector<double>& highs, const std::vector<double>& lows, const std::vector<double>& closes, int period, int minimum_bars_required) {
-    if (static_cast<int>(highs.size()) < minimum_bars_required) {
+double compute_atr(const BarSeries& bar_series, int period, int minimum_bars_required) {
+    const int bars_count_value = static_cast<int>(bar_series.size());
+    if (bars_count_value < minimum_bars_required) {
         return 0.0;
     }
     
-    int effectivePeriodValue = period;
-    if (static_cast<int>(highs.size()) < period + 1) {
-        effectivePeriodValue = static_cast<int>(highs.size()) - 1;
-        if (effectivePeriodValue < 1) {
-            effectivePeriodValue = 1;
-        }
-    }
-    
-    // CRITICAL: Validate vector sizes before accessing
-    if (highs.size() != lows.size() || highs.size() != closes.size()) {
-        return 0.0;
-    }
-    
-    if (highs.size() < 2) {
-        return 0.0;
-    }
-    
-    std::vector<double> true_range_values;
-    try {
-    for (size_t current_bar_index = 1; current_bar_index < highs.size(); ++current_bar_index) {
-            // Validate index before accessing previous close
-            if (current_bar_index - 1 >= closes.size()) {
-                continue; // Skip this iteration if index is invalid
-            }
-            
-        double true_range_value = std::max({highs[current_bar_index] - lows[current_bar_index], std::abs(highs[current_bar_index] - closes[current_bar_index-1]), std::abs(lows[current_bar_index] - closes[current_bar_index-1])});
-        true_range_values.push_back(true_range_value);
-    }
-    } catch (const std::exception& true_range_calculation_exception_error) {
-        return 0.0;
-    } catch (...) {
+    if (bars_count_value < 2 || period <= 0) {
         return 0.0;
     }
     
-    if (true_range_values.empty()) {
-        return 0.0;
-    }
+    // Only the newest period true ranges are needed, so sum them straight off the columns
+    const int period_to_use_value = std::min(period, bars_count_value - 1);
+    const double* high_values = bar_series.high_data();
+    const double* low_values = bar_series.low_data();
+    const double* close_values = bar_series.close_data();
     
     double true_range_sum = 0.0;
-    int period_to_use_value = std::min(effectivePeriodValue, static_cast<int>(true_range_values.size()));
-    int true_range_start_index = static_cast<int>(true_range_values.size()) - period_to_use_value;
-    if (true_range_start_index < 0) {
-        true_range_start_index = 0;
-    }
-    for (int true_range_index = true_range_start_index; true_range_index < static_cast<int>(true_range_values.size()); ++true_range_index) {
-        true_range_sum += true_range_values[true_range_index];
-    }
-    
-    if (period_to_use_value <= 0) {
-        return 0.0;
+    for (int current_bar_index = bars_count_value - period_to_use_value; current_bar_index < bars_count_value; ++current_bar_index) {
+        double previous_close_value = close_values[current_bar_index - 1];
+        true_range_sum += std::max({high_values[current_bar_index] - low_values[current_bar_index],
+                                    std::abs(high_values[current_bar_index] - previous_close_value),
+                                    std::abs(low_values[current_bar_index] - previous_close_value)});
     }
     
     return true_range_sum / period_to_use_value;
 }
 
-double compute_average_volume(const std::vector<double>& volumes, int period, double minimum_threshold) {
-    if (volumes.size() < static_cast<size_t>(period)) return 0.0;
+double compute_average_volume(const BarSeries& bar_series, int period, double minimum_threshold) {
+    if (period <= 0 || bar_series.size() < static_cast<size_t>(period)) return 0.0;
+    const double* volume_values = bar_series.volume_data();
     double volume_sum = 0.0;
-    int volume_start_index = static_cast<int>(volumes.size()) - period;
+    int volume_start_index = static_cast<int>(bar_series.size()) - period;
     
     // Calculate average over the period, including zero volumes
-    for (int volume_calculation_index = volume_start_index; volume_calculation_index < static_cast<int>(volumes.size()); ++volume_calculation_index) {
-        volume_sum += volumes[volume_calculation_index];
+    for (int volume_calculation_index = volume_start_index; volume_calculation_index < static_cast<int>(bar_series.size()); ++volume_calculation_index) {
+        volume_sum += volume_values[volume_calculation_index];
     }
     
     double average_volume_result = volume_sum / period;
@@ -93,50 +61,46 @@ bool detect_doji_pattern(double open, double high, double low, double close) {
     return (upper + lower) > body;
 }
 
-bool compute_technical_indicators(ProcessedData& processed_data, const std::vector<Bar>& bars, const SystemConfig& config) {
+bool compute_technical_indicators(ProcessedData& processed_data, const BarSeries& bar_series, IncrementalIndicatorState& indicator_state) {
     // Top-level try-catch to prevent segfault
     try {
-    if (bars.empty()) {
+    if (bar_series.empty()) {
         return false;
     }
     
-        // CRITICAL: Validate before accessing back()
-    const Bar& current_bar = bars.back();
-    processed_data.curr = current_bar;
-    
-    // Calculate maximum bars needed for all calculations
-    // avg_atr uses: atr_calculation_bars * average_atr_comparison_multiplier + 1 (for true range calculation)
-    const int atr_calculation_bars_value = config.strategy.atr_calculation_bars;
-    const int average_atr_period_bars_value = atr_calculation_bars_value * config.strategy.average_atr_comparison_multiplier;
-    const int max_bars_needed_for_calculations_value = average_atr_period_bars_value + 1;
-    
-    // Extract only the last N bars needed for calculations (optimize buffer usage)
-    // This ensures we use only recent bars and avoid unnecessary processing of old data
-    std::vector<Bar> bars_for_calculation_data;
-    if (static_cast<int>(bars.size()) > max_bars_needed_for_calculations_value) {
-        size_t start_index_value = bars.size() - static_cast<size_t>(max_bars_needed_for_calculations_value);
-        bars_for_calculation_data = std::vector<Bar>(bars.begin() + start_index_value, bars.end());
-    } else {
-        bars_for_calculation_data = bars;
-    }
-    
-    // Extract price data for calculations (using only bars needed)
-    std::vector<double> highs, lows, closes, volumes;
-    for (const auto& bar : bars_for_calculation_data) {
-        highs.push_back(bar.high_price);
-        lows.push_back(bar.low_price);
-        closes.push_back(bar.close_price);
-        volumes.push_back(bar.volume);
-    }
-    
-    // Compute ATR - calculates continuously, can be 0.0 during initial accumulation
-    processed_data.atr = compute_atr(highs, lows, closes, atr_calculation_bars_value, config.strategy.minimum_bars_for_atr_calculation);
+    processed_data.curr = bar_series.latest_bar();
     
-    // Compute average volume
-    processed_data.avg_vol = compute_average_volume(volumes, atr_calculation_bars_value, config.strategy.minimum_volume_threshold);
+    // Only bars newer than the previous update are folded in; no per-call copies or re-summing
+    indicator_state.update_from_series(bar_series);
     
     // ATR can be 0.0 during initial accumulation - allow continuous calculation
     // Trading will be blocked by data accumulation time check until sufficient data
+    processed_data.atr = indicator_state.get_atr();
+    processed_data.avg_atr = indicator_state.get_average_atr();
+    processed_data.avg_vol = indicator_state.get_average_volume();
+    
+    DonchianChannelReading donchian_reading = indicator_state.get_donchian_channel();
+    StochasticReading stochastic_reading = indicator_state.get_stochastic();
+    SwingPointReading swing_reading = indicator_state.get_swing_points();
+    processed_data.donchian_upper = donchian_reading.upper;
+    processed_data.donchian_lower = donchian_reading.lower;
+    processed_data.stochastic_k = stochastic_reading.percent_k;
+    processed_data.stochastic_d = stochastic_reading.percent_d;
+    processed_data.swing_high = swing_reading.swing_high;
+    processed_data.swing_low = swing_reading.swing_low;
+    processed_data.swing_is_upswing = swing_reading.is_upswing;
+    
+    RollingPercentileReading percentile_reading = indicator_state.get_rolling_percentiles();
+    processed_data.atr_percentile = percentile_reading.atr_percentile;
+    processed_data.volume_percentile = percentile_reading.volume_percentile;
+    processed_data.spread_percentile = percentile_reading.spread_percentile;
+    processed_data.percentile_sample_count = static_cast<int>(percentile_reading.sample_count);
+    
+    VolatilityRegimeReading volatility_reading = indicator_state.get_volatility_regime();
+    processed_data.ewma_volatility = volatility_reading.ewma_volatility;
+    processed_data.garch_volatility = volatility_reading.garch_volatility;
+    processed_data.volatility_ratio = volatility_reading.volatility_ratio;
+    processed_data.volatility_regime = volatility_reading.regime;
         return true;
     } catch (const std::exception& indicators_exception_error) {
         // Log error but return false to indicate failure
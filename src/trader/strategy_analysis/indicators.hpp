@@ -4,16 +4,18 @@
 #include <vector>
 #include "configs/system_config.hpp"
 #include "trader/data_structures/data_structures.hpp"
+#include "trader/data_structures/bar_series.hpp"
+#include "trader/strategy_analysis/incremental_indicators.hpp"
 
 using AlpacaTrader::Config::SystemConfig;
 
 namespace AlpacaTrader {
 namespace Core {
 
-double compute_atr(const std::vector<double>& highs, const std::vector<double>& lows, const std::vector<double>& closes, int period, int minimum_bars_required);
-double compute_average_volume(const std::vector<double>& volumes, int period, double minimum_threshold);
+double compute_atr(const BarSeries& bar_series, int period, int minimum_bars_required);
+double compute_average_volume(const BarSeries& bar_series, int period, double minimum_threshold);
 bool detect_doji_pattern(double open, double high, double low, double close);
-bool compute_technical_indicators(ProcessedData& processed_data, const std::vector<Bar>& bars, const SystemConfig& config);
+bool compute_technical_indicators(ProcessedData& processed_data, const BarSeries& bar_series, IncrementalIndicatorState& indicator_state);
 
 } // namespace Core
 } // namespace AlpacaTrader
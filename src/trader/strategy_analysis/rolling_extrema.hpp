@@ -0,0 +1,99 @@
+#ifndef ROLLING_EXTREMA_HPP
+#define ROLLING_EXTREMA_HPP
+
+#include <vector>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Rolling maximum/minimum over the newest window_length pushes using a monotonic deque.
+// Each value enters and leaves the deque at most once, so push is amortized O(1) whatever
+// the window length; the deque lives in a fixed ring sized to the window and never reallocates.
+// Dominates(a, b) is true when a newer value a makes an older value b irrelevant
+// (greater_equal for a maximum, less_equal for a minimum).
+template <typename Dominates>
+class MonotonicRollingExtremum {
+public:
+    explicit MonotonicRollingExtremum(size_t window_length_value)
+        : window_entries(window_length_value > 0 ? window_length_value : 1),
+          head_index(0),
+          entry_count(0),
+          next_sequence(0),
+          dominates() {}
+
+    void push(double value) {
+        // Expire the entry that falls out of the window, then drop every value the new one dominates
+        const size_t window_length_value = window_entries.size();
+        if (entry_count > 0 && window_entries[head_index].sequence + window_length_value <= next_sequence) {
+            head_index = (head_index + 1) % window_length_value;
+            entry_count--;
+        }
+        while (entry_count > 0 && dominates(value, window_entries[(head_index + entry_count - 1) % window_length_value].value)) {
+            entry_count--;
+        }
+
+        WindowEntry& new_entry = window_entries[(head_index + entry_count) % window_length_value];
+        new_entry.sequence = next_sequence;
+        new_entry.value = value;
+        entry_count++;
+        next_sequence++;
+    }
+
+    void clear() {
+        head_index = 0;
+        entry_count = 0;
+        next_sequence = 0;
+    }
+
+    bool empty() const { return entry_count == 0; }
+    size_t window_length() const { return window_entries.size(); }
+    // Sequence numbers count pushes since the last clear, starting at 0
+    uint64_t pushed_count() const { return next_sequence; }
+
+    // Extremum over the newest min(newest_count, window_length) pushes.
+    // Older deque entries are skipped from the front, so asking for window_length - 1 costs at most one extra step.
+    bool extremum_over_newest(size_t newest_count, double& extremum_value, uint64_t& extremum_sequence) const {
+        if (entry_count == 0 || newest_count == 0) {
+            return false;
+        }
+
+        const size_t window_length_value = window_entries.size();
+        const uint64_t first_included_sequence = newest_count >= next_sequence ? 0 : next_sequence - newest_count;
+        for (size_t entry_offset = 0; entry_offset < entry_count; ++entry_offset) {
+            const WindowEntry& window_entry = window_entries[(head_index + entry_offset) % window_length_value];
+            if (window_entry.sequence >= first_included_sequence) {
+                extremum_value = window_entry.value;
+                extremum_sequence = window_entry.sequence;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool extremum(double& extremum_value, uint64_t& extremum_sequence) const {
+        return extremum_over_newest(window_entries.size(), extremum_value, extremum_sequence);
+    }
+
+private:
+    struct WindowEntry {
+        uint64_t sequence;
+        double value;
+    };
+
+    std::vector<WindowEntry> window_entries;
+    size_t head_index;
+    size_t entry_count;
+    uint64_t next_sequence;
+    Dominates dominates;
+};
+
+using RollingMaximum = MonotonicRollingExtremum<std::greater_equal<double>>;
+using RollingMinimum = MonotonicRollingExtremum<std::less_equal<double>>;
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // ROLLING_EXTREMA_HPP
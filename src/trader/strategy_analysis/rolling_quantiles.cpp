@@ -0,0 +1,211 @@
+#include "rolling_quantiles.hpp"
+#include <cmath>
+
+namespace AlpacaTrader {
+namespace Core {
+
+namespace {
+
+const int32_t NO_NODE_INDEX = -1;
+
+} // anonymous namespace
+
+RollingQuantileWindow::RollingQuantileWindow(size_t window_length)
+    : arrival_ring(window_length > 0 ? window_length : 1, 0.0),
+      oldest_sample_index(0),
+      sample_count(0),
+      node_pool(),
+      free_node_indices(),
+      root_index(NO_NODE_INDEX),
+      priority_state(2463534242u) {
+    node_pool.reserve(arrival_ring.size());
+    free_node_indices.reserve(arrival_ring.size());
+}
+
+void RollingQuantileWindow::push(double sample_value) {
+    if (std::isnan(sample_value)) {
+        return;
+    }
+
+    if (sample_count == arrival_ring.size()) {
+        erase_one_value(arrival_ring[oldest_sample_index]);
+        arrival_ring[oldest_sample_index] = sample_value;
+        oldest_sample_index = (oldest_sample_index + 1) % arrival_ring.size();
+    } else {
+        arrival_ring[(oldest_sample_index + sample_count) % arrival_ring.size()] = sample_value;
+        sample_count++;
+    }
+    insert_value(sample_value);
+}
+
+void RollingQuantileWindow::clear() {
+    oldest_sample_index = 0;
+    sample_count = 0;
+    node_pool.clear();
+    free_node_indices.clear();
+    root_index = NO_NODE_INDEX;
+}
+
+double RollingQuantileWindow::quantile(double quantile_fraction) const {
+    if (sample_count == 0) {
+        return 0.0;
+    }
+
+    double clamped_fraction = quantile_fraction < 0.0 ? 0.0 : (quantile_fraction > 1.0 ? 1.0 : quantile_fraction);
+    double rank_position = clamped_fraction * static_cast<double>(sample_count - 1);
+    size_t lower_rank = static_cast<size_t>(std::floor(rank_position));
+    double lower_value = kth_smallest(lower_rank);
+    if (lower_rank + 1 >= sample_count) {
+        return lower_value;
+    }
+
+    double interpolation_weight = rank_position - static_cast<double>(lower_rank);
+    return lower_value + interpolation_weight * (kth_smallest(lower_rank + 1) - lower_value);
+}
+
+double RollingQuantileWindow::percentile_rank(double value_to_rank) const {
+    if (sample_count == 0) {
+        return 0.5;
+    }
+
+    size_t strictly_below_count = count_below(value_to_rank, false);
+    size_t below_or_equal_count = count_below(value_to_rank, true);
+    double mid_rank = static_cast<double>(strictly_below_count) + 0.5 * static_cast<double>(below_or_equal_count - strictly_below_count);
+    return mid_rank / static_cast<double>(sample_count);
+}
+
+uint32_t RollingQuantileWindow::next_priority() {
+    // xorshift32: cheap, deterministic priorities are enough to keep the treap balanced in expectation
+    priority_state ^= priority_state << 13;
+    priority_state ^= priority_state >> 17;
+    priority_state ^= priority_state << 5;
+    return priority_state;
+}
+
+uint32_t RollingQuantileWindow::subtree_size_of(int32_t node_index) const {
+    return node_index == NO_NODE_INDEX ? 0 : node_pool[node_index].subtree_size;
+}
+
+void RollingQuantileWindow::update_subtree_size(int32_t node_index) {
+    TreapNode& tree_node = node_pool[node_index];
+    tree_node.subtree_size = 1 + subtree_size_of(tree_node.left_index) + subtree_size_of(tree_node.right_index);
+}
+
+void RollingQuantileWindow::split(int32_t node_index, double split_value, bool include_equal, int32_t& left_result, int32_t& right_result) {
+    if (node_index == NO_NODE_INDEX) {
+        left_result = NO_NODE_INDEX;
+        right_result = NO_NODE_INDEX;
+        return;
+    }
+
+    TreapNode& tree_node = node_pool[node_index];
+    bool goes_left = include_equal ? tree_node.value <= split_value : tree_node.value < split_value;
+    if (goes_left) {
+        int32_t right_of_left_child = NO_NODE_INDEX;
+        split(tree_node.right_index, split_value, include_equal, right_of_left_child, right_result);
+        node_pool[node_index].right_index = right_of_left_child;
+        left_result = node_index;
+    } else {
+        int32_t left_of_right_child = NO_NODE_INDEX;
+        split(tree_node.left_index, split_value, include_equal, left_result, left_of_right_child);
+        node_pool[node_index].left_index = left_of_right_child;
+        right_result = node_index;
+    }
+    update_subtree_size(node_index);
+}
+
+int32_t RollingQuantileWindow::merge(int32_t left_index, int32_t right_index) {
+    if (left_index == NO_NODE_INDEX) {
+        return right_index;
+    }
+    if (right_index == NO_NODE_INDEX) {
+        return left_index;
+    }
+
+    if (node_pool[left_index].priority > node_pool[right_index].priority) {
+        node_pool[left_index].right_index = merge(node_pool[left_index].right_index, right_index);
+        update_subtree_size(left_index);
+        return left_index;
+    }
+    node_pool[right_index].left_index = merge(left_index, node_pool[right_index].left_index);
+    update_subtree_size(right_index);
+    return right_index;
+}
+
+void RollingQuantileWindow::insert_value(double value) {
+    int32_t new_node_index;
+    if (!free_node_indices.empty()) {
+        new_node_index = free_node_indices.back();
+        free_node_indices.pop_back();
+    } else {
+        new_node_index = static_cast<int32_t>(node_pool.size());
+        node_pool.push_back(TreapNode());
+    }
+
+    TreapNode& new_node = node_pool[new_node_index];
+    new_node.value = value;
+    new_node.priority = next_priority();
+    new_node.left_index = NO_NODE_INDEX;
+    new_node.right_index = NO_NODE_INDEX;
+    new_node.subtree_size = 1;
+
+    int32_t below_index = NO_NODE_INDEX;
+    int32_t at_or_above_index = NO_NODE_INDEX;
+    split(root_index, value, false, below_index, at_or_above_index);
+    root_index = merge(merge(below_index, new_node_index), at_or_above_index);
+}
+
+void RollingQuantileWindow::erase_one_value(double value) {
+    int32_t below_index = NO_NODE_INDEX;
+    int32_t at_or_above_index = NO_NODE_INDEX;
+    split(root_index, value, false, below_index, at_or_above_index);
+
+    int32_t equal_index = NO_NODE_INDEX;
+    int32_t above_index = NO_NODE_INDEX;
+    split(at_or_above_index, value, true, equal_index, above_index);
+
+    if (equal_index != NO_NODE_INDEX) {
+        // Drop the root of the equal-valued subtree; any duplicates stay
+        int32_t removed_node_index = equal_index;
+        equal_index = merge(node_pool[removed_node_index].left_index, node_pool[removed_node_index].right_index);
+        free_node_indices.push_back(removed_node_index);
+    }
+
+    root_index = merge(below_index, merge(equal_index, above_index));
+}
+
+double RollingQuantileWindow::kth_smallest(size_t rank_index) const {
+    int32_t node_index = root_index;
+    while (node_index != NO_NODE_INDEX) {
+        const TreapNode& tree_node = node_pool[node_index];
+        size_t left_size = subtree_size_of(tree_node.left_index);
+        if (rank_index < left_size) {
+            node_index = tree_node.left_index;
+        } else if (rank_index == left_size) {
+            return tree_node.value;
+        } else {
+            rank_index -= left_size + 1;
+            node_index = tree_node.right_index;
+        }
+    }
+    return 0.0;
+}
+
+size_t RollingQuantileWindow::count_below(double value, bool include_equal) const {
+    size_t below_count = 0;
+    int32_t node_index = root_index;
+    while (node_index != NO_NODE_INDEX) {
+        const TreapNode& tree_node = node_pool[node_index];
+        bool node_counts = include_equal ? tree_node.value <= value : tree_node.value < value;
+        if (node_counts) {
+            below_count += subtree_size_of(tree_node.left_index) + 1;
+            node_index = tree_node.right_index;
+        } else {
+            node_index = tree_node.left_index;
+        }
+    }
+    return below_count;
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
@@ -0,0 +1,65 @@
+#ifndef ROLLING_QUANTILES_HPP
+#define ROLLING_QUANTILES_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Order statistics over the newest window_length samples.
+// Samples are kept in arrival order (for expiry) and in a size-augmented treap (for rank queries),
+// so push, quantile and percentile_rank are O(log n) and nothing is re-sorted per query.
+// Tree nodes come from a pool sized to the window; steady-state pushes do not allocate.
+class RollingQuantileWindow {
+public:
+    explicit RollingQuantileWindow(size_t window_length);
+
+    // NaN samples are ignored
+    void push(double sample_value);
+    void clear();
+
+    size_t size() const { return sample_count; }
+    size_t capacity() const { return arrival_ring.size(); }
+    bool empty() const { return sample_count == 0; }
+
+    // Linearly interpolated quantile for quantile_fraction in [0, 1]; 0.0 when empty
+    double quantile(double quantile_fraction) const;
+    // Mid-rank share of samples below value_to_rank, in [0, 1]; 0.5 when empty
+    double percentile_rank(double value_to_rank) const;
+
+private:
+    struct TreapNode {
+        double value;
+        uint32_t priority;
+        int32_t left_index;
+        int32_t right_index;
+        uint32_t subtree_size;
+    };
+
+    std::vector<double> arrival_ring;
+    size_t oldest_sample_index;
+    size_t sample_count;
+
+    std::vector<TreapNode> node_pool;
+    std::vector<int32_t> free_node_indices;
+    int32_t root_index;
+    uint32_t priority_state;
+
+    uint32_t next_priority();
+    uint32_t subtree_size_of(int32_t node_index) const;
+    void update_subtree_size(int32_t node_index);
+    // Splits into nodes ordered before value (or at it when include_equal) and the rest
+    void split(int32_t node_index, double split_value, bool include_equal, int32_t& left_result, int32_t& right_result);
+    int32_t merge(int32_t left_index, int32_t right_index);
+    void insert_value(double value);
+    void erase_one_value(double value);
+    double kth_smallest(size_t rank_index) const;
+    size_t count_below(double value, bool include_equal) const;
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // ROLLING_QUANTILES_HPP
@@ -0,0 +1,348 @@
+#include "signal_policy.hpp"
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <utility>
+
+namespace AlpacaTrader {
+namespace Core {
+
+namespace {
+
+struct SignalRuleScores {
+    double buy_strength = 0.0;
+    double sell_strength = 0.0;
+    uint16_t buy_reason_flags = 0;
+    uint16_t sell_reason_flags = 0;
+};
+
+// Scores the buy and sell rule sets for one timeframe's current and previous bars
+template <typename RulePolicy>
+void evaluate_signal_rules(const Bar& current_bar, const Bar& previous_bar, double atr_value, const SignalParameters& signal_parameters, SignalRuleScores& rule_scores_output) {
+    // Calculate momentum indicators for better signal detection
+    double price_change_amount = current_bar.close_price - previous_bar.close_price;
+    double price_change_percentage = (previous_bar.close_price > 0.0) ? (price_change_amount / previous_bar.close_price) * signal_parameters.percentage_calculation_multiplier : 0.0;
+    
+    // Volume momentum; crypto volumes are much smaller, so their percentage change is amplified
+    double volume_change_amount = current_bar.volume - previous_bar.volume;
+    double volume_change_percentage = (previous_bar.volume > 0) ? (volume_change_amount / previous_bar.volume) * signal_parameters.percentage_calculation_multiplier : 0.0;
+    volume_change_percentage *= signal_parameters.volume_change_amplification;
+    
+    // Calculate volatility (ATR-based)
+    double volatility_percentage = (previous_bar.close_price > 0.0) ? (atr_value / previous_bar.close_price) * signal_parameters.percentage_calculation_multiplier : 0.0;
+    
+    // BUY pattern; the policy decides at compile time which comparisons exist
+    bool basic_buy_close_condition = RulePolicy::buy_allow_equal_close ? (current_bar.close_price >= current_bar.open_price)
+                                                                       : (current_bar.close_price > current_bar.open_price);
+    bool buy_high_condition_result = !RulePolicy::buy_require_higher_high || (current_bar.high_price > previous_bar.high_price);
+    bool buy_low_condition_result = !RulePolicy::buy_require_higher_low || (current_bar.low_price >= previous_bar.low_price);
+    
+    // Momentum-based buy confirmation (configurable thresholds)
+    bool momentum_buy_signal = price_change_percentage > signal_parameters.minimum_price_change_percentage_for_momentum;
+    bool volume_confirmation_result = volume_change_percentage > signal_parameters.minimum_volume_increase_percentage_for_buy_signals;
+    bool volatility_adequate_result = volatility_percentage > signal_parameters.minimum_volatility_percentage_for_buy_signals;
+    
+    // Calculate signal strength and reasoning
+    double buy_strength_value = 0.0;
+    uint16_t buy_reason_flags = SIGNAL_REASON_EVALUATED;
+    
+    if (basic_buy_close_condition && buy_high_condition_result && buy_low_condition_result) {
+        buy_strength_value += signal_parameters.basic_price_pattern_weight; // Basic pattern strength
+        buy_reason_flags |= SIGNAL_REASON_BASIC_PATTERN;
+        
+        if (momentum_buy_signal) {
+            buy_strength_value += signal_parameters.momentum_indicator_weight; // Momentum strength
+            buy_reason_flags |= SIGNAL_REASON_MOMENTUM;
+        }
+        
+        if (volume_confirmation_result) {
+            buy_strength_value += signal_parameters.volume_analysis_weight; // Volume confirmation
+            buy_reason_flags |= SIGNAL_REASON_VOLUME;
+        }
+        
+        if (volatility_adequate_result) {
+            buy_strength_value += signal_parameters.volatility_analysis_weight; // Volatility confirmation
+            buy_reason_flags |= SIGNAL_REASON_VOLATILITY;
+        }
+    }
+    
+    // SELL pattern
+    bool basic_sell_close_condition = RulePolicy::sell_allow_equal_close ? (current_bar.close_price <= current_bar.open_price)
+                                                                         : (current_bar.close_price < current_bar.open_price);
+    bool sell_low_condition_result = !RulePolicy::sell_require_lower_low || (current_bar.low_price < previous_bar.low_price);
+    bool sell_high_condition_result = !RulePolicy::sell_require_lower_high || (current_bar.high_price <= previous_bar.high_price);
+    
+    // Momentum-based sell confirmation (configurable thresholds)
+    bool momentum_sell_signal = price_change_percentage < -signal_parameters.minimum_price_change_percentage_for_momentum;
+    bool volume_sell_confirmation_result = volume_change_percentage > signal_parameters.minimum_volume_increase_percentage_for_sell_signals;
+    bool volatility_sell_adequate_result = volatility_percentage > signal_parameters.minimum_volatility_percentage_for_sell_signals;
+    
+    // Calculate sell signal strength and reasoning
+    double sell_strength_value = 0.0;
+    uint16_t sell_reason_flags = SIGNAL_REASON_EVALUATED | SIGNAL_REASON_SELL_RULES;
+    
+    if (basic_sell_close_condition && sell_low_condition_result && sell_high_condition_result) {
+        sell_strength_value += signal_parameters.basic_price_pattern_weight; // Basic pattern strength
+        sell_reason_flags |= SIGNAL_REASON_BASIC_PATTERN;
+        
+        if (momentum_sell_signal) {
+            sell_strength_value += signal_parameters.momentum_indicator_weight; // Momentum strength
+            sell_reason_flags |= SIGNAL_REASON_MOMENTUM;
+        }
+        
+        if (volume_sell_confirmation_result) {
+            sell_strength_value += signal_parameters.volume_analysis_weight; // Volume confirmation
+            sell_reason_flags |= SIGNAL_REASON_VOLUME;
+        }
+        
+        if (volatility_sell_adequate_result) {
+            sell_strength_value += signal_parameters.volatility_analysis_weight; // Volatility confirmation
+            sell_reason_flags |= SIGNAL_REASON_VOLATILITY;
+        }
+    }
+    
+    rule_scores_output.buy_strength = buy_strength_value;
+    rule_scores_output.sell_strength = sell_strength_value;
+    rule_scores_output.buy_reason_flags = buy_reason_flags;
+    rule_scores_output.sell_reason_flags = sell_reason_flags;
+}
+
+const int OSCILLATOR_COUNT = 4;
+
+// Number of oscillators (RSI, Bollinger Bands, MACD histogram, Stochastic) agreeing with each side
+void count_oscillator_confirmations(const OscillatorReadings& oscillator_readings, double close_price, const SignalParameters& signal_parameters,
+                                    int& buy_confirmations_output, int& sell_confirmations_output) {
+    buy_confirmations_output = (oscillator_readings.rsi <= signal_parameters.rsi_oversold_level ? 1 : 0) +
+                               (close_price <= oscillator_readings.bollinger_lower ? 1 : 0) +
+                               (oscillator_readings.macd_histogram > oscillator_readings.previous_macd_histogram ? 1 : 0) +
+                               (oscillator_readings.stochastic_k > oscillator_readings.stochastic_d ? 1 : 0);
+    sell_confirmations_output = (oscillator_readings.rsi >= signal_parameters.rsi_overbought_level ? 1 : 0) +
+                                (close_price >= oscillator_readings.bollinger_upper ? 1 : 0) +
+                                (oscillator_readings.macd_histogram < oscillator_readings.previous_macd_histogram ? 1 : 0) +
+                                (oscillator_readings.stochastic_k < oscillator_readings.stochastic_d ? 1 : 0);
+}
+
+template <typename RulePolicy>
+SignalDecision detect_signals_with_policy(const ProcessedData& processed_data_input, const SignalParameters& signal_parameters) {
+    SignalDecision signal_decision_result;
+    
+    // Turbulent regimes demand a stronger signal before acting
+    signal_decision_result.signal_threshold = signal_parameters.signal_threshold_by_regime[static_cast<size_t>(processed_data_input.volatility_regime)];
+    
+    SignalRuleScores base_rule_scores;
+    evaluate_signal_rules<RulePolicy>(processed_data_input.curr, processed_data_input.prev, processed_data_input.atr, signal_parameters, base_rule_scores);
+    double buy_strength_value = base_rule_scores.buy_strength;
+    double sell_strength_value = base_rule_scores.sell_strength;
+    uint16_t buy_reason_flags = base_rule_scores.buy_reason_flags;
+    uint16_t sell_reason_flags = base_rule_scores.sell_reason_flags;
+    int buy_confirmations = 0;
+    int sell_confirmations = 0;
+    int timeframes_with_data = 0;
+    int buy_oscillator_confirmations = 0;
+    int sell_oscillator_confirmations = 0;
+    
+    // Oscillator confirmation on the base timeframe; each agreeing oscillator adds an equal share of the weight
+    if (signal_parameters.enable_oscillator_signals && processed_data_input.oscillators.has_data) {
+        count_oscillator_confirmations(processed_data_input.oscillators, processed_data_input.curr.close_price, signal_parameters,
+                                       buy_oscillator_confirmations, sell_oscillator_confirmations);
+        buy_strength_value += signal_parameters.oscillator_signal_weight * buy_oscillator_confirmations / OSCILLATOR_COUNT;
+        sell_strength_value += signal_parameters.oscillator_signal_weight * sell_oscillator_confirmations / OSCILLATOR_COUNT;
+        buy_reason_flags |= SIGNAL_REASON_OSCILLATORS;
+        sell_reason_flags |= SIGNAL_REASON_OSCILLATORS;
+    }
+    
+    // Multi-timeframe confirmation: weighted mean of the rule strengths over every timeframe with data.
+    // Inputs were rolled up by the market data thread, so this is a few rule evaluations and no fetches.
+    const MultiTimeframeInputs& multi_timeframe_inputs = processed_data_input.multi_timeframe_inputs;
+    if (signal_parameters.enable_multi_timeframe_confirmation && multi_timeframe_inputs.timeframe_count > 0) {
+        double total_weight = signal_parameters.base_timeframe_signal_weight;
+        double weighted_buy_strength = total_weight * buy_strength_value;
+        double weighted_sell_strength = total_weight * sell_strength_value;
+        
+        SignalRuleScores timeframe_rule_scores;
+        for (int timeframe_index = 0; timeframe_index < multi_timeframe_inputs.timeframe_count; ++timeframe_index) {
+            const TimeframeSignalInputs& timeframe_inputs = multi_timeframe_inputs.timeframes[timeframe_index];
+            if (!timeframe_inputs.has_data || timeframe_index >= signal_parameters.confirmation_timeframe_count) {
+                continue;
+            }
+            
+            evaluate_signal_rules<RulePolicy>(timeframe_inputs.curr, timeframe_inputs.prev, timeframe_inputs.atr, signal_parameters, timeframe_rule_scores);
+            double timeframe_weight = signal_parameters.confirmation_timeframe_weights[timeframe_index];
+            weighted_buy_strength += timeframe_weight * timeframe_rule_scores.buy_strength;
+            weighted_sell_strength += timeframe_weight * timeframe_rule_scores.sell_strength;
+            total_weight += timeframe_weight;
+            timeframes_with_data++;
+            if (timeframe_rule_scores.buy_strength >= signal_decision_result.signal_threshold) {
+                buy_confirmations++;
+            }
+            if (timeframe_rule_scores.sell_strength >= signal_decision_result.signal_threshold) {
+                sell_confirmations++;
+            }
+        }
+        
+        if (timeframes_with_data > 0 && total_weight > 0.0) {
+            buy_strength_value = weighted_buy_strength / total_weight;
+            sell_strength_value = weighted_sell_strength / total_weight;
+            buy_reason_flags |= SIGNAL_REASON_MULTI_TIMEFRAME;
+            sell_reason_flags |= SIGNAL_REASON_MULTI_TIMEFRAME;
+        }
+    }
+    
+    // Set buy signal if strength is above threshold
+    signal_decision_result.buy = buy_strength_value >= signal_decision_result.signal_threshold;
+    signal_decision_result.signal_strength = buy_strength_value;
+    signal_decision_result.signal_reason_flags = buy_reason_flags;
+    signal_decision_result.timeframe_confirmations = static_cast<uint8_t>(buy_confirmations);
+    signal_decision_result.oscillator_confirmations = static_cast<uint8_t>(buy_oscillator_confirmations);
+    
+    // Set sell signal if strength is above threshold
+    signal_decision_result.sell = sell_strength_value >= signal_decision_result.signal_threshold;
+    
+    // Update signal strength and reason (use the stronger signal)
+    if (sell_strength_value > signal_decision_result.signal_strength) {
+        signal_decision_result.signal_strength = sell_strength_value;
+        signal_decision_result.signal_reason_flags = sell_reason_flags;
+        signal_decision_result.timeframe_confirmations = static_cast<uint8_t>(sell_confirmations);
+        signal_decision_result.oscillator_confirmations = static_cast<uint8_t>(sell_oscillator_confirmations);
+    }
+    signal_decision_result.timeframes_with_data = static_cast<uint8_t>(timeframes_with_data);
+    
+    return signal_decision_result;
+}
+
+// Doji if the body is less than the threshold share of the total range
+bool detect_doji_pattern(double open, double high, double low, double close, double doji_threshold) {
+    double body_size = std::abs(close - open);
+    double total_range = high - low;
+    
+    if (total_range == 0.0) return false; // Avoid division by zero
+    
+    return (body_size / total_range) < doji_threshold;
+}
+
+template <typename ActiveFilterPolicy>
+FilterResult evaluate_filters_with_policy(const ProcessedData& processed_data_input, const SignalParameters& signal_parameters) {
+    FilterResult filter_result_output;
+    
+    // Rolling percentiles replace the fixed multipliers once the symbol has enough history to rank against
+    bool use_percentile_filters = ActiveFilterPolicy::use_rolling_percentile_filters &&
+                                  processed_data_input.percentile_sample_count >= signal_parameters.minimum_percentile_samples;
+    
+    // ATR filter: use rolling percentile, absolute threshold or relative threshold
+    filter_result_output.filter_basis_flags = 0;
+    if (use_percentile_filters) {
+        filter_result_output.atr_pass = processed_data_input.atr_percentile >= signal_parameters.minimum_atr_percentile;
+        filter_result_output.filter_basis_flags |= FILTER_BASIS_ATR_PERCENTILE | FILTER_BASIS_VOLUME_PERCENTILE;
+    } else if (ActiveFilterPolicy::use_absolute_atr_threshold) {
+        filter_result_output.atr_pass = processed_data_input.atr > signal_parameters.atr_absolute_minimum_threshold;
+        filter_result_output.filter_basis_flags |= FILTER_BASIS_ATR_ABSOLUTE;
+    } else {
+        filter_result_output.atr_pass = processed_data_input.atr > signal_parameters.entry_signal_atr_multiplier * processed_data_input.avg_atr;
+    }
+    
+    // A percentile is scale-free, so fractional crypto volumes need no separate threshold
+    if (use_percentile_filters) {
+        filter_result_output.vol_pass = processed_data_input.volume_percentile >= signal_parameters.minimum_volume_percentile;
+    } else {
+        filter_result_output.vol_pass = processed_data_input.curr.volume > signal_parameters.volume_filter_multiplier * processed_data_input.avg_vol;
+    }
+    
+    filter_result_output.doji_pass = !detect_doji_pattern(processed_data_input.curr.open_price, processed_data_input.curr.high_price, processed_data_input.curr.low_price,
+                                                          processed_data_input.curr.close_price, signal_parameters.doji_candlestick_body_size_threshold_percentage);
+    filter_result_output.all_pass = filter_result_output.atr_pass && filter_result_output.vol_pass && filter_result_output.doji_pass;
+    filter_result_output.atr_ratio = (processed_data_input.avg_atr > 0.0) ? (processed_data_input.atr / processed_data_input.avg_atr) : 0.0;
+    filter_result_output.vol_ratio = (processed_data_input.avg_vol > 0.0) ? (processed_data_input.curr.volume / processed_data_input.avg_vol) : 0.0;
+    return filter_result_output;
+}
+
+using SignalDetectionFunction = SignalDecision (*)(const ProcessedData&, const SignalParameters&);
+using FilterEvaluationFunction = FilterResult (*)(const ProcessedData&, const SignalParameters&);
+
+// One entry per flag combination, indexed by the policy mask
+template <unsigned... RuleFlags>
+constexpr std::array<SignalDetectionFunction, sizeof...(RuleFlags)> make_signal_detection_table(std::integer_sequence<unsigned, RuleFlags...>) {
+    return {{&detect_signals_with_policy<SignalRulePolicy<RuleFlags>>...}};
+}
+
+template <unsigned... FilterFlags>
+constexpr std::array<FilterEvaluationFunction, sizeof...(FilterFlags)> make_filter_evaluation_table(std::integer_sequence<unsigned, FilterFlags...>) {
+    return {{&evaluate_filters_with_policy<FilterPolicy<FilterFlags>>...}};
+}
+
+constexpr auto SIGNAL_DETECTION_TABLE = make_signal_detection_table(std::make_integer_sequence<unsigned, SIGNAL_RULE_POLICY_COUNT>{});
+constexpr auto FILTER_EVALUATION_TABLE = make_filter_evaluation_table(std::make_integer_sequence<unsigned, FILTER_POLICY_COUNT>{});
+
+double regime_signal_threshold(double threshold_multiplier, const StrategyConfig& strategy_config) {
+    return strategy_config.minimum_signal_strength_threshold * (strategy_config.enable_volatility_regime_adaptation ? threshold_multiplier : 1.0);
+}
+
+} // anonymous namespace
+
+unsigned signal_rule_flags_from_config(const StrategyConfig& strategy_config) {
+    unsigned rule_flags = 0;
+    if (strategy_config.buy_signals_allow_equal_close) rule_flags |= BUY_ALLOW_EQUAL_CLOSE;
+    if (strategy_config.buy_signals_require_higher_high) rule_flags |= BUY_REQUIRE_HIGHER_HIGH;
+    if (strategy_config.buy_signals_require_higher_low) rule_flags |= BUY_REQUIRE_HIGHER_LOW;
+    if (strategy_config.sell_signals_allow_equal_close) rule_flags |= SELL_ALLOW_EQUAL_CLOSE;
+    if (strategy_config.sell_signals_require_lower_low) rule_flags |= SELL_REQUIRE_LOWER_LOW;
+    if (strategy_config.sell_signals_require_lower_high) rule_flags |= SELL_REQUIRE_LOWER_HIGH;
+    return rule_flags;
+}
+
+unsigned filter_flags_from_config(const StrategyConfig& strategy_config) {
+    unsigned filter_flags = 0;
+    if (strategy_config.use_absolute_atr_threshold) filter_flags |= USE_ABSOLUTE_ATR_THRESHOLD;
+    if (strategy_config.use_rolling_percentile_filters) filter_flags |= USE_ROLLING_PERCENTILE_FILTERS;
+    return filter_flags;
+}
+
+SignalParameters signal_parameters_from_config(const StrategyConfig& strategy_config) {
+    SignalParameters signal_parameters;
+    signal_parameters.percentage_calculation_multiplier = strategy_config.percentage_calculation_multiplier;
+    signal_parameters.volume_change_amplification = strategy_config.is_crypto_asset ? strategy_config.crypto_volume_change_amplification_factor : 1.0;
+    signal_parameters.minimum_price_change_percentage_for_momentum = strategy_config.minimum_price_change_percentage_for_momentum;
+    signal_parameters.minimum_volume_increase_percentage_for_buy_signals = strategy_config.minimum_volume_increase_percentage_for_buy_signals;
+    signal_parameters.minimum_volatility_percentage_for_buy_signals = strategy_config.minimum_volatility_percentage_for_buy_signals;
+    signal_parameters.minimum_volume_increase_percentage_for_sell_signals = strategy_config.minimum_volume_increase_percentage_for_sell_signals;
+    signal_parameters.minimum_volatility_percentage_for_sell_signals = strategy_config.minimum_volatility_percentage_for_sell_signals;
+    signal_parameters.basic_price_pattern_weight = strategy_config.basic_price_pattern_weight;
+    signal_parameters.momentum_indicator_weight = strategy_config.momentum_indicator_weight;
+    signal_parameters.volume_analysis_weight = strategy_config.volume_analysis_weight;
+    signal_parameters.volatility_analysis_weight = strategy_config.volatility_analysis_weight;
+    signal_parameters.signal_threshold_by_regime[static_cast<size_t>(VolatilityRegime::LOW)] =
+        regime_signal_threshold(strategy_config.low_volatility_signal_threshold_multiplier, strategy_config);
+    signal_parameters.signal_threshold_by_regime[static_cast<size_t>(VolatilityRegime::NORMAL)] = regime_signal_threshold(1.0, strategy_config);
+    signal_parameters.signal_threshold_by_regime[static_cast<size_t>(VolatilityRegime::HIGH)] =
+        regime_signal_threshold(strategy_config.high_volatility_signal_threshold_multiplier, strategy_config);
+    
+    signal_parameters.enable_multi_timeframe_confirmation = strategy_config.enable_multi_timeframe_confirmation;
+    signal_parameters.confirmation_timeframe_count = static_cast<int>(std::min(strategy_config.confirmation_timeframe_weights.size(),
+                                                                               static_cast<size_t>(MultiTimeframeInputs::MAXIMUM_TIMEFRAMES)));
+    signal_parameters.base_timeframe_signal_weight = strategy_config.base_timeframe_signal_weight;
+    signal_parameters.confirmation_timeframe_weights.fill(0.0);
+    for (int timeframe_index = 0; timeframe_index < signal_parameters.confirmation_timeframe_count; ++timeframe_index) {
+        signal_parameters.confirmation_timeframe_weights[timeframe_index] = strategy_config.confirmation_timeframe_weights[timeframe_index];
+    }
+    
+    signal_parameters.enable_oscillator_signals = strategy_config.enable_oscillator_signals;
+    signal_parameters.rsi_oversold_level = strategy_config.rsi_oversold_level;
+    signal_parameters.rsi_overbought_level = strategy_config.rsi_overbought_level;
+    signal_parameters.oscillator_signal_weight = strategy_config.oscillator_signal_weight;
+    
+    signal_parameters.minimum_percentile_samples = strategy_config.minimum_percentile_samples;
+    signal_parameters.minimum_atr_percentile = strategy_config.minimum_atr_percentile;
+    signal_parameters.minimum_volume_percentile = strategy_config.minimum_volume_percentile;
+    signal_parameters.atr_absolute_minimum_threshold = strategy_config.atr_absolute_minimum_threshold;
+    signal_parameters.entry_signal_atr_multiplier = strategy_config.entry_signal_atr_multiplier;
+    signal_parameters.volume_filter_multiplier = strategy_config.is_crypto_asset ? strategy_config.crypto_volume_multiplier : strategy_config.entry_signal_volume_multiplier;
+    signal_parameters.doji_candlestick_body_size_threshold_percentage = strategy_config.doji_candlestick_body_size_threshold_percentage;
+    return signal_parameters;
+}
+
+CompiledSignalLogic::CompiledSignalLogic(const StrategyConfig& strategy_config)
+    : signal_parameters(signal_parameters_from_config(strategy_config)),
+      signal_detection_function(SIGNAL_DETECTION_TABLE[signal_rule_flags_from_config(strategy_config)]),
+      filter_evaluation_function(FILTER_EVALUATION_TABLE[filter_flags_from_config(strategy_config)]) {}
+      
+} // namespace Core
+} // namespace AlpacaTrader
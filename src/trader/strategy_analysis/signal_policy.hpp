@@ -0,0 +1,116 @@
+#ifndef SIGNAL_POLICY_HPP
+#define SIGNAL_POLICY_HPP
+
+#include "configs/strategy_config.hpp"
+#include "trader/data_structures/data_structures.hpp"
+#include <array>
+
+namespace AlpacaTrader {
+namespace Core {
+
+// Strategy flags that change which comparisons the signal rules make, as bits of a policy mask
+enum SignalRuleFlag : unsigned {
+    BUY_ALLOW_EQUAL_CLOSE = 1u << 0,
+    BUY_REQUIRE_HIGHER_HIGH = 1u << 1,
+    BUY_REQUIRE_HIGHER_LOW = 1u << 2,
+    SELL_ALLOW_EQUAL_CLOSE = 1u << 3,
+    SELL_REQUIRE_LOWER_LOW = 1u << 4,
+    SELL_REQUIRE_LOWER_HIGH = 1u << 5
+};
+
+constexpr unsigned SIGNAL_RULE_POLICY_COUNT = 1u << 6;
+
+template <unsigned RuleFlags>
+struct SignalRulePolicy {
+    static constexpr bool buy_allow_equal_close = (RuleFlags & BUY_ALLOW_EQUAL_CLOSE) != 0;
+    static constexpr bool buy_require_higher_high = (RuleFlags & BUY_REQUIRE_HIGHER_HIGH) != 0;
+    static constexpr bool buy_require_higher_low = (RuleFlags & BUY_REQUIRE_HIGHER_LOW) != 0;
+    static constexpr bool sell_allow_equal_close = (RuleFlags & SELL_ALLOW_EQUAL_CLOSE) != 0;
+    static constexpr bool sell_require_lower_low = (RuleFlags & SELL_REQUIRE_LOWER_LOW) != 0;
+    static constexpr bool sell_require_lower_high = (RuleFlags & SELL_REQUIRE_LOWER_HIGH) != 0;
+};
+
+// Strategy flags that change which filter comparisons run
+enum FilterFlag : unsigned {
+    USE_ABSOLUTE_ATR_THRESHOLD = 1u << 0,
+    USE_ROLLING_PERCENTILE_FILTERS = 1u << 1
+};
+
+constexpr unsigned FILTER_POLICY_COUNT = 1u << 2;
+
+template <unsigned FilterFlags>
+struct FilterPolicy {
+    static constexpr bool use_absolute_atr_threshold = (FilterFlags & USE_ABSOLUTE_ATR_THRESHOLD) != 0;
+    static constexpr bool use_rolling_percentile_filters = (FilterFlags & USE_ROLLING_PERCENTILE_FILTERS) != 0;
+};
+
+unsigned signal_rule_flags_from_config(const StrategyConfig& strategy_config);
+unsigned filter_flags_from_config(const StrategyConfig& strategy_config);
+
+// Numbers read by the signal rules and filters, copied out of StrategyConfig once. Flags that only pick
+// a value (crypto vs stock multipliers, regime adaptation) are resolved here instead of on every call.
+struct SignalParameters {
+    // Signal rules
+    double percentage_calculation_multiplier;
+    double volume_change_amplification;              // Crypto amplification factor, 1.0 for stocks
+    double minimum_price_change_percentage_for_momentum;
+    double minimum_volume_increase_percentage_for_buy_signals;
+    double minimum_volatility_percentage_for_buy_signals;
+    double minimum_volume_increase_percentage_for_sell_signals;
+    double minimum_volatility_percentage_for_sell_signals;
+    double basic_price_pattern_weight;
+    double momentum_indicator_weight;
+    double volume_analysis_weight;
+    double volatility_analysis_weight;
+    std::array<double, 3> signal_threshold_by_regime;    // Indexed by VolatilityRegime
+    
+    // Multi-timeframe confirmation
+    bool enable_multi_timeframe_confirmation;
+    int confirmation_timeframe_count;                // Timeframes that have a configured weight
+    double base_timeframe_signal_weight;
+    std::array<double, MultiTimeframeInputs::MAXIMUM_TIMEFRAMES> confirmation_timeframe_weights;
+    
+    // Oscillator confirmation
+    bool enable_oscillator_signals;
+    double rsi_oversold_level;
+    double rsi_overbought_level;
+    double oscillator_signal_weight;
+    
+    // Filters
+    int minimum_percentile_samples;
+    double minimum_atr_percentile;
+    double minimum_volume_percentile;
+    double atr_absolute_minimum_threshold;
+    double entry_signal_atr_multiplier;
+    double volume_filter_multiplier;                 // Crypto or stock volume multiplier
+    double doji_candlestick_body_size_threshold_percentage;
+};
+
+SignalParameters signal_parameters_from_config(const StrategyConfig& strategy_config);
+
+// Signal detection and filters specialized on the strategy's boolean flags. The specialization is
+// looked up once per parameter set, so evaluating a bar runs no per-flag branches.
+class CompiledSignalLogic {
+public:
+    explicit CompiledSignalLogic(const StrategyConfig& strategy_config);
+    
+    SignalDecision detect_trading_signals(const ProcessedData& processed_data_input) const {
+        return signal_detection_function(processed_data_input, signal_parameters);
+    }
+    FilterResult evaluate_trading_filters(const ProcessedData& processed_data_input) const {
+        return filter_evaluation_function(processed_data_input, signal_parameters);
+    }
+
+private:
+    using SignalDetectionFunction = SignalDecision (*)(const ProcessedData&, const SignalParameters&);
+    using FilterEvaluationFunction = FilterResult (*)(const ProcessedData&, const SignalParameters&);
+    
+    SignalParameters signal_parameters;
+    SignalDetectionFunction signal_detection_function;
+    FilterEvaluationFunction filter_evaluation_function;
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // SIGNAL_POLICY_HPP
@@ -0,0 +1,127 @@
+#include "strategy_ensemble.hpp"
+#include <stdexcept>
+
+namespace AlpacaTrader {
+namespace Core {
+
+namespace {
+
+// A strategy only backs a side when its own filters pass
+bool backs_buy(const StrategyDecision& strategy_decision) {
+    return strategy_decision.filter_result.all_pass && strategy_decision.signal_decision.buy;
+}
+
+bool backs_sell(const StrategyDecision& strategy_decision) {
+    return strategy_decision.filter_result.all_pass && strategy_decision.signal_decision.sell;
+}
+
+} // anonymous namespace
+
+StrategyCombinerMode parse_strategy_combiner_mode(const std::string& combiner_mode_string) {
+    if (combiner_mode_string == "strongest") {
+        return StrategyCombinerMode::STRONGEST;
+    }
+    if (combiner_mode_string == "majority") {
+        return StrategyCombinerMode::MAJORITY;
+    }
+    if (combiner_mode_string == "unanimous") {
+        return StrategyCombinerMode::UNANIMOUS;
+    }
+    throw std::runtime_error("Invalid strategy combiner mode: " + combiner_mode_string + ". Must be 'strongest', 'majority' or 'unanimous'");
+}
+
+StrategyEnsemble::StrategyEnsemble(const SystemConfig& system_config)
+    : trading_strategies(), combiner_mode(StrategyCombinerMode::STRONGEST) {
+    trading_strategies.push_back(std::make_unique<RuleBasedStrategy>("primary", system_config, system_config.strategy));
+    
+    if (system_config.strategy.enable_strategy_ensemble) {
+        combiner_mode = parse_strategy_combiner_mode(system_config.strategy.strategy_combiner_mode);
+        for (const StrategyVariantConfig& strategy_variant : system_config.strategy_variants) {
+            trading_strategies.push_back(std::make_unique<RuleBasedStrategy>(strategy_variant.variant_name, system_config, strategy_variant.strategy));
+        }
+    }
+}
+
+void StrategyEnsemble::add_strategy(std::unique_ptr<TradingStrategy> trading_strategy) {
+    if (!trading_strategy) {
+        throw std::invalid_argument("Cannot add a null strategy to the ensemble");
+    }
+    trading_strategies.push_back(std::move(trading_strategy));
+}
+
+StrategyEnsembleDecision StrategyEnsemble::evaluate(const StrategyEvaluationRequest& request) const {
+    StrategyEnsembleDecision ensemble_decision;
+    ensemble_decision.strategy_decisions.reserve(trading_strategies.size());
+    for (const auto& trading_strategy : trading_strategies) {
+        ensemble_decision.strategy_decisions.push_back(trading_strategy->evaluate(request));
+    }
+    combine_decisions(ensemble_decision);
+    return ensemble_decision;
+}
+
+void StrategyEnsemble::combine_decisions(StrategyEnsembleDecision& ensemble_decision) const {
+    const std::vector<StrategyDecision>& strategy_decisions = ensemble_decision.strategy_decisions;
+    const StrategyDecision& primary_decision = strategy_decisions.front();
+    
+    if (strategy_decisions.size() == 1) {
+        ensemble_decision.signal_decision = primary_decision.signal_decision;
+        ensemble_decision.filter_result = primary_decision.filter_result;
+        ensemble_decision.position_sizing = primary_decision.position_sizing;
+        ensemble_decision.winning_strategy_name = primary_decision.strategy_name;
+        return;
+    }
+    
+    size_t buy_vote_count = 0;
+    size_t sell_vote_count = 0;
+    const StrategyDecision* strongest_buy_decision = nullptr;
+    const StrategyDecision* strongest_sell_decision = nullptr;
+    for (const StrategyDecision& strategy_decision : strategy_decisions) {
+        if (backs_buy(strategy_decision)) {
+            buy_vote_count++;
+            if (!strongest_buy_decision || strategy_decision.signal_decision.signal_strength > strongest_buy_decision->signal_decision.signal_strength) {
+                strongest_buy_decision = &strategy_decision;
+            }
+        }
+        if (backs_sell(strategy_decision)) {
+            sell_vote_count++;
+            if (!strongest_sell_decision || strategy_decision.signal_decision.signal_strength > strongest_sell_decision->signal_decision.signal_strength) {
+                strongest_sell_decision = &strategy_decision;
+            }
+        }
+    }
+    
+    const StrategyDecision* winning_decision = nullptr;
+    size_t strategy_count = strategy_decisions.size();
+    if (combiner_mode == StrategyCombinerMode::STRONGEST) {
+        winning_decision = strongest_buy_decision;
+        if (strongest_sell_decision && (!winning_decision || strongest_sell_decision->signal_decision.signal_strength > winning_decision->signal_decision.signal_strength)) {
+            winning_decision = strongest_sell_decision;
+        }
+    } else {
+        size_t required_vote_count = (combiner_mode == StrategyCombinerMode::UNANIMOUS) ? strategy_count : strategy_count / 2 + 1;
+        if (buy_vote_count >= required_vote_count && buy_vote_count > sell_vote_count) {
+            winning_decision = strongest_buy_decision;
+        } else if (sell_vote_count >= required_vote_count && sell_vote_count > buy_vote_count) {
+            winning_decision = strongest_sell_decision;
+        }
+    }
+    
+    if (winning_decision) {
+        ensemble_decision.signal_decision = winning_decision->signal_decision;
+        ensemble_decision.filter_result = winning_decision->filter_result;
+        ensemble_decision.position_sizing = winning_decision->position_sizing;
+        ensemble_decision.winning_strategy_name = winning_decision->strategy_name;
+        return;
+    }
+    
+    ensemble_decision.signal_decision = primary_decision.signal_decision;
+    ensemble_decision.signal_decision.buy = false;
+    ensemble_decision.signal_decision.sell = false;
+    ensemble_decision.signal_decision.signal_reason_flags |= SIGNAL_REASON_NO_COMBINED_DECISION;
+    ensemble_decision.filter_result = primary_decision.filter_result;
+    ensemble_decision.position_sizing = primary_decision.position_sizing;
+    ensemble_decision.winning_strategy_name.clear();
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
@@ -0,0 +1,55 @@
+#ifndef STRATEGY_ENSEMBLE_HPP
+#define STRATEGY_ENSEMBLE_HPP
+
+#include "configs/system_config.hpp"
+#include "trading_strategy.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AlpacaTrader {
+namespace Core {
+
+enum class StrategyCombinerMode {
+    STRONGEST,      // Strongest strategy whose signal passed its own filters
+    MAJORITY,       // Side backed by more than half of the strategies
+    UNANIMOUS       // Side backed by every strategy
+};
+
+StrategyCombinerMode parse_strategy_combiner_mode(const std::string& combiner_mode_string);
+
+struct StrategyEnsembleDecision {
+    // Winning strategy's signal, filters and sizing; with no winner the primary strategy's, signal cleared
+    SignalDecision signal_decision;
+    FilterResult filter_result;
+    PositionSizing position_sizing;
+    std::string winning_strategy_name;
+    std::vector<StrategyDecision> strategy_decisions;
+};
+
+// Evaluates every strategy on the same ProcessedData in one pass and arbitrates their decisions.
+// The primary strategy uses strategy_config.csv; each strategy.strategy_variants entry adds a
+// RuleBasedStrategy with its own parameters. With a single strategy its decision passes through unchanged.
+class StrategyEnsemble {
+public:
+    explicit StrategyEnsemble(const SystemConfig& system_config);
+    
+    // Extension point for strategies that are not parameter sets of the rule-based one
+    void add_strategy(std::unique_ptr<TradingStrategy> trading_strategy);
+    
+    StrategyEnsembleDecision evaluate(const StrategyEvaluationRequest& request) const;
+    
+    size_t get_strategy_count() const { return trading_strategies.size(); }
+    StrategyCombinerMode get_combiner_mode() const { return combiner_mode; }
+
+private:
+    std::vector<std::unique_ptr<TradingStrategy>> trading_strategies;
+    StrategyCombinerMode combiner_mode;
+    
+    void combine_decisions(StrategyEnsembleDecision& ensemble_decision) const;
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // STRATEGY_ENSEMBLE_HPP
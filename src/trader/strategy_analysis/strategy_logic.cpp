@@ -7,181 +7,22 @@
 namespace AlpacaTrader {
 namespace Core {
 
-// Helper function to detect doji pattern
-bool detect_doji_pattern(double open, double high, double low, double close, double doji_threshold) {
-    double body_size = std::abs(close - open);
-    double total_range = high - low;
-    
-    if (total_range == 0.0) return false; // Avoid division by zero
-    
-    // Doji if body is less than threshold% of total range
-    return (body_size / total_range) < doji_threshold;
-}
+namespace {
 
-SignalDecision detect_trading_signals(const ProcessedData& processed_data_input, const SystemConfig& system_config) {
-    SignalDecision signal_decision_result;
-    
-    // Calculate momentum indicators for better signal detection
-    double price_change_amount = processed_data_input.curr.close_price - processed_data_input.prev.close_price;
-    double price_change_percentage = (processed_data_input.prev.close_price > 0.0) ? (price_change_amount / processed_data_input.prev.close_price) * system_config.strategy.percentage_calculation_multiplier : 0.0;
-    
-    // Calculate volume momentum with crypto-specific handling
-    double volume_change_amount = processed_data_input.curr.volume - processed_data_input.prev.volume;
-    double volume_change_percentage = (processed_data_input.prev.volume > 0) ? (volume_change_amount / processed_data_input.prev.volume) * system_config.strategy.percentage_calculation_multiplier : 0.0;
-    
-    // For crypto: normalize volume change percentage to be more sensitive to small changes
-    if (system_config.strategy.is_crypto_asset) {
-        // Crypto volumes are much smaller, so amplify the percentage for better signal detection
-        volume_change_percentage *= system_config.strategy.crypto_volume_change_amplification_factor;
+double volatility_regime_position_size_multiplier(VolatilityRegime volatility_regime, const StrategyConfig& strategy_config) {
+    if (!strategy_config.enable_volatility_regime_adaptation) {
+        return 1.0;
     }
-    
-    // Calculate volatility (ATR-based)
-    double volatility_percentage = (processed_data_input.prev.close_price > 0.0) ? (processed_data_input.atr / processed_data_input.prev.close_price) * system_config.strategy.percentage_calculation_multiplier : 0.0;
-    
-    // Enhanced BUY signal conditions with momentum confirmation
-    bool basic_buy_close_condition = system_config.strategy.buy_signals_allow_equal_close ? 
-                          (processed_data_input.curr.close_price >= processed_data_input.curr.open_price) : 
-                          (processed_data_input.curr.close_price > processed_data_input.curr.open_price);
-    
-    bool buy_high_condition_result = system_config.strategy.buy_signals_require_higher_high ? 
-                             (processed_data_input.curr.high_price > processed_data_input.prev.high_price) : 
-                             true;
-    
-    bool buy_low_condition_result = system_config.strategy.buy_signals_require_higher_low ? 
-                            (processed_data_input.curr.low_price >= processed_data_input.prev.low_price) : 
-                            true;
-    
-    // Momentum-based buy confirmation (configurable thresholds)
-    bool momentum_buy_signal = price_change_percentage > system_config.strategy.minimum_price_change_percentage_for_momentum;
-    bool volume_confirmation_result = volume_change_percentage > system_config.strategy.minimum_volume_increase_percentage_for_buy_signals;
-    bool volatility_adequate_result = volatility_percentage > system_config.strategy.minimum_volatility_percentage_for_buy_signals;
-    
-    // Calculate signal strength and reasoning
-    double buy_strength_value = 0.0;
-    std::string buy_reason_string = "";
-    
-    if (basic_buy_close_condition && buy_high_condition_result && buy_low_condition_result) {
-        buy_strength_value += system_config.strategy.basic_price_pattern_weight; // Basic pattern strength
-        buy_reason_string += "Basic pattern OK; ";
-        
-        if (momentum_buy_signal) {
-            buy_strength_value += system_config.strategy.momentum_indicator_weight; // Momentum strength
-            buy_reason_string += "Momentum OK; ";
-        } else {
-            buy_reason_string += "No momentum; ";
-        }
-        
-        if (volume_confirmation_result) {
-            buy_strength_value += system_config.strategy.volume_analysis_weight; // Volume confirmation
-            buy_reason_string += "Volume OK; ";
-        } else {
-            buy_reason_string += "Low volume; ";
-        }
-        
-        if (volatility_adequate_result) {
-            buy_strength_value += system_config.strategy.volatility_analysis_weight; // Volatility confirmation
-            buy_reason_string += "Volatility OK; ";
-        } else {
-            buy_reason_string += "Low volatility; ";
-        }
-    } else {
-        buy_reason_string = "Basic pattern failed";
+    if (volatility_regime == VolatilityRegime::HIGH) {
+        return strategy_config.high_volatility_position_size_multiplier;
     }
-    
-    // Set buy signal if strength is above threshold
-    signal_decision_result.buy = buy_strength_value >= system_config.strategy.minimum_signal_strength_threshold;
-    signal_decision_result.signal_strength = buy_strength_value;
-    signal_decision_result.signal_reason = buy_reason_string;
-    
-    // Enhanced SELL signal conditions with momentum confirmation
-    bool basic_sell_close_condition = system_config.strategy.sell_signals_allow_equal_close ? 
-                           (processed_data_input.curr.close_price <= processed_data_input.curr.open_price) : 
-                           (processed_data_input.curr.close_price < processed_data_input.curr.open_price);
-    
-    bool sell_low_condition_result = system_config.strategy.sell_signals_require_lower_low ? 
-                             (processed_data_input.curr.low_price < processed_data_input.prev.low_price) : 
-                             true;
-    
-    bool sell_high_condition_result = system_config.strategy.sell_signals_require_lower_high ? 
-                              (processed_data_input.curr.high_price <= processed_data_input.prev.high_price) : 
-                              true;
-    
-    // Momentum-based sell confirmation (configurable thresholds)
-    bool momentum_sell_signal = price_change_percentage < -system_config.strategy.minimum_price_change_percentage_for_momentum;
-    bool volume_sell_confirmation_result = volume_change_percentage > system_config.strategy.minimum_volume_increase_percentage_for_sell_signals;
-    bool volatility_sell_adequate_result = volatility_percentage > system_config.strategy.minimum_volatility_percentage_for_sell_signals;
-    
-    // Calculate sell signal strength and reasoning
-    double sell_strength_value = 0.0;
-    std::string sell_reason_string = "";
-    
-    if (basic_sell_close_condition && sell_low_condition_result && sell_high_condition_result) {
-        sell_strength_value += system_config.strategy.basic_price_pattern_weight; // Basic pattern strength
-        sell_reason_string += "Basic pattern OK; ";
-        
-        if (momentum_sell_signal) {
-            sell_strength_value += system_config.strategy.momentum_indicator_weight; // Momentum strength
-            sell_reason_string += "Momentum OK; ";
-        } else {
-            sell_reason_string += "No momentum; ";
-        }
-        
-        if (volume_sell_confirmation_result) {
-            sell_strength_value += system_config.strategy.volume_analysis_weight; // Volume confirmation
-            sell_reason_string += "Volume OK; ";
-        } else {
-            sell_reason_string += "Low volume; ";
-        }
-        
-        if (volatility_sell_adequate_result) {
-            sell_strength_value += system_config.strategy.volatility_analysis_weight; // Volatility confirmation
-            sell_reason_string += "Volatility OK; ";
-        } else {
-            sell_reason_string += "Low volatility; ";
-        }
-    } else {
-        sell_reason_string = "Basic pattern failed";
-    }
-    
-    // Set sell signal if strength is above threshold
-    signal_decision_result.sell = sell_strength_value >= system_config.strategy.minimum_signal_strength_threshold;
-    
-    // Update signal strength and reason (use the stronger signal)
-    if (sell_strength_value > signal_decision_result.signal_strength) {
-        signal_decision_result.signal_strength = sell_strength_value;
-        signal_decision_result.signal_reason = sell_reason_string;
+    if (volatility_regime == VolatilityRegime::LOW) {
+        return strategy_config.low_volatility_position_size_multiplier;
     }
-    
-    return signal_decision_result;
+    return 1.0;
 }
 
-FilterResult evaluate_trading_filters(const ProcessedData& processed_data_input, const SystemConfig& system_config) {
-    FilterResult filter_result_output;
-    
-    // ATR filter: use absolute threshold if enabled, otherwise use relative threshold
-    if (system_config.strategy.use_absolute_atr_threshold) {
-        filter_result_output.atr_pass = processed_data_input.atr > system_config.strategy.atr_absolute_minimum_threshold;
-    } else {
-        filter_result_output.atr_pass = processed_data_input.atr > system_config.strategy.entry_signal_atr_multiplier * processed_data_input.avg_atr;
-    }
-    
-    // Crypto-specific volume filtering: use different thresholds for crypto vs stocks
-    if (system_config.strategy.is_crypto_asset) {
-        // For crypto: use crypto-specific volume multiplier for fractional volumes
-        double crypto_volume_threshold = system_config.strategy.crypto_volume_multiplier * processed_data_input.avg_vol;
-        filter_result_output.vol_pass = processed_data_input.curr.volume > crypto_volume_threshold;
-        
-    } else {
-        // For stocks: use original volume multiplier
-        filter_result_output.vol_pass = processed_data_input.curr.volume > system_config.strategy.entry_signal_volume_multiplier * processed_data_input.avg_vol;
-    }
-    
-    filter_result_output.doji_pass = !detect_doji_pattern(processed_data_input.curr.open_price, processed_data_input.curr.high_price, processed_data_input.curr.low_price, processed_data_input.curr.close_price, system_config.strategy.doji_candlestick_body_size_threshold_percentage);
-    filter_result_output.all_pass = filter_result_output.atr_pass && filter_result_output.vol_pass && filter_result_output.doji_pass;
-    filter_result_output.atr_ratio = (processed_data_input.avg_atr > 0.0) ? (processed_data_input.atr / processed_data_input.avg_atr) : 0.0;
-    filter_result_output.vol_ratio = (processed_data_input.avg_vol > 0.0) ? (processed_data_input.curr.volume / processed_data_input.avg_vol) : 0.0;
-    return filter_result_output;
-}
+} // anonymous namespace
 
 /**
  * @brief Calculate position size with multiple risk constraints
@@ -237,6 +78,7 @@ PositionSizing calculate_position_sizing(const PositionSizingRequest& request) {
         if (request.strategy_configuration.enable_risk_based_position_multiplier) {
             sizing.quantity *= request.strategy_configuration.risk_based_position_size_multiplier;
         }
+        sizing.quantity *= volatility_regime_position_size_multiplier(request.processed_data.volatility_regime, request.strategy_configuration);
         
         sizing.quantity = std::max(1.0, sizing.quantity);
         return sizing;
@@ -252,6 +94,9 @@ PositionSizing calculate_position_sizing(const PositionSizingRequest& request) {
         sizing.size_multiplier *= request.strategy_configuration.risk_based_position_size_multiplier;
     }
     
+    // Scale down in turbulent regimes (and optionally up in calm ones)
+    sizing.size_multiplier *= volatility_regime_position_size_multiplier(request.processed_data.volatility_regime, request.strategy_configuration);
+    
     double equity_based_qty = 0.0;
     if (risk_per_share > 0.0 && total_risk_budget > 0.0 && sizing.size_multiplier > 0.0) {
         if (is_crypto_mode) {
@@ -389,25 +234,6 @@ ExitTargets compute_exit_targets(const ExitTargetsRequest& request) {
     return targets;
 }
 
-std::pair<PositionSizing, SignalDecision> process_position_sizing(const PositionSizingProcessRequest& request) {
-    PositionSizing sizing = calculate_position_sizing(PositionSizingRequest(
-        request.processed_data, request.account_equity, request.current_position_quantity, 
-        request.strategy_configuration, request.available_buying_power, request.trading_mode_configuration
-    ));
-
-    SystemConfig temp_system_config;
-    temp_system_config.strategy = request.strategy_configuration;
-    temp_system_config.trading_mode = request.trading_mode_configuration;
-    
-    if (!evaluate_trading_filters(request.processed_data, temp_system_config).all_pass) {
-        return {sizing, SignalDecision{}};
-    }
-
-    SignalDecision signal_decision_result = detect_trading_signals(request.processed_data, temp_system_config);
-
-    return {sizing, signal_decision_result};
-}
-
 } // namespace Core
 } // namespace AlpacaTrader
 
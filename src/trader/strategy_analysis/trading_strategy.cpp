@@ -0,0 +1,25 @@
+#include "trading_strategy.hpp"
+#include "strategy_logic.hpp"
+
+namespace AlpacaTrader {
+namespace Core {
+
+RuleBasedStrategy::RuleBasedStrategy(const std::string& strategy_name_value, const SystemConfig& base_system_config, const StrategyConfig& strategy_parameters)
+    : strategy_name(strategy_name_value), strategy_system_config(base_system_config), compiled_signal_logic(strategy_parameters) {
+    strategy_system_config.strategy = strategy_parameters;
+}
+
+StrategyDecision RuleBasedStrategy::evaluate(const StrategyEvaluationRequest& request) const {
+    StrategyDecision strategy_decision;
+    strategy_decision.strategy_name = strategy_name;
+    strategy_decision.signal_decision = compiled_signal_logic.detect_trading_signals(request.processed_data);
+    strategy_decision.filter_result = compiled_signal_logic.evaluate_trading_filters(request.processed_data);
+    strategy_decision.position_sizing = calculate_position_sizing(PositionSizingRequest(
+        request.processed_data, request.account_equity, request.current_position_quantity,
+        strategy_system_config.strategy, request.available_buying_power, strategy_system_config.trading_mode
+    ));
+    return strategy_decision;
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
@@ -0,0 +1,62 @@
+#ifndef TRADING_STRATEGY_HPP
+#define TRADING_STRATEGY_HPP
+
+#include "configs/system_config.hpp"
+#include "trader/data_structures/data_structures.hpp"
+#include "trader/strategy_analysis/signal_policy.hpp"
+#include <string>
+
+namespace AlpacaTrader {
+namespace Core {
+
+using AlpacaTrader::Config::SystemConfig;
+
+// Inputs shared by every strategy evaluated in one cycle
+struct StrategyEvaluationRequest {
+    const ProcessedData& processed_data;
+    double account_equity;
+    int current_position_quantity;
+    double available_buying_power;
+    
+    StrategyEvaluationRequest(const ProcessedData& data, double equity, int current_position_qty, double buying_power)
+        : processed_data(data), account_equity(equity), current_position_quantity(current_position_qty),
+          available_buying_power(buying_power) {}
+};
+
+// One strategy's independent decision on the shared data
+struct StrategyDecision {
+    std::string strategy_name;
+    SignalDecision signal_decision;
+    FilterResult filter_result;
+    PositionSizing position_sizing;
+};
+
+// Strategies only read the request and their own parameters, so one instance may be evaluated
+// for several symbols at once
+class TradingStrategy {
+public:
+    virtual ~TradingStrategy() = default;
+    
+    virtual const std::string& get_strategy_name() const = 0;
+    virtual StrategyDecision evaluate(const StrategyEvaluationRequest& request) const = 0;
+};
+
+// The configured signal rules, filters and position sizing under one parameter set. The signal and
+// filter specialization for the parameter set's flags is picked at construction.
+class RuleBasedStrategy : public TradingStrategy {
+public:
+    RuleBasedStrategy(const std::string& strategy_name_value, const SystemConfig& base_system_config, const StrategyConfig& strategy_parameters);
+    
+    const std::string& get_strategy_name() const override { return strategy_name; }
+    StrategyDecision evaluate(const StrategyEvaluationRequest& request) const override;
+
+private:
+    std::string strategy_name;
+    SystemConfig strategy_system_config;
+    CompiledSignalLogic compiled_signal_logic;
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // TRADING_STRATEGY_HPP
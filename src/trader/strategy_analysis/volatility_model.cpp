@@ -0,0 +1,374 @@
+#include "volatility_model.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace AlpacaTrader {
+namespace Core {
+
+namespace {
+
+const double DEFAULT_GARCH_ALPHA = 0.05;
+const double DEFAULT_GARCH_BETA = 0.90;
+const double MAXIMUM_GARCH_PERSISTENCE = 0.999;
+const size_t MINIMUM_RETURNS_FOR_REGIME = 30;
+const size_t MINIMUM_RETURNS_FOR_FIT = 50;
+const double VARIANCE_FLOOR = 1e-20;
+
+// Negative Gaussian log-likelihood (constants dropped) of GARCH(1,1) with omega = sample_variance * (1 - alpha - beta)
+double garch_negative_log_likelihood(const std::vector<double>& log_returns, double sample_variance, double alpha, double beta) {
+    double omega = sample_variance * (1.0 - alpha - beta);
+    double conditional_variance = sample_variance;
+    double negative_log_likelihood = 0.0;
+    for (double log_return : log_returns) {
+        double bounded_variance = std::max(conditional_variance, VARIANCE_FLOOR);
+        double squared_return = log_return * log_return;
+        negative_log_likelihood += std::log(bounded_variance) + squared_return / bounded_variance;
+        conditional_variance = omega + alpha * squared_return + beta * conditional_variance;
+    }
+    return negative_log_likelihood;
+}
+
+bool is_valid_garch_point(double alpha, double persistence) {
+    return alpha > 0.0 && alpha < persistence && persistence < MAXIMUM_GARCH_PERSISTENCE;
+}
+
+} // anonymous namespace
+
+const char* volatility_regime_name(VolatilityRegime volatility_regime) {
+    switch (volatility_regime) {
+        case VolatilityRegime::LOW:
+            return "LOW";
+        case VolatilityRegime::HIGH:
+            return "HIGH";
+        case VolatilityRegime::NORMAL:
+        default:
+            return "NORMAL";
+    }
+}
+
+GarchParameters fit_garch_parameters(const std::vector<double>& log_returns) {
+    double squared_return_sum = 0.0;
+    for (double log_return : log_returns) {
+        squared_return_sum += log_return * log_return;
+    }
+    double sample_variance = log_returns.empty() ? 0.0 : squared_return_sum / static_cast<double>(log_returns.size());
+
+    GarchParameters fitted_parameters;
+    fitted_parameters.alpha = DEFAULT_GARCH_ALPHA;
+    fitted_parameters.beta = DEFAULT_GARCH_BETA;
+    fitted_parameters.omega = sample_variance * (1.0 - DEFAULT_GARCH_ALPHA - DEFAULT_GARCH_BETA);
+    if (log_returns.size() < MINIMUM_RETURNS_FOR_FIT || sample_variance <= VARIANCE_FLOOR) {
+        return fitted_parameters;
+    }
+
+    // Coarse grid over (alpha, alpha + beta), then a shrinking pattern search around the best point
+    const double persistence_grid[] = {0.80, 0.85, 0.90, 0.93, 0.95, 0.97, 0.98, 0.99, 0.995};
+    double best_alpha = DEFAULT_GARCH_ALPHA;
+    double best_persistence = DEFAULT_GARCH_ALPHA + DEFAULT_GARCH_BETA;
+    double best_objective = garch_negative_log_likelihood(log_returns, sample_variance, best_alpha, best_persistence - best_alpha);
+    for (double persistence_value : persistence_grid) {
+        for (double alpha_value = 0.02; alpha_value <= 0.30 + 1e-9; alpha_value += 0.02) {
+            if (!is_valid_garch_point(alpha_value, persistence_value)) {
+                continue;
+            }
+            double objective_value = garch_negative_log_likelihood(log_returns, sample_variance, alpha_value, persistence_value - alpha_value);
+            if (objective_value < best_objective) {
+                best_objective = objective_value;
+                best_alpha = alpha_value;
+                best_persistence = persistence_value;
+            }
+        }
+    }
+
+    double alpha_step = 0.01;
+    double persistence_step = 0.005;
+    for (int refinement_round = 0; refinement_round < 8; ++refinement_round) {
+        bool improved = false;
+        const double candidate_offsets[4][2] = {{alpha_step, 0.0}, {-alpha_step, 0.0}, {0.0, persistence_step}, {0.0, -persistence_step}};
+        for (const auto& candidate_offset : candidate_offsets) {
+            double candidate_alpha = best_alpha + candidate_offset[0];
+            double candidate_persistence = best_persistence + candidate_offset[1];
+            if (!is_valid_garch_point(candidate_alpha, candidate_persistence)) {
+                continue;
+            }
+            double objective_value = garch_negative_log_likelihood(log_returns, sample_variance, candidate_alpha, candidate_persistence - candidate_alpha);
+            if (objective_value < best_objective) {
+                best_objective = objective_value;
+                best_alpha = candidate_alpha;
+                best_persistence = candidate_persistence;
+                improved = true;
+            }
+        }
+        if (!improved) {
+            alpha_step *= 0.5;
+            persistence_step *= 0.5;
+        }
+    }
+
+    fitted_parameters.alpha = best_alpha;
+    fitted_parameters.beta = best_persistence - best_alpha;
+    fitted_parameters.omega = sample_variance * (1.0 - best_persistence);
+    return fitted_parameters;
+}
+
+GarchRefitSlot::GarchRefitSlot(size_t sample_capacity, GarchRefitWorker* owner_worker_pointer)
+    : owner_worker(owner_worker_pointer),
+      slot_mutex(),
+      pending_returns(sample_capacity, 0.0),
+      pending_return_count(0),
+      has_pending_returns(false),
+      fitted_parameters{0.0, DEFAULT_GARCH_ALPHA, DEFAULT_GARCH_BETA},
+      fitted_generation(0) {}
+
+bool GarchRefitSlot::submit_returns(const std::vector<double>& return_ring, size_t oldest_index, size_t count) {
+    {
+        std::lock_guard<std::mutex> slot_guard(slot_mutex);
+        if (has_pending_returns || return_ring.empty()) {
+            return false;
+        }
+
+        pending_return_count = std::min(count, pending_returns.size());
+        for (size_t return_offset = 0; return_offset < pending_return_count; ++return_offset) {
+            pending_returns[return_offset] = return_ring[(oldest_index + return_offset) % return_ring.size()];
+        }
+        has_pending_returns = true;
+    }
+
+    if (owner_worker) {
+        owner_worker->wake_worker();
+    }
+    return true;
+}
+
+bool GarchRefitSlot::take_pending_returns(std::vector<double>& returns_output) {
+    std::lock_guard<std::mutex> slot_guard(slot_mutex);
+    if (!has_pending_returns) {
+        return false;
+    }
+
+    returns_output.assign(pending_returns.begin(), pending_returns.begin() + static_cast<std::ptrdiff_t>(pending_return_count));
+    has_pending_returns = false;
+    return true;
+}
+
+void GarchRefitSlot::publish_parameters(const GarchParameters& fitted_parameters_value) {
+    std::lock_guard<std::mutex> slot_guard(slot_mutex);
+    fitted_parameters = fitted_parameters_value;
+    fitted_generation.fetch_add(1, std::memory_order_release);
+}
+
+GarchParameters GarchRefitSlot::get_fitted_parameters() const {
+    std::lock_guard<std::mutex> slot_guard(slot_mutex);
+    return fitted_parameters;
+}
+
+GarchRefitWorker::GarchRefitWorker()
+    : worker_running_flag(false),
+      worker_thread(),
+      worker_mutex(),
+      worker_condition(),
+      wake_requested(false),
+      registered_slots() {}
+
+GarchRefitWorker::~GarchRefitWorker() {
+    stop();
+}
+
+std::shared_ptr<GarchRefitSlot> GarchRefitWorker::create_slot(size_t sample_capacity) {
+    std::shared_ptr<GarchRefitSlot> refit_slot = std::make_shared<GarchRefitSlot>(sample_capacity, this);
+
+    std::lock_guard<std::mutex> worker_guard(worker_mutex);
+    registered_slots.push_back(refit_slot);
+    if (!worker_running_flag.exchange(true)) {
+        worker_thread = std::thread(&GarchRefitWorker::refit_loop_worker, this);
+    }
+    return refit_slot;
+}
+
+void GarchRefitWorker::wake_worker() {
+    {
+        std::lock_guard<std::mutex> worker_guard(worker_mutex);
+        wake_requested = true;
+    }
+    worker_condition.notify_one();
+}
+
+void GarchRefitWorker::stop() {
+    {
+        std::lock_guard<std::mutex> worker_guard(worker_mutex);
+        if (!worker_running_flag.exchange(false)) {
+            return;
+        }
+    }
+    worker_condition.notify_one();
+
+    if (worker_thread.joinable()) {
+        worker_thread.join();
+    }
+}
+
+void GarchRefitWorker::refit_loop_worker() {
+    std::vector<std::shared_ptr<GarchRefitSlot>> slots_to_scan;
+    std::vector<double> refit_returns;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> worker_lock(worker_mutex);
+            worker_condition.wait(worker_lock, [this]() { return wake_requested || !worker_running_flag.load(); });
+            if (!worker_running_flag.load()) {
+                return;
+            }
+            wake_requested = false;
+            slots_to_scan = registered_slots;
+        }
+
+        for (const std::shared_ptr<GarchRefitSlot>& refit_slot : slots_to_scan) {
+            try {
+                if (refit_slot->take_pending_returns(refit_returns)) {
+                    refit_slot->publish_parameters(fit_garch_parameters(refit_returns));
+                }
+            } catch (...) {
+                // A failed refit keeps the previous parameters
+            }
+        }
+    }
+}
+
+VolatilityRegimeStage::VolatilityRegimeStage(const VolatilityRegimeSettings& regime_settings_value, std::shared_ptr<GarchRefitSlot> refit_slot)
+    : regime_settings(regime_settings_value),
+      garch_refit_slot(std::move(refit_slot)),
+      garch_parameters{0.0, DEFAULT_GARCH_ALPHA, DEFAULT_GARCH_BETA},
+      garch_parameters_fitted(false),
+      adopted_fit_generation(0),
+      ewma_variance(0.0),
+      garch_variance(0.0),
+      squared_return_sum(0.0),
+      return_count(0),
+      volatility_ratio(1.0),
+      current_regime(VolatilityRegime::NORMAL),
+      return_ring(regime_settings_value.refit_window_length > 0 ? static_cast<size_t>(regime_settings_value.refit_window_length) : 1, 0.0),
+      ring_oldest_index(0),
+      ring_count(0),
+      bars_since_refit_request(0) {}
+
+void VolatilityRegimeStage::reset() {
+    // Fitted parameters describe the instrument, not this particular history, so they survive a rewind
+    ewma_variance = 0.0;
+    garch_variance = 0.0;
+    squared_return_sum = 0.0;
+    return_count = 0;
+    volatility_ratio = 1.0;
+    current_regime = VolatilityRegime::NORMAL;
+    ring_oldest_index = 0;
+    ring_count = 0;
+    bars_since_refit_request = 0;
+}
+
+void VolatilityRegimeStage::commit(const IndicatorBarInput& closed_bar) {
+    adopt_fitted_parameters();
+
+    if (!closed_bar.has_previous_close || closed_bar.previous_close_price <= 0.0 || closed_bar.close_price <= 0.0) {
+        return;
+    }
+
+    double log_return = std::log(closed_bar.close_price / closed_bar.previous_close_price);
+    double squared_return = log_return * log_return;
+
+    squared_return_sum += squared_return;
+    return_count++;
+    if (return_count == 1) {
+        ewma_variance = squared_return;
+        garch_variance = squared_return;
+    } else {
+        ewma_variance = regime_settings.ewma_decay * ewma_variance + (1.0 - regime_settings.ewma_decay) * squared_return;
+        double garch_omega = garch_parameters_fitted ? garch_parameters.omega
+                                                     : long_run_variance() * (1.0 - garch_parameters.alpha - garch_parameters.beta);
+        garch_variance = garch_omega + garch_parameters.alpha * squared_return + garch_parameters.beta * garch_variance;
+    }
+
+    if (ring_count < return_ring.size()) {
+        return_ring[(ring_oldest_index + ring_count) % return_ring.size()] = log_return;
+        ring_count++;
+    } else {
+        return_ring[ring_oldest_index] = log_return;
+        ring_oldest_index = (ring_oldest_index + 1) % return_ring.size();
+    }
+
+    bars_since_refit_request++;
+    if (garch_refit_slot && ring_count == return_ring.size() && bars_since_refit_request >= regime_settings.refit_interval_bars) {
+        if (garch_refit_slot->submit_returns(return_ring, ring_oldest_index, ring_count)) {
+            bars_since_refit_request = 0;
+        }
+    }
+
+    classify_regime();
+}
+
+VolatilityRegimeReading VolatilityRegimeStage::read(const IndicatorReadContext& /*context*/) const {
+    VolatilityRegimeReading regime_reading;
+    regime_reading.ewma_volatility = std::sqrt(ewma_variance);
+    regime_reading.garch_volatility = std::sqrt(std::max(garch_variance, 0.0));
+    regime_reading.long_run_volatility = std::sqrt(std::max(long_run_variance(), 0.0));
+    regime_reading.volatility_ratio = volatility_ratio;
+    regime_reading.regime = current_regime;
+    regime_reading.garch_parameters_fitted = garch_parameters_fitted;
+    return regime_reading;
+}
+
+void VolatilityRegimeStage::adopt_fitted_parameters() {
+    if (!garch_refit_slot) {
+        return;
+    }
+
+    uint64_t published_generation = garch_refit_slot->get_fitted_generation();
+    if (published_generation != adopted_fit_generation) {
+        garch_parameters = garch_refit_slot->get_fitted_parameters();
+        garch_parameters_fitted = true;
+        adopted_fit_generation = published_generation;
+    }
+}
+
+double VolatilityRegimeStage::long_run_variance() const {
+    double persistence = garch_parameters.alpha + garch_parameters.beta;
+    if (garch_parameters_fitted && persistence < 1.0) {
+        return garch_parameters.omega / (1.0 - persistence);
+    }
+    return return_count > 0 ? squared_return_sum / static_cast<double>(return_count) : 0.0;
+}
+
+void VolatilityRegimeStage::classify_regime() {
+    double long_run_variance_value = long_run_variance();
+    if (return_count < MINIMUM_RETURNS_FOR_REGIME || long_run_variance_value <= VARIANCE_FLOOR) {
+        volatility_ratio = 1.0;
+        current_regime = VolatilityRegime::NORMAL;
+        return;
+    }
+
+    volatility_ratio = std::sqrt(std::max(garch_variance, 0.0) / long_run_variance_value);
+
+    // Entering HIGH or LOW needs the threshold; leaving needs the ratio back inside by the hysteresis band
+    switch (current_regime) {
+        case VolatilityRegime::HIGH:
+            if (volatility_ratio < regime_settings.high_regime_ratio - regime_settings.hysteresis_band) {
+                current_regime = volatility_ratio <= regime_settings.low_regime_ratio ? VolatilityRegime::LOW : VolatilityRegime::NORMAL;
+            }
+            break;
+        case VolatilityRegime::LOW:
+            if (volatility_ratio > regime_settings.low_regime_ratio + regime_settings.hysteresis_band) {
+                current_regime = volatility_ratio >= regime_settings.high_regime_ratio ? VolatilityRegime::HIGH : VolatilityRegime::NORMAL;
+            }
+            break;
+        case VolatilityRegime::NORMAL:
+        default:
+            if (volatility_ratio >= regime_settings.high_regime_ratio) {
+                current_regime = VolatilityRegime::HIGH;
+            } else if (volatility_ratio <= regime_settings.low_regime_ratio) {
+                current_regime = VolatilityRegime::LOW;
+            }
+            break;
+    }
+}
+
+} // namespace Core
+} // namespace AlpacaTrader
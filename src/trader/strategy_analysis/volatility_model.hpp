@@ -0,0 +1,140 @@
+#ifndef VOLATILITY_MODEL_HPP
+#define VOLATILITY_MODEL_HPP
+
+#include "trader/data_structures/data_structures.hpp"
+#include "trader/strategy_analysis/indicator_pipeline.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace AlpacaTrader {
+namespace Core {
+
+const char* volatility_regime_name(VolatilityRegime volatility_regime);
+
+// h(t+1) = omega + alpha * r(t)^2 + beta * h(t), on per-bar log returns
+struct GarchParameters {
+    double omega;
+    double alpha;
+    double beta;
+};
+
+// Gaussian quasi-maximum-likelihood GARCH(1,1) fit with variance targeting (grid search plus pattern refinement).
+// Runs in O(grid size * returns); meant for the refit worker, never for the trader cycle.
+GarchParameters fit_garch_parameters(const std::vector<double>& log_returns);
+
+class GarchRefitWorker;
+
+// Hand-off point between one volatility stage and the refit worker.
+// The market data side only copies into a buffer sized at construction and reads an atomic generation,
+// so submitting returns and adopting refit parameters never allocate or wait on a fit.
+class GarchRefitSlot {
+public:
+    GarchRefitSlot(size_t sample_capacity, GarchRefitWorker* owner_worker);
+
+    // Copies count returns from a ring starting at oldest_index; false while the previous batch is still queued
+    bool submit_returns(const std::vector<double>& return_ring, size_t oldest_index, size_t count);
+    // Worker side: moves the queued batch into returns_output
+    bool take_pending_returns(std::vector<double>& returns_output);
+    void publish_parameters(const GarchParameters& fitted_parameters_value);
+
+    uint64_t get_fitted_generation() const { return fitted_generation.load(std::memory_order_acquire); }
+    GarchParameters get_fitted_parameters() const;
+
+private:
+    GarchRefitWorker* owner_worker;
+    mutable std::mutex slot_mutex;
+    std::vector<double> pending_returns;
+    size_t pending_return_count;
+    bool has_pending_returns;
+    GarchParameters fitted_parameters;
+    std::atomic<uint64_t> fitted_generation;
+};
+
+// Background thread that refits GARCH parameters for every registered slot.
+// The thread starts with the first slot and sleeps until a slot submits returns.
+class GarchRefitWorker {
+public:
+    GarchRefitWorker();
+    ~GarchRefitWorker();
+
+    GarchRefitWorker(const GarchRefitWorker&) = delete;
+    GarchRefitWorker& operator=(const GarchRefitWorker&) = delete;
+
+    std::shared_ptr<GarchRefitSlot> create_slot(size_t sample_capacity);
+    void wake_worker();
+    void stop();
+
+private:
+    std::atomic<bool> worker_running_flag;
+    std::thread worker_thread;
+    std::mutex worker_mutex;
+    std::condition_variable worker_condition;
+    bool wake_requested;
+    std::vector<std::shared_ptr<GarchRefitSlot>> registered_slots;
+
+    void refit_loop_worker();
+};
+
+struct VolatilityRegimeSettings {
+    double ewma_decay;              // RiskMetrics-style lambda for the EWMA variance
+    int refit_window_length;        // Returns handed to each background refit
+    int refit_interval_bars;        // Closed bars between refit requests
+    double high_regime_ratio;       // GARCH / long-run volatility ratio that enters HIGH
+    double low_regime_ratio;        // Ratio that enters LOW
+    double hysteresis_band;         // Ratio distance back inside a threshold before leaving HIGH or LOW
+};
+
+struct VolatilityRegimeReading {
+    double ewma_volatility;         // Per-bar log-return volatility
+    double garch_volatility;        // One-bar-ahead GARCH(1,1) forecast
+    double long_run_volatility;
+    double volatility_ratio;        // garch_volatility / long_run_volatility
+    VolatilityRegime regime;
+    bool garch_parameters_fitted;
+};
+
+// Pipeline stage: EWMA and GARCH(1,1) variance recursions on closed-bar log returns, O(1) per bar.
+// Until the first background fit lands the GARCH recursion uses default persistence and targets the running
+// mean squared return. The regime only changes on closed bars, so a forming bar cannot make it flicker.
+class VolatilityRegimeStage {
+public:
+    VolatilityRegimeStage(const VolatilityRegimeSettings& regime_settings_value, std::shared_ptr<GarchRefitSlot> refit_slot);
+
+    void reset();
+    void commit(const IndicatorBarInput& closed_bar);
+    VolatilityRegimeReading read(const IndicatorReadContext& context) const;
+
+private:
+    VolatilityRegimeSettings regime_settings;
+    std::shared_ptr<GarchRefitSlot> garch_refit_slot;
+    GarchParameters garch_parameters;
+    bool garch_parameters_fitted;
+    uint64_t adopted_fit_generation;
+
+    double ewma_variance;
+    double garch_variance;
+    double squared_return_sum;
+    size_t return_count;
+    double volatility_ratio;
+    VolatilityRegime current_regime;
+
+    std::vector<double> return_ring;
+    size_t ring_oldest_index;
+    size_t ring_count;
+    int bars_since_refit_request;
+
+    void adopt_fitted_parameters();
+    double long_run_variance() const;
+    void classify_regime();
+};
+
+} // namespace Core
+} // namespace AlpacaTrader
+
+#endif // VOLATILITY_MODEL_HPP
@@ -18,6 +18,10 @@ OrderExecutionLogic::OrderExecutionLogic(const OrderExecutionLogicConstructionPa
       config(construction_params.system_config), data_sync_ptr(construction_params.data_sync_ptr) {}
 
 void OrderExecutionLogic::execute_trade(const ProcessedData& processed_data_input, int current_position_quantity, const PositionSizing& position_sizing_input, const SignalDecision& signal_decision_input) {
+    execute_trade_for_symbol(config.trading_mode.primary_symbol, processed_data_input, current_position_quantity, position_sizing_input, signal_decision_input);
+}
+
+void OrderExecutionLogic::execute_trade_for_symbol(const std::string& trading_symbol, const ProcessedData& processed_data_input, int current_position_quantity, const PositionSizing& position_sizing_input, const SignalDecision& signal_decision_input) {
     if (!validate_order_parameters(processed_data_input, position_sizing_input)) {
         throw std::runtime_error("Order validation failed - aborting trade execution");
     }
@@ -44,34 +48,34 @@ void OrderExecutionLogic::execute_trade(const ProcessedData& processed_data_inpu
     }
 
     if (signal_decision_input.buy) {
-        execute_order(OrderSide::Buy, processed_data_input, current_position_quantity, position_sizing_input);
+        execute_order(trading_symbol, OrderSide::Buy, processed_data_input, current_position_quantity, position_sizing_input);
     } else if (signal_decision_input.sell) {
         // For crypto (symbols with "/"), shorts are always available - no need to check
         // For stocks, short availability check is optional and requires symbol-specific API call
         // Since we're trading crypto (BTC/USD), always allow shorts
         if (current_position_quantity == 0) {
             // Opening new short position - always allowed for crypto
-            execute_order(OrderSide::Sell, processed_data_input, current_position_quantity, position_sizing_input);
+            execute_order(trading_symbol, OrderSide::Sell, processed_data_input, current_position_quantity, position_sizing_input);
         } else if (current_position_quantity > 0) {
             // Closing long position
-            execute_order(OrderSide::Sell, processed_data_input, current_position_quantity, position_sizing_input);
+            execute_order(trading_symbol, OrderSide::Sell, processed_data_input, current_position_quantity, position_sizing_input);
         } else {
             // Closing short position (buy to cover)
-            execute_order(OrderSide::Buy, processed_data_input, current_position_quantity, position_sizing_input);
+            execute_order(trading_symbol, OrderSide::Buy, processed_data_input, current_position_quantity, position_sizing_input);
         }
     }
 }
 
-void OrderExecutionLogic::execute_order(OrderSide order_side_input, const ProcessedData& processed_data_input, int current_position_quantity, const PositionSizing& position_sizing_input) {
+void OrderExecutionLogic::execute_order(const std::string& trading_symbol, OrderSide order_side_input, const ProcessedData& processed_data_input, int current_position_quantity, const PositionSizing& position_sizing_input) {
     // Check wash trade prevention first (if enabled)
     if (config.timing.enable_wash_trade_prevention_mechanism) {
-        if (!can_place_order_now()) {
+        if (!can_place_order_now(trading_symbol)) {
             throw std::runtime_error("Order blocked - minimum order interval not met (wash trade prevention)");
         }
     }
     
     if (should_close_opposite_position(order_side_input, current_position_quantity)) {
-        if (!close_opposite_position(order_side_input, current_position_quantity)) {
+        if (!close_opposite_position(trading_symbol, order_side_input, current_position_quantity)) {
             throw std::runtime_error("Position limits reached - could not close opposite position for " + 
                                    ((order_side_input == OrderSide::Buy) ? config.strategy.signal_buy_string : config.strategy.signal_sell_string));
         }
@@ -83,18 +87,18 @@ void OrderExecutionLogic::execute_order(OrderSide order_side_input, const Proces
     }
     
     if (current_position_quantity == 0) {
-        ExitTargets exit_targets_result = calculate_exit_targets(order_side_input, processed_data_input, position_sizing_input);
-        execute_bracket_order(order_side_input, processed_data_input, position_sizing_input, exit_targets_result);
+        ExitTargets exit_targets_result = calculate_exit_targets(trading_symbol, order_side_input, processed_data_input, position_sizing_input);
+        execute_bracket_order(trading_symbol, order_side_input, processed_data_input, position_sizing_input, exit_targets_result);
     } else {
-        execute_market_order(order_side_input, processed_data_input, position_sizing_input);
+        execute_market_order(trading_symbol, order_side_input, processed_data_input, position_sizing_input);
     }
     
     // Update the last order timestamp after successful order placement
-    update_last_order_timestamp();
+    update_last_order_timestamp(trading_symbol);
 }
 
 // Execute bracket order with proper validation
-void OrderExecutionLogic::execute_bracket_order(OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input, const ExitTargets& exit_targets_input) {
+void OrderExecutionLogic::execute_bracket_order(const std::string& trading_symbol, OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input, const ExitTargets& exit_targets_input) {
     bool has_pending_orders = false;
     try {
         has_pending_orders = !api_manager.get_open_orders().empty();
@@ -113,7 +117,7 @@ void OrderExecutionLogic::execute_bracket_order(OrderSide order_side_input, cons
     }
     
     std::string order_side_string = (order_side_input == OrderSide::Buy) ? config.strategy.signal_buy_string : config.strategy.signal_sell_string;
-    std::string symbol_string = config.trading_mode.primary_symbol;
+    std::string symbol_string = trading_symbol;
     double quantity_value = position_sizing_input.quantity;
     double entry_price_amount = processed_data_input.curr.close_price;
     
@@ -183,6 +187,10 @@ void OrderExecutionLogic::execute_bracket_order(OrderSide order_side_input, cons
 
 // Execute regular market order for closing positions
 void OrderExecutionLogic::execute_market_order(OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input) {
+    execute_market_order(config.trading_mode.primary_symbol, order_side_input, processed_data_input, position_sizing_input);
+}
+
+void OrderExecutionLogic::execute_market_order(const std::string& trading_symbol, OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input) {
     // Check for and cancel any pending orders before placing new ones
     if (!api_manager.get_open_orders().empty()) {
         // Wait a moment for order cancellation to process
@@ -191,7 +199,7 @@ void OrderExecutionLogic::execute_market_order(OrderSide order_side_input, const
     }
     
     std::string order_side_string = (order_side_input == OrderSide::Buy) ? config.strategy.signal_buy_string : config.strategy.signal_sell_string;
-    std::string symbol_string = config.trading_mode.primary_symbol;
+    std::string symbol_string = trading_symbol;
     double quantity_value = position_sizing_input.quantity;
     double current_price_amount = processed_data_input.curr.close_price;
     
@@ -230,7 +238,7 @@ bool OrderExecutionLogic::should_close_opposite_position(OrderSide order_side_in
            (order_side_input == OrderSide::Sell && current_position_quantity > 0);
 }
 
-bool OrderExecutionLogic::close_opposite_position(OrderSide order_side_input, int current_position_quantity) {
+bool OrderExecutionLogic::close_opposite_position(const std::string& trading_symbol, OrderSide order_side_input, int current_position_quantity) {
     // Validate order_side_input matches position direction
     bool position_is_long = current_position_quantity > 0;
     bool position_is_short = current_position_quantity < 0;
@@ -242,7 +250,7 @@ bool OrderExecutionLogic::close_opposite_position(OrderSide order_side_input, in
     }
     
     try {
-        api_manager.close_position(config.trading_mode.primary_symbol, current_position_quantity);
+        api_manager.close_position(trading_symbol, current_position_quantity);
         
         int position_verification_timeout_milliseconds = config.timing.position_verification_timeout_milliseconds;
         int maximum_position_verification_attempts = config.timing.maximum_position_verification_attempts;
@@ -260,8 +268,8 @@ bool OrderExecutionLogic::close_opposite_position(OrderSide order_side_input, in
         std::this_thread::sleep_for(position_close_wait_time);
         
         for (int verification_attempt_number = 0; verification_attempt_number < maximum_position_verification_attempts; ++verification_attempt_number) {
-            AccountSnapshot verify_account_snapshot = account_manager.fetch_account_snapshot();
-            int verify_position_quantity_result = verify_account_snapshot.pos_details.position_quantity;
+            PositionDetails verify_position_details = account_manager.fetch_position_details(SymbolRequest{trading_symbol});
+            int verify_position_quantity_result = verify_position_details.position_quantity;
             
             if (verify_position_quantity_result == 0) {
                 return true;
@@ -324,12 +332,16 @@ bool OrderExecutionLogic::validate_order_parameters(const ProcessedData& process
 }
 
 ExitTargets OrderExecutionLogic::calculate_exit_targets(OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input) const {
+    return calculate_exit_targets(config.trading_mode.primary_symbol, order_side_input, processed_data_input, position_sizing_input);
+}
+
+ExitTargets OrderExecutionLogic::calculate_exit_targets(const std::string& trading_symbol, OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input) const {
     double entry_price_amount = processed_data_input.curr.close_price;
     
     // Use real-time price if configured and available
     if (config.strategy.use_current_market_price_for_order_execution) {
         try {
-            double realtime_price_amount = api_manager.get_current_price(config.trading_mode.primary_symbol);
+            double realtime_price_amount = api_manager.get_current_price(trading_symbol);
             if (realtime_price_amount > 0.0) {
                 entry_price_amount = realtime_price_amount;
             }
@@ -351,7 +363,16 @@ ExitTargets OrderExecutionLogic::calculate_exit_targets(OrderSide order_side_inp
 }
 
 // Order timing methods for wash trade prevention
-bool OrderExecutionLogic::can_place_order_now() const {
+bool OrderExecutionLogic::can_place_order_now(const std::string& trading_symbol) const {
+    if (trading_symbol != config.trading_mode.primary_symbol) {
+        auto last_order_iterator = symbol_last_order_times.find(trading_symbol);
+        if (last_order_iterator == symbol_last_order_times.end()) {
+            return true;
+        }
+        auto symbol_elapsed_seconds = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - last_order_iterator->second);
+        return symbol_elapsed_seconds.count() >= config.timing.minimum_interval_between_orders_seconds;
+    }
+
     // Validate data_sync is properly initialized
     if (!data_sync_ptr || !data_sync_ptr->last_order_timestamp) {
         return false;
@@ -375,7 +396,12 @@ bool OrderExecutionLogic::can_place_order_now() const {
     return elapsed_seconds >= min_interval;
 }
 
-void OrderExecutionLogic::update_last_order_timestamp() {
+void OrderExecutionLogic::update_last_order_timestamp(const std::string& trading_symbol) {
+    if (trading_symbol != config.trading_mode.primary_symbol) {
+        symbol_last_order_times[trading_symbol] = std::chrono::steady_clock::now();
+        return;
+    }
+
     // Validate data_sync is properly initialized
     if (!data_sync_ptr || !data_sync_ptr->last_order_timestamp) {
         throw std::runtime_error("Data sync not initialized - cannot update last order timestamp");
@@ -8,6 +8,9 @@
 #include "trader/account_management/account_manager.hpp"
 #include "trading_logic_structures.hpp"
 #include "api/general/api_manager.hpp"
+#include <chrono>
+#include <string>
+#include <unordered_map>
 
 namespace AlpacaTrader {
 namespace Core {
@@ -16,6 +19,8 @@ class OrderExecutionLogic {
 public:
     OrderExecutionLogic(const OrderExecutionLogicConstructionParams& construction_params);
     void execute_trade(const ProcessedData& processed_data_input, int current_position_quantity, const PositionSizing& position_sizing_input, const SignalDecision& signal_decision_input);
+    // Same as execute_trade for a symbol other than the primary one (multi-symbol portfolio)
+    void execute_trade_for_symbol(const std::string& trading_symbol, const ProcessedData& processed_data_input, int current_position_quantity, const PositionSizing& position_sizing_input, const SignalDecision& signal_decision_input);
     
     enum class OrderSide { Buy, Sell };
     
@@ -32,19 +37,23 @@ private:
     AccountManager& account_manager;
     const SystemConfig& config;
     DataSyncReferences* data_sync_ptr;
+    // Wash trade prevention for symbols other than the primary one, which uses data_sync_ptr->last_order_timestamp
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> symbol_last_order_times;
     
     // Core execution methods
-    void execute_order(OrderSide order_side_input, const ProcessedData& processed_data_input, int current_position_quantity, const PositionSizing& position_sizing_input);
-    void execute_bracket_order(OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input, const ExitTargets& exit_targets_input);
+    void execute_order(const std::string& trading_symbol, OrderSide order_side_input, const ProcessedData& processed_data_input, int current_position_quantity, const PositionSizing& position_sizing_input);
+    void execute_bracket_order(const std::string& trading_symbol, OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input, const ExitTargets& exit_targets_input);
+    void execute_market_order(const std::string& trading_symbol, OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input);
+    ExitTargets calculate_exit_targets(const std::string& trading_symbol, OrderSide order_side_input, const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input) const;
     
     // Position management methods
     bool should_close_opposite_position(OrderSide order_side_input, int current_position_quantity) const;
-    bool close_opposite_position(OrderSide order_side_input, int current_position_quantity);
+    bool close_opposite_position(const std::string& trading_symbol, OrderSide order_side_input, int current_position_quantity);
     bool can_execute_new_position(int current_position_quantity) const;
     
     // Order timing methods
-    bool can_place_order_now() const;
-    void update_last_order_timestamp();
+    bool can_place_order_now(const std::string& trading_symbol) const;
+    void update_last_order_timestamp(const std::string& trading_symbol);
     
     // Order validation and preparation
     bool validate_order_parameters(const ProcessedData& processed_data_input, const PositionSizing& position_sizing_input) const;
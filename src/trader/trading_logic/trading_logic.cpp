@@ -1,5 +1,6 @@
 #include "trading_logic.hpp"
 #include "api/general/api_manager.hpp"
+#include "utils/time_utils.hpp"
 #include <chrono>
 #include <cmath>
 #include <memory>
@@ -12,12 +13,13 @@ TradingLogic::TradingLogic(const TradingLogicConstructionParams& construction_pa
     : config(construction_params.system_config), account_manager(construction_params.account_manager_ref), 
       api_manager(construction_params.api_manager_ref),
       risk_manager(construction_params.system_config),
+      strategy_ensemble(construction_params.system_config),
       order_engine(OrderExecutionLogicConstructionParams(construction_params.api_manager_ref, construction_params.account_manager_ref, construction_params.system_config, nullptr)),
       market_data_manager(construction_params.system_config, construction_params.api_manager_ref, construction_params.account_manager_ref),
       connectivity_manager(construction_params.connectivity_manager_ref),
       data_sync_ptr(nullptr) {}
 
-TradingDecisionResult TradingLogic::execute_trading_cycle(const MarketSnapshot& market_snapshot, const AccountSnapshot& account_snapshot, double initial_equity) {
+TradingDecisionResult TradingLogic::execute_trading_cycle(const MarketSnapshot& market_snapshot, const AccountSnapshot& account_snapshot, const MultiTimeframeInputs& multi_timeframe_inputs, double initial_equity) {
     
     TradingDecisionResult empty_result;
     
@@ -42,15 +44,13 @@ TradingDecisionResult TradingLogic::execute_trading_cycle(const MarketSnapshot&
         
         
         // Check if sufficient data accumulation time has elapsed before allowing trades
-        if (!market_snapshot.oldest_bar_timestamp.empty()) {
+        if (market_snapshot.oldest_bar_timestamp_ns != 0) {
             try {
-                long long oldest_bar_timestamp_millis_value = std::stoll(market_snapshot.oldest_bar_timestamp);
-                if (oldest_bar_timestamp_millis_value > 0) {
-                    auto current_time_millis_value = std::chrono::duration_cast<std::chrono::milliseconds>(
-                        std::chrono::system_clock::now().time_since_epoch()
-                    ).count();
+                int64_t oldest_bar_timestamp_ns_value = market_snapshot.oldest_bar_timestamp_ns;
+                if (oldest_bar_timestamp_ns_value > 0) {
+                    int64_t current_time_ns_value = TimeUtils::get_current_epoch_nanoseconds();
                     
-                    long long data_accumulation_time_seconds_value = (current_time_millis_value - oldest_bar_timestamp_millis_value) / 1000LL;
+                    long long data_accumulation_time_seconds_value = (current_time_ns_value - oldest_bar_timestamp_ns_value) / TimeUtils::NANOSECONDS_PER_SECOND;
                     int minimum_accumulation_seconds_value = config.strategy.minimum_data_accumulation_seconds_before_trading;
                     
                     if (data_accumulation_time_seconds_value < minimum_accumulation_seconds_value) {
@@ -123,6 +123,7 @@ TradingDecisionResult TradingLogic::execute_trading_cycle(const MarketSnapshot&
         try {
             
             processed_data_for_trading = ProcessedData(market_snapshot, account_snapshot);
+            processed_data_for_trading.multi_timeframe_inputs = multi_timeframe_inputs;
             
             
             // CRITICAL: Validate ProcessedData after creation
@@ -380,51 +381,41 @@ TradingDecisionResult TradingLogic::execute_trading_decision(const ProcessedData
 
 
     try {
-        result.signal_decision = detect_trading_signals(processed_data_input, config);
-    } catch (const std::exception& signal_detection_exception_error) {
+        result.buying_power_amount = account_manager.fetch_buying_power();
+    } catch (const std::exception& buying_power_exception_error) {
         result.validation_failed = true;
-        result.validation_error_message = "Exception detecting trading signals: " + std::string(signal_detection_exception_error.what());
+        result.validation_error_message = "Exception fetching buying power: " + std::string(buying_power_exception_error.what());
         return result;
     } catch (...) {
         result.validation_failed = true;
-        result.validation_error_message = "Unknown exception detecting trading signals";
+        result.validation_error_message = "Unknown exception fetching buying power";
         return result;
     }
     
     
+    // Signals, filters and sizing of every strategy from this one ProcessedData, then arbitrated
+    PositionSizing position_sizing_result;
     try {
-        result.filter_result = evaluate_trading_filters(processed_data_input, config);
-    } catch (const std::exception& filter_evaluation_exception_error) {
-        result.validation_failed = true;
-        result.validation_error_message = "Exception evaluating trading filters: " + std::string(filter_evaluation_exception_error.what());
-        return result;
-    } catch (...) {
-        result.validation_failed = true;
-        result.validation_error_message = "Unknown exception evaluating trading filters";
-        return result;
-    }
-
-
-    try {
-        result.buying_power_amount = account_manager.fetch_buying_power();
-    } catch (const std::exception& buying_power_exception_error) {
+        StrategyEnsembleDecision ensemble_decision = strategy_ensemble.evaluate(StrategyEvaluationRequest(
+            processed_data_input, account_equity, current_position_quantity, result.buying_power_amount
+        ));
+        result.signal_decision = ensemble_decision.signal_decision;
+        result.filter_result = ensemble_decision.filter_result;
+        position_sizing_result = ensemble_decision.position_sizing;
+        result.winning_strategy_name = ensemble_decision.winning_strategy_name;
+        result.strategy_decisions = std::move(ensemble_decision.strategy_decisions);
+    } catch (const std::exception& strategy_evaluation_exception_error) {
         result.validation_failed = true;
-        result.validation_error_message = "Exception fetching buying power: " + std::string(buying_power_exception_error.what());
+        result.validation_error_message = "Exception evaluating trading strategies: " + std::string(strategy_evaluation_exception_error.what());
         return result;
     } catch (...) {
         result.validation_failed = true;
-        result.validation_error_message = "Unknown exception fetching buying power";
+        result.validation_error_message = "Unknown exception evaluating trading strategies";
         return result;
     }
-    
-    
-    try {
-        
-        auto [position_sizing_result, position_sizing_signal_decision] = AlpacaTrader::Core::process_position_sizing(PositionSizingProcessRequest(
-            processed_data_input, account_equity, current_position_quantity, result.buying_power_amount, config.strategy, config.trading_mode
-        ));
         
         
+    try {
         result.position_sizing_result = position_sizing_result;
         // CRITICAL: Store copy of ProcessedData instead of pointer to avoid use-after-free
         // Explicitly copy all fields to ensure complete data transfer
@@ -435,7 +426,7 @@ TradingDecisionResult TradingLogic::execute_trading_decision(const ProcessedData
         result.processed_data.open_orders = processed_data_input.open_orders;
         result.processed_data.exposure_pct = processed_data_input.exposure_pct;
         result.processed_data.is_doji = processed_data_input.is_doji;
-        result.processed_data.oldest_bar_timestamp = processed_data_input.oldest_bar_timestamp;
+        result.processed_data.oldest_bar_timestamp_ns = processed_data_input.oldest_bar_timestamp_ns;
         
         // Explicitly copy curr Bar fields
         result.processed_data.curr.open_price = processed_data_input.curr.open_price;
@@ -443,7 +434,7 @@ TradingDecisionResult TradingLogic::execute_trading_decision(const ProcessedData
         result.processed_data.curr.low_price = processed_data_input.curr.low_price;
         result.processed_data.curr.close_price = processed_data_input.curr.close_price;
         result.processed_data.curr.volume = processed_data_input.curr.volume;
-        result.processed_data.curr.timestamp = processed_data_input.curr.timestamp;
+        result.processed_data.curr.timestamp_ns = processed_data_input.curr.timestamp_ns;
         
         // Explicitly copy prev Bar fields
         result.processed_data.prev.open_price = processed_data_input.prev.open_price;
@@ -451,7 +442,7 @@ TradingDecisionResult TradingLogic::execute_trading_decision(const ProcessedData
         result.processed_data.prev.low_price = processed_data_input.prev.low_price;
         result.processed_data.prev.close_price = processed_data_input.prev.close_price;
         result.processed_data.prev.volume = processed_data_input.prev.volume;
-        result.processed_data.prev.timestamp = processed_data_input.prev.timestamp;
+        result.processed_data.prev.timestamp_ns = processed_data_input.prev.timestamp_ns;
         
         result.current_position_quantity = current_position_quantity;
         
@@ -7,6 +7,7 @@
 #include "trader/data_structures/data_structures.hpp"
 #include "trader/strategy_analysis/strategy_logic.hpp"
 #include "trader/strategy_analysis/risk_manager.hpp"
+#include "trader/strategy_analysis/strategy_ensemble.hpp"
 #include "trader/market_data/market_data_manager.hpp"
 #include "trader/data_structures/data_sync_structures.hpp"
 #include "trading_logic_structures.hpp"
@@ -24,7 +25,7 @@ public:
     
     bool check_trading_permissions(const ProcessedData& processed_data_input, double account_equity);
     TradingDecisionResult execute_trading_decision(const ProcessedData& processed_data_input, double account_equity);
-    TradingDecisionResult execute_trading_cycle(const MarketSnapshot& market_snapshot, const AccountSnapshot& account_snapshot, double initial_equity);
+    TradingDecisionResult execute_trading_cycle(const MarketSnapshot& market_snapshot, const AccountSnapshot& account_snapshot, const MultiTimeframeInputs& multi_timeframe_inputs, double initial_equity);
     void handle_trading_halt();
     bool handle_market_close_positions(const ProcessedData& processed_data_for_close);
     void setup_data_synchronization(const DataSyncConfig& sync_configuration);
@@ -38,6 +39,7 @@ private:
     AccountManager& account_manager;
     API::ApiManager& api_manager;
     RiskManager risk_manager;
+    StrategyEnsemble strategy_ensemble;
     OrderExecutionLogic order_engine;
     MarketDataManager market_data_manager;
     ConnectivityManager& connectivity_manager;
@@ -6,6 +6,7 @@
 #include "trader/account_management/account_manager.hpp"
 #include "trader/data_structures/data_structures.hpp"
 #include "trader/data_structures/data_sync_structures.hpp"
+#include "trader/strategy_analysis/trading_strategy.hpp"
 #include "utils/connectivity_manager.hpp"
 
 namespace AlpacaTrader {
@@ -83,6 +84,8 @@ struct TradingDecisionResult {
     bool should_execute_trade;
     ProcessedData processed_data;   
     int current_position_quantity;
+    std::vector<StrategyDecision> strategy_decisions;   // Every ensemble member's own decision
+    std::string winning_strategy_name;                  // Empty when the combiner found no decision
     
     TradingDecisionResult()
         : validation_failed(false), market_closed(false), market_data_stale(false),
@@ -90,21 +90,64 @@ std::tm parse_iso_time_with_z(const std::string& timestamp) {
     return t;
 }
 
-std::string convert_milliseconds_to_human_readable(const std::string& milliseconds_timestamp) {
-    try {
-        long long timestamp_millis = std::stoll(milliseconds_timestamp);
-        time_t timestamp_seconds = timestamp_millis / 1000;
-        
-        struct tm timeinfo;
-        localtime_r(&timestamp_seconds, &timeinfo);
-        
-        std::stringstream ss;
-        ss << std::put_time(&timeinfo, HUMAN_READABLE);
-        return ss.str();
-    } catch (const std::exception&) {
-        // If conversion fails, return original timestamp
-        return milliseconds_timestamp;
+int64_t get_current_epoch_nanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+int64_t milliseconds_to_epoch_nanoseconds(int64_t epoch_milliseconds) {
+    return epoch_milliseconds * NANOSECONDS_PER_MILLISECOND;
+}
+
+int64_t parse_iso_time_to_epoch_nanoseconds(const std::string& iso_timestamp) {
+    if (iso_timestamp.size() < 19) {
+        return 0;
+    }
+    
+    std::tm parsed_time = parse_iso_time_with_z(iso_timestamp);
+    time_t epoch_seconds = timegm(&parsed_time);
+    if (epoch_seconds < 0) {
+        return 0;
     }
+    
+    // Optional fractional seconds, e.g. 2024-01-02T14:30:00.123456789Z
+    int64_t fractional_nanoseconds = 0;
+    if (iso_timestamp.size() > 19 && iso_timestamp[19] == '.') {
+        int64_t digit_scale = NANOSECONDS_PER_SECOND / 10;
+        for (size_t i = 20; i < iso_timestamp.size() && digit_scale > 0; ++i) {
+            char digit_character = iso_timestamp[i];
+            if (digit_character < '0' || digit_character > '9') {
+                break;
+            }
+            fractional_nanoseconds += (digit_character - '0') * digit_scale;
+            digit_scale /= 10;
+        }
+    }
+    
+    // Apply explicit UTC offset if present (e.g., +05:00)
+    int64_t offset_seconds = 0;
+    size_t tz_pos = iso_timestamp.find_first_of("+-", 19);
+    if (tz_pos != std::string::npos && iso_timestamp.size() >= tz_pos + 6) {
+        int offset_hours = std::stoi(iso_timestamp.substr(tz_pos + 1, 2));
+        int offset_minutes = std::stoi(iso_timestamp.substr(tz_pos + 4, 2));
+        offset_seconds = (offset_hours * 3600LL + offset_minutes * 60LL) * (iso_timestamp[tz_pos] == '+' ? 1 : -1);
+    }
+    
+    return (static_cast<int64_t>(epoch_seconds) - offset_seconds) * NANOSECONDS_PER_SECOND + fractional_nanoseconds;
+}
+
+std::string format_epoch_nanoseconds_human_readable(int64_t epoch_nanoseconds) {
+    time_t timestamp_seconds = static_cast<time_t>(epoch_nanoseconds / NANOSECONDS_PER_SECOND);
+    
+    struct tm timeinfo;
+    localtime_r(&timestamp_seconds, &timeinfo);
+    
+    std::stringstream ss;
+    ss << std::put_time(&timeinfo, HUMAN_READABLE);
+    return ss.str();
+}
+
+std::string format_epoch_nanoseconds_raw(int64_t epoch_nanoseconds) {
+    return std::to_string(epoch_nanoseconds);
 }
 
 } // namespace TimeUtils
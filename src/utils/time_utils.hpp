@@ -2,6 +2,7 @@
 #define TIME_UTILS_HPP
 
 #include <string>
+#include <cstdint>
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -25,8 +26,17 @@ std::string get_iso_time_plus_minutes(int minutes);
 std::tm parse_iso_time(const std::string& timestamp);
 std::tm parse_iso_time_with_z(const std::string& timestamp);
 
-// Timestamp conversion functions
-std::string convert_milliseconds_to_human_readable(const std::string& milliseconds_timestamp);
+// Epoch-nanosecond timestamps (bar/quote timestamps are carried as int64_t nanoseconds)
+constexpr int64_t NANOSECONDS_PER_MILLISECOND = 1000000LL;
+constexpr int64_t NANOSECONDS_PER_SECOND = 1000000000LL;
+
+int64_t get_current_epoch_nanoseconds();
+int64_t milliseconds_to_epoch_nanoseconds(int64_t epoch_milliseconds);
+int64_t parse_iso_time_to_epoch_nanoseconds(const std::string& iso_timestamp);
+
+// Formatting happens only at the logging/CSV edge
+std::string format_epoch_nanoseconds_human_readable(int64_t epoch_nanoseconds);
+std::string format_epoch_nanoseconds_raw(int64_t epoch_nanoseconds);
 
 } // namespace TimeUtils
 